@@ -1,3 +1,27 @@
 function onUpdateDatabase()
-	return false -- true = There are others migrations file | false = this is the last migration file
+	logger.info("Updating database to version 45 (market statistics summary)")
+
+	db.query([[
+		CREATE TABLE IF NOT EXISTS `market_statistics` (
+			`itemtype` int(10) UNSIGNED NOT NULL,
+			`sale` tinyint(1) NOT NULL DEFAULT '0',
+			`tier` tinyint UNSIGNED NOT NULL DEFAULT '0',
+			`day` int(10) UNSIGNED NOT NULL,
+			`num` int(10) UNSIGNED NOT NULL DEFAULT '0',
+			`min` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+			`max` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+			`sum` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+			CONSTRAINT `market_statistics_pk` PRIMARY KEY (`itemtype`, `sale`, `tier`, `day`)
+		) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+	]])
+
+	-- Backfill from the accepted offers still in the history, one row per item, side, tier and day
+	db.query([[
+		INSERT INTO `market_statistics` (`itemtype`, `sale`, `tier`, `day`, `num`, `min`, `max`, `sum`)
+		SELECT `itemtype`, `sale`, `tier`, FLOOR(`inserted` / 86400), COUNT(`price`), MIN(`price`), MAX(`price`), SUM(`price`)
+		FROM `market_history` WHERE `state` = 3
+		GROUP BY `itemtype`, `sale`, `tier`, FLOOR(`inserted` / 86400)
+	]])
+
+	return true
 end
@@ -70,3 +70,22 @@ function MonsterType:generateLootRoll(config, resultTable)
 
 	return result
 end
+
+-- roll the loot natively straight into the container, returns the number of dropped creature products
+---@param container Container
+---@param config { factor: number, gut: boolean }
+---@return number
+function MonsterType:dropLoot(container, config)
+	local rateLoot = configManager.getNumber(configKeys.RATE_LOOT)
+	if rateLoot <= 0 then
+		return 0
+	end
+
+	local factor = config.factor or 1.0
+	if self:isRewardBoss() then
+		factor = factor * SCHEDULE_BOSS_LOOT_RATE / 100
+	end
+
+	local creatureProductChance = config.gut and GLOBAL_CHARM_GUT or 100
+	return self:generateLoot(container, rateLoot * SCHEDULE_LOOT_RATE * factor, creatureProductChance) or 0
+end
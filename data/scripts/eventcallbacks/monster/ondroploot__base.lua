@@ -22,12 +22,9 @@ function callback.monsterOnDropLoot(monster, corpse)
 	local charm = player and player:getCharmMonsterType(CHARM_GUT)
 	local gut = charm and charm:raceId() == mType:raceId()
 
-	local lootTable = mType:generateLootRoll({ factor = factor, gut = gut }, {})
-	corpse:addLoot(lootTable)
-	for _, item in ipairs(lootTable) do
-		if item.gut then
-			msgSuffix = msgSuffix .. " (active charm bonus)"
-		end
+	local creatureProducts = mType:dropLoot(corpse, { factor = factor, gut = gut })
+	if gut and creatureProducts > 0 then
+		msgSuffix = msgSuffix .. " (active charm bonus)"
 	end
 	local existingSuffix = corpse:getAttribute(ITEM_ATTRIBUTE_LOOTMESSAGE_SUFFIX) or ""
 	corpse:setAttribute(ITEM_ATTRIBUTE_LOOTMESSAGE_SUFFIX, existingSuffix .. msgSuffix)
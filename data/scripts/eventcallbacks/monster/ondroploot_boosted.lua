@@ -22,7 +22,7 @@ function callback.monsterOnDropLoot(monster, corpse)
 
 	local factor = 1.0
 	local msgSuffix = " (boosted loot)"
-	corpse:addLoot(mType:generateLootRoll({ factor = factor, gut = false }, {}))
+	mType:dropLoot(corpse, { factor = factor, gut = false })
 
 	local existingSuffix = corpse:getAttribute(ITEM_ATTRIBUTE_LOOTMESSAGE_SUFFIX) or ""
 	corpse:setAttribute(ITEM_ATTRIBUTE_LOOTMESSAGE_SUFFIX, existingSuffix .. msgSuffix)
@@ -29,11 +29,9 @@ function callback.monsterOnDropLoot(monster, corpse)
 		msgSuffix = msgSuffix .. " (hazard system)"
 	end
 
-	local lootTable = {}
 	for _ = 1, rolls do
-		lootTable = mType:generateLootRoll({ factor = factor, gut = false }, lootTable)
+		mType:dropLoot(corpse, { factor = factor, gut = false })
 	end
-	corpse:addLoot(lootTable)
 
 	local existingSuffix = corpse:getAttribute(ITEM_ATTRIBUTE_LOOTMESSAGE_SUFFIX) or ""
 	corpse:setAttribute(ITEM_ATTRIBUTE_LOOTMESSAGE_SUFFIX, existingSuffix .. msgSuffix)
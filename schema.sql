@@ -7,7 +7,7 @@ CREATE TABLE IF NOT EXISTS `server_config` (
     CONSTRAINT `server_config_pk` PRIMARY KEY (`config`)
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8;
 
-INSERT INTO `server_config` (`config`, `value`) VALUES ('db_version', '44'), ('motd_hash', ''), ('motd_num', '0'), ('players_record', '0');
+INSERT INTO `server_config` (`config`, `value`) VALUES ('db_version', '45'), ('motd_hash', ''), ('motd_num', '0'), ('players_record', '0');
 
 -- Table structure `accounts`
 CREATE TABLE IF NOT EXISTS `accounts` (
@@ -503,6 +503,19 @@ CREATE TABLE IF NOT EXISTS `market_offers` (
         ON DELETE CASCADE
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8;
 
+-- Table structure `market_statistics`
+CREATE TABLE IF NOT EXISTS `market_statistics` (
+    `itemtype` int(10) UNSIGNED NOT NULL,
+    `sale` tinyint(1) NOT NULL DEFAULT '0',
+    `tier` tinyint UNSIGNED NOT NULL DEFAULT '0',
+    `day` int(10) UNSIGNED NOT NULL,
+    `num` int(10) UNSIGNED NOT NULL DEFAULT '0',
+    `min` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+    `max` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+    `sum` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+    CONSTRAINT `market_statistics_pk` PRIMARY KEY (`itemtype`, `sale`, `tier`, `day`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+
 
 -- Table structure `players_online`
 CREATE TABLE IF NOT EXISTS `players_online` (
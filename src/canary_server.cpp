@@ -16,6 +16,7 @@
 #include "creatures/players/storages/storages.hpp"
 #include "database/databasemanager.hpp"
 #include "game/game.hpp"
+#include "game/highscores/highscores.hpp"
 #include "game/zones/zone.hpp"
 #include "game/scheduling/dispatcher.hpp"
 #include "game/scheduling/events_scheduler.hpp"
@@ -23,6 +24,8 @@
 #include "lib/thread/thread_pool.hpp"
 #include "lua/creature/events.hpp"
 #include "lua/modules/modules.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
+#include "lua/scripts/lua_chunk_compiler.hpp"
 #include "lua/scripts/lua_environment.hpp"
 #include "lua/scripts/scripts.hpp"
 #include "server/network/protocol/protocollogin.hpp"
@@ -58,6 +61,7 @@ int CanaryServer::run() {
 	g_dispatcher().addEvent(
 		[this] {
 			try {
+				Benchmark bm_boot;
 				loadConfigLua();
 
 				logger.info("Server protocol: {}.{}{}", CLIENT_VERSION_UPPER, CLIENT_VERSION_LOWER, g_configManager().getBoolean(OLD_PROTOCOL, __FUNCTION__) ? " and 10x allowed!" : "");
@@ -78,6 +82,9 @@ int CanaryServer::run() {
 				loadModules();
 				setWorldType();
 				loadMaps();
+				IOMarket::getInstance().loadOffers();
+				IOMarket::getInstance().loadStatistics();
+				g_highscores().load();
 
 				logger.info("Initializing gamestate...");
 				g_game().setGameState(GAME_STATE_INIT);
@@ -88,7 +95,7 @@ int CanaryServer::run() {
 				IOMarket::checkExpiredOffers();
 				IOMarket::getInstance().updateStatistics();
 
-				logger.info("Loaded all modules, server starting up...");
+				logger.info("Loaded all modules in {} milliseconds, server starting up...", bm_boot.duration());
 
 #ifndef _WIN32
 				if (getuid() == 0 || geteuid() == 0) {
@@ -142,6 +149,54 @@ int CanaryServer::run() {
 	return EXIT_SUCCESS;
 }
 
+int CanaryServer::prewarmLuaCache() {
+	try {
+		loadConfigLua();
+	} catch (FailedToInitializeCanary &err) {
+		logger.error(err.what());
+		shutdown();
+		return EXIT_FAILURE;
+	}
+
+	const auto cacheDirectory = g_configManager().getString(LUA_BYTECODE_CACHE_DIRECTORY, __FUNCTION__);
+	if (cacheDirectory.empty()) {
+		logger.error("The lua bytecode cache is disabled, set luaBytecodeCacheDirectory in {}", g_configManager().getConfigFileLua());
+		shutdown();
+		return EXIT_FAILURE;
+	}
+
+	Benchmark bm_prewarm;
+	auto &bytecodeCache = g_luaBytecodeCache();
+	bytecodeCache.setDirectory(cacheDirectory);
+	std::vector<std::string> files;
+	for (const auto &folder : { g_configManager().getString(CORE_DIRECTORY, __FUNCTION__), g_configManager().getString(DATA_DIRECTORY, __FUNCTION__) }) {
+		const auto dir = std::filesystem::current_path() / folder;
+		if (!std::filesystem::is_directory(dir)) {
+			logger.warn("Can not find folder {}", folder);
+			continue;
+		}
+
+		for (const auto &entry : std::filesystem::recursive_directory_iterator(dir)) {
+			// Disabled scripts, prefixed with "#", are skipped like Scripts::loadScripts does
+			if (entry.is_regular_file() && entry.path().extension() == ".lua" && entry.path().filename().string().front() != '#') {
+				files.push_back(entry.path().string());
+			}
+		}
+	}
+
+	size_t failed = 0;
+	for (const auto &chunk : LuaChunkCompiler::compile(inject<ThreadPool>(), files, &bytecodeCache)) {
+		if (!chunk.error.empty()) {
+			logger.warn(chunk.error);
+			++failed;
+		}
+	}
+
+	logger.info("Prewarmed the lua bytecode cache in {} with {} scripts in {} milliseconds, {} were up to date and {} failed to compile", cacheDirectory, files.size(), bm_prewarm.duration(), bytecodeCache.getHits(), failed);
+	shutdown();
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 void CanaryServer::setWorldType() {
 	const std::string worldType = asLowerCaseString(g_configManager().getString(WORLD_TYPE, __FUNCTION__));
 	if (worldType == "pvp") {
@@ -337,6 +392,7 @@ void CanaryServer::loadModules() {
 	}
 
 	logger.debug("Initializing lua environment...");
+	g_luaBytecodeCache().setDirectory(g_configManager().getString(LUA_BYTECODE_CACHE_DIRECTORY, __FUNCTION__));
 	if (!g_luaEnvironment().getLuaState()) {
 		g_luaEnvironment().initState();
 	}
@@ -38,6 +38,8 @@ public:
 	);
 
 	int run();
+	// Compiles every script of the core and the datapack into the bytecode cache, without starting the server
+	int prewarmLuaCache();
 
 private:
 	enum class LoaderStatus : uint8_t {
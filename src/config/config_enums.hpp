@@ -116,6 +116,7 @@ enum ConfigKey_t : uint16_t {
 	HOUSE_RENT_PERIOD,
 	HOUSE_RENT_RATE,
 	INVENTORY_GLOW,
+	INVENTORY_ITEM_INDEX_CONSISTENCY_CHECK,
 	IP,
 	KICK_AFTER_MINUTES,
 	LOCATION,
@@ -128,6 +129,11 @@ enum ConfigKey_t : uint16_t {
 	LOYALTY_POINTS_PER_CREATION_DAY,
 	LOYALTY_POINTS_PER_PREMIUM_DAY_PURCHASED,
 	LOYALTY_POINTS_PER_PREMIUM_DAY_SPENT,
+	LUA_BYTECODE_CACHE_DIRECTORY,
+	LUA_GC_PAUSE,
+	LUA_GC_STEP_BUDGET,
+	LUA_GC_STEP_INTERVAL,
+	LUA_GC_STEP_MULTIPLIER,
 	M_CONST,
 	MAINTAIN_MODE_MESSAGE,
 	MAP_AUTHOR,
@@ -279,6 +285,7 @@ enum ConfigKey_t : uint16_t {
 	TIBIADROME_CONCOCTION_TICK_TYPE,
 	TOGGLE_ATTACK_SPEED_ONFIST,
 	TOGGLE_CHAIN_SYSTEM,
+	TOGGLE_CREATURE_HIBERNATION,
 	TOGGLE_DOWNLOAD_MAP,
 	TOGGLE_FREE_QUEST,
 	TOGGLE_GOLD_POUCH_ALLOW_ANYTHING,
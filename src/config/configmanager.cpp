@@ -107,6 +107,7 @@ bool ConfigManager::load() {
 	loadBoolConfig(L, HOUSE_OWNED_BY_ACCOUNT, "houseOwnedByAccount", false);
 	loadBoolConfig(L, HOUSE_PURSHASED_SHOW_PRICE, "housePurchasedShowPrice", false);
 	loadBoolConfig(L, INVENTORY_GLOW, "inventoryGlowOnFiveBless", false);
+	loadBoolConfig(L, INVENTORY_ITEM_INDEX_CONSISTENCY_CHECK, "inventoryItemIndexConsistencyCheck", false);
 	loadBoolConfig(L, LOYALTY_ENABLED, "loyaltyEnabled", true);
 	loadBoolConfig(L, MARKET_PREMIUM, "premiumToCreateMarketOffer", true);
 	loadBoolConfig(L, METRICS_ENABLE_OSTREAM, "metricsEnableOstream", false);
@@ -141,6 +142,7 @@ bool ConfigManager::load() {
 	loadBoolConfig(L, TELEPORT_SUMMONS, "teleportSummons", false);
 	loadBoolConfig(L, TOGGLE_ATTACK_SPEED_ONFIST, "toggleAttackSpeedOnFist", false);
 	loadBoolConfig(L, TOGGLE_CHAIN_SYSTEM, "toggleChainSystem", true);
+	loadBoolConfig(L, TOGGLE_CREATURE_HIBERNATION, "toggleCreatureHibernation", true);
 	loadBoolConfig(L, TOGGLE_DOWNLOAD_MAP, "toggleDownloadMap", false);
 	loadBoolConfig(L, TOGGLE_FREE_QUEST, "toggleFreeQuest", true);
 	loadBoolConfig(L, TOGGLE_GOLD_POUCH_ALLOW_ANYTHING, "toggleGoldPouchAllowAnything", false);
@@ -272,6 +274,10 @@ bool ConfigManager::load() {
 	loadIntConfig(L, LOYALTY_POINTS_PER_CREATION_DAY, "loyaltyPointsPerCreationDay", 1);
 	loadIntConfig(L, LOYALTY_POINTS_PER_PREMIUM_DAY_PURCHASED, "loyaltyPointsPerPremiumDayPurchased", 0);
 	loadIntConfig(L, LOYALTY_POINTS_PER_PREMIUM_DAY_SPENT, "loyaltyPointsPerPremiumDaySpent", 0);
+	loadIntConfig(L, LUA_GC_PAUSE, "luaGarbageCollectorPause", 200);
+	loadIntConfig(L, LUA_GC_STEP_BUDGET, "luaGarbageCollectorStepBudget", 500);
+	loadIntConfig(L, LUA_GC_STEP_INTERVAL, "luaGarbageCollectorStepInterval", 100);
+	loadIntConfig(L, LUA_GC_STEP_MULTIPLIER, "luaGarbageCollectorStepMultiplier", 200);
 	loadIntConfig(L, MAX_ALLOWED_ON_A_DUMMY, "maxAllowedOnADummy", 1);
 	loadIntConfig(L, MAX_CONTAINER_ITEM, "maxItem", 5000);
 	loadIntConfig(L, MAX_CONTAINER, "maxContainer", 500);
@@ -352,6 +358,7 @@ bool ConfigManager::load() {
 	loadStringConfig(L, FORGE_FIENDISH_INTERVAL_TYPE, "forgeFiendishIntervalType", "hour");
 	loadStringConfig(L, GLOBAL_SERVER_SAVE_TIME, "globalServerSaveTime", "06:00");
 	loadStringConfig(L, LOCATION, "location", "");
+	loadStringConfig(L, LUA_BYTECODE_CACHE_DIRECTORY, "luaBytecodeCacheDirectory", "cache/lua");
 	loadStringConfig(L, M_CONST, "memoryConst", "1<<16");
 	loadStringConfig(L, METRICS_PROMETHEUS_ADDRESS, "metricsPrometheusAddress", "localhost:9464");
 	loadStringConfig(L, OWNER_EMAIL, "ownerEmail", "");
@@ -366,9 +373,40 @@ bool ConfigManager::load() {
 
 	loaded = true;
 	lua_close(L);
+	publishSnapshot();
 	return true;
 }
 
+void ConfigManager::publishSnapshot() {
+	auto snapshot = std::make_unique<ConfigSnapshot>();
+	for (const auto &[key, value] : configs) {
+		std::visit(
+			[this, &snapshot, key](const auto &typedValue) {
+				using ValueType = std::decay_t<decltype(typedValue)>;
+				if constexpr (std::is_same_v<ValueType, std::string>) {
+					snapshot->types[key] = ConfigSnapshot::Type::String;
+					snapshot->strings[key] = &*stringPool.insert(typedValue).first;
+				} else if constexpr (std::is_same_v<ValueType, int32_t>) {
+					snapshot->types[key] = ConfigSnapshot::Type::Number;
+					snapshot->numbers[key] = typedValue;
+				} else if constexpr (std::is_same_v<ValueType, bool>) {
+					snapshot->types[key] = ConfigSnapshot::Type::Boolean;
+					snapshot->booleans[key] = typedValue;
+				} else if constexpr (std::is_same_v<ValueType, float>) {
+					snapshot->types[key] = ConfigSnapshot::Type::Float;
+					snapshot->floats[key] = typedValue;
+				}
+			},
+			value
+		);
+	}
+
+	currentSnapshot.store(snapshot.get(), std::memory_order_release);
+	// Overwriting the slot frees the snapshot published retainedSnapshots reloads ago
+	snapshots[nextSnapshot] = std::move(snapshot);
+	nextSnapshot = (nextSnapshot + 1) % retainedSnapshots;
+}
+
 bool ConfigManager::reload() {
 	const bool result = load();
 	if (transformToSHA1(getString(SERVER_MOTD, __FUNCTION__)) != g_game().getMotdHash()) {
@@ -421,35 +459,6 @@ float ConfigManager::loadFloatConfig(lua_State* L, const ConfigKey_t &key, const
 	return value;
 }
 
-const std::string &ConfigManager::getString(const ConfigKey_t &key, std::string_view context) const {
-	static const std::string dummyStr;
-	if (configs.contains(key) && std::holds_alternative<std::string>(configs.at(key))) {
-		return std::get<std::string>(configs.at(key));
-	}
-	g_logger().warn("[ConfigManager::getString] - Accessing invalid or wrong type index: {}[{}], Function: {}", magic_enum::enum_name(key), fmt::underlying(key), context);
-	return dummyStr;
-}
-
-int32_t ConfigManager::getNumber(const ConfigKey_t &key, std::string_view context) const {
-	if (configs.contains(key) && std::holds_alternative<int32_t>(configs.at(key))) {
-		return std::get<int32_t>(configs.at(key));
-	}
-	g_logger().warn("[ConfigManager::getNumber] - Accessing invalid or wrong type index: {}[{}], Function: {}", magic_enum::enum_name(key), fmt::underlying(key), context);
-	return 0;
-}
-
-bool ConfigManager::getBoolean(const ConfigKey_t &key, std::string_view context) const {
-	if (configs.contains(key) && std::holds_alternative<bool>(configs.at(key))) {
-		return std::get<bool>(configs.at(key));
-	}
-	g_logger().warn("[ConfigManager::getBoolean] - Accessing invalid or wrong type index: {}[{}], Function: {}", magic_enum::enum_name(key), fmt::underlying(key), context);
-	return false;
-}
-
-float ConfigManager::getFloat(const ConfigKey_t &key, std::string_view context) const {
-	if (configs.contains(key) && std::holds_alternative<float>(configs.at(key))) {
-		return std::get<float>(configs.at(key));
-	}
-	g_logger().warn("[ConfigManager::getFloat] - Accessing invalid or wrong type index: {}[{}], Function: {}", magic_enum::enum_name(key), fmt::underlying(key), context);
-	return 0.0f;
+void ConfigManager::warnInvalidAccess(const ConfigKey_t &key, std::string_view function, std::string_view context) const {
+	g_logger().warn("[ConfigManager::{}] - Accessing invalid or wrong type index: {}[{}], Function: {}", function, magic_enum::enum_name(key), fmt::underlying(key), context);
 }
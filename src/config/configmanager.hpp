@@ -34,13 +34,76 @@ public:
 		return configFileLua;
 	};
 
-	[[nodiscard]] const std::string &getString(const ConfigKey_t &key, std::string_view context) const;
-	[[nodiscard]] int32_t getNumber(const ConfigKey_t &key, std::string_view context) const;
-	[[nodiscard]] bool getBoolean(const ConfigKey_t &key, std::string_view context) const;
-	[[nodiscard]] float getFloat(const ConfigKey_t &key, std::string_view context) const;
+	[[nodiscard]] const std::string &getString(const ConfigKey_t &key, std::string_view context) const {
+		const auto* snapshot = currentSnapshot.load(std::memory_order_acquire);
+		if (key < ConfigSnapshot::size && snapshot->types[key] == ConfigSnapshot::Type::String) {
+			return *snapshot->strings[key];
+		}
+		warnInvalidAccess(key, __FUNCTION__, context);
+		return emptyString;
+	}
+	[[nodiscard]] int32_t getNumber(const ConfigKey_t &key, std::string_view context) const {
+		const auto* snapshot = currentSnapshot.load(std::memory_order_acquire);
+		if (key < ConfigSnapshot::size && snapshot->types[key] == ConfigSnapshot::Type::Number) {
+			return snapshot->numbers[key];
+		}
+		warnInvalidAccess(key, __FUNCTION__, context);
+		return 0;
+	}
+	[[nodiscard]] bool getBoolean(const ConfigKey_t &key, std::string_view context) const {
+		const auto* snapshot = currentSnapshot.load(std::memory_order_acquire);
+		if (key < ConfigSnapshot::size && snapshot->types[key] == ConfigSnapshot::Type::Boolean) {
+			return snapshot->booleans[key];
+		}
+		warnInvalidAccess(key, __FUNCTION__, context);
+		return false;
+	}
+	[[nodiscard]] float getFloat(const ConfigKey_t &key, std::string_view context) const {
+		const auto* snapshot = currentSnapshot.load(std::memory_order_acquire);
+		if (key < ConfigSnapshot::size && snapshot->types[key] == ConfigSnapshot::Type::Float) {
+			return snapshot->floats[key];
+		}
+		warnInvalidAccess(key, __FUNCTION__, context);
+		return 0.0f;
+	}
 
 private:
+	// Values indexed by key and split by type, reads are a single array load with no hashing
+	struct ConfigSnapshot {
+		static constexpr size_t size = magic_enum::enum_count<ConfigKey_t>();
+
+		enum class Type : uint8_t {
+			None,
+			String,
+			Number,
+			Boolean,
+			Float,
+		};
+
+		std::array<Type, size> types {};
+		std::array<int32_t, size> numbers {};
+		std::array<float, size> floats {};
+		std::bitset<size> booleans {};
+		// Points into stringPool
+		std::array<const std::string*, size> strings {};
+	};
+
+	// A reader holds a snapshot for a few loads only, four reloads within one read never happen
+	static constexpr size_t retainedSnapshots = 4;
+
+	void publishSnapshot();
+	void warnInvalidAccess(const ConfigKey_t &key, std::string_view function, std::string_view context) const;
+
+	inline static const std::string emptyString;
+	inline static const ConfigSnapshot emptySnapshot {};
+
 	phmap::flat_hash_map<ConfigKey_t, ConfigValue> configs;
+	std::atomic<const ConfigSnapshot*> currentSnapshot = &emptySnapshot;
+	// Ring of the last published snapshots, older ones are freed on publish
+	std::array<std::unique_ptr<const ConfigSnapshot>, retainedSnapshots> snapshots;
+	size_t nextSnapshot = 0;
+	// Every distinct string value ever loaded, so references returned by getString outlive any reload
+	std::set<std::string, std::less<>> stringPool;
 	std::string loadStringConfig(lua_State* L, const ConfigKey_t &key, const char* identifier, const std::string &defaultValue);
 	int32_t loadIntConfig(lua_State* L, const ConfigKey_t &key, const char* identifier, const int32_t &defaultValue);
 	bool loadBoolConfig(lua_State* L, const ConfigKey_t &key, const char* identifier, const bool &defaultValue);
@@ -21,6 +21,21 @@
 #include "items/weapons/weapons.hpp"
 #include "map/spectators.hpp"
 #include "lib/metrics/metrics.hpp"
+#include "utils/scratch_buffer.hpp"
+
+namespace {
+	// Working buffers of a cast, lent through ScratchBuffer so casts do not allocate them every time
+	struct CombatAreaTargets {
+		std::vector<std::shared_ptr<Tile>> tiles;
+		// Targets in hit order, with the index of their tile
+		std::vector<std::pair<std::shared_ptr<Creature>, size_t>> targets;
+
+		void clear() {
+			tiles.clear();
+			targets.clear();
+		}
+	};
+}
 
 int32_t Combat::getLevelFormula(std::shared_ptr<Player> player, const std::shared_ptr<Spell> wheelSpell, const CombatDamage &damage) const {
 	if (!player) {
@@ -102,7 +117,7 @@ CombatDamage Combat::getCombatDamage(std::shared_ptr<Creature> creature, std::sh
 	return damage;
 }
 
-void Combat::getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::forward_list<std::shared_ptr<Tile>> &list) {
+void Combat::getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::vector<std::shared_ptr<Tile>> &list) {
 	if (targetPos.z >= MAP_MAX_LAYERS) {
 		return;
 	}
@@ -110,7 +125,7 @@ void Combat::getCombatArea(const Position &centerPos, const Position &targetPos,
 	if (area) {
 		area->getList(centerPos, targetPos, list);
 	} else {
-		list.push_front(g_game().map.getOrCreateTile(targetPos));
+		list.emplace_back(g_game().map.getOrCreateTile(targetPos));
 	}
 }
 
@@ -1102,7 +1117,10 @@ bool Combat::doCombat(std::shared_ptr<Creature> caster, const Position &position
 }
 
 void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin, const Position &pos, const std::unique_ptr<AreaCombat> &area, const CombatParams &params, CombatFunction func, CombatDamage* data) {
-	std::forward_list<std::shared_ptr<Tile>> tileList;
+	// A cast started while another one is being applied (a death event casting a spell) gets its own buffers
+	const ScratchBuffer<CombatAreaTargets> buffer;
+	auto &tileList = buffer->tiles;
+	auto &targets = buffer->targets;
 
 	if (caster) {
 		getCombatArea(caster->getPosition(), pos, area, tileList);
@@ -1113,26 +1131,14 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 	uint32_t maxX = 0;
 	uint32_t maxY = 0;
 
-	// calculate the max viewable range
-	for (std::shared_ptr<Tile> tile : tileList) {
-		const Position &tilePos = tile->getPosition();
-
-		uint32_t diff = Position::getDistanceX(tilePos, pos);
-		if (diff > maxX) {
-			maxX = diff;
-		}
+	// Single pass: viewable range over every tile, then keep the tiles combat is possible on along with their targets
+	size_t combatTiles = 0;
+	for (size_t i = 0; i < tileList.size(); ++i) {
+		const Position &tilePos = tileList[i]->getPosition();
+		maxX = std::max<uint32_t>(maxX, Position::getDistanceX(tilePos, pos));
+		maxY = std::max<uint32_t>(maxY, Position::getDistanceY(tilePos, pos));
 
-		diff = Position::getDistanceY(tilePos, pos);
-		if (diff > maxY) {
-			maxY = diff;
-		}
-	}
-
-	const int32_t rangeX = maxX + MAP_MAX_VIEW_PORT_X;
-	const int32_t rangeY = maxY + MAP_MAX_VIEW_PORT_Y;
-
-	int affected = 0;
-	for (std::shared_ptr<Tile> tile : tileList) {
+		std::shared_ptr<Tile> tile = std::move(tileList[i]);
 		if (canDoCombat(caster, tile, params.aggressive) != RETURNVALUE_NOERROR) {
 			continue;
 		}
@@ -1151,11 +1157,20 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 				}
 
 				if (!params.aggressive || (caster != creature && Combat::canDoCombat(caster, creature, params.aggressive) == RETURNVALUE_NOERROR)) {
-					affected++;
+					targets.emplace_back(creature, combatTiles);
+					if (params.targetCasterOrTopMost) {
+						break;
+					}
 				}
 			}
 		}
+		tileList[combatTiles++] = std::move(tile);
 	}
+	tileList.resize(combatTiles);
+
+	const int32_t rangeX = maxX + MAP_MAX_VIEW_PORT_X;
+	const int32_t rangeY = maxY + MAP_MAX_VIEW_PORT_Y;
+	const int affected = static_cast<int>(targets.size());
 
 	CombatDamage tmpDamage;
 	if (data) {
@@ -1187,41 +1202,25 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 	uint8_t beamAffectedCurrent = 0;
 
 	tmpDamage.affected = affected;
-	for (std::shared_ptr<Tile> tile : tileList) {
-		if (canDoCombat(caster, tile, params.aggressive) != RETURNVALUE_NOERROR) {
-			continue;
-		}
-
-		if (CreatureVector* creatures = tile->getCreatures()) {
-			const std::shared_ptr<Creature> topCreature = tile->getTopCreature();
-			for (auto &creature : *creatures) {
-				if (params.targetCasterOrTopMost) {
-					if (caster && caster->getTile() == tile) {
-						if (creature != caster) {
-							continue;
-						}
-					} else if (creature != topCreature) {
-						continue;
-					}
-				}
-
-				if (!params.aggressive || (caster != creature && Combat::canDoCombat(caster, creature, params.aggressive) == RETURNVALUE_NOERROR)) {
-					// Wheel of destiny update beam mastery damage
-					if (casterPlayer) {
-						casterPlayer->wheel()->updateBeamMasteryDamage(tmpDamage, beamAffectedTotal, beamAffectedCurrent);
-					}
-					func(caster, creature, params, &tmpDamage);
-					if (params.targetCallback) {
-						params.targetCallback->onTargetCombat(caster, creature);
-					}
+	size_t targetIndex = 0;
+	for (size_t tileIndex = 0; tileIndex < tileList.size(); ++tileIndex) {
+		for (; targetIndex < targets.size() && targets[targetIndex].second == tileIndex; ++targetIndex) {
+			const auto &creature = targets[targetIndex].first;
+			// Hitting an earlier target can remove this one, e.g. through a death event
+			if (creature->isRemoved()) {
+				continue;
+			}
 
-					if (params.targetCasterOrTopMost) {
-						break;
-					}
-				}
+			// Wheel of destiny update beam mastery damage
+			if (casterPlayer) {
+				casterPlayer->wheel()->updateBeamMasteryDamage(tmpDamage, beamAffectedTotal, beamAffectedCurrent);
+			}
+			func(caster, creature, params, &tmpDamage);
+			if (params.targetCallback) {
+				params.targetCallback->onTargetCombat(caster, creature);
 			}
 		}
-		combatTileEffects(spectators.data(), caster, tile, params);
+		combatTileEffects(spectators.data(), caster, tileList[tileIndex], params);
 	}
 
 	// Wheel of destiny update beam mastery damage
@@ -1523,7 +1522,7 @@ void ValueCallback::getMinMaxValues(std::shared_ptr<Player> player, CombatDamage
 	// onGetPlayerMinMaxValues(...)
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[ValueCallback::getMinMaxValues - Player {} formula {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), fmt::underlying(type));
 		return;
 	}
@@ -1616,7 +1615,7 @@ void TileCallback::onTileCombat(std::shared_ptr<Creature> creature, std::shared_
 	// onTileCombat(creature, pos)
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[TileCallback::onTileCombat - Creature {} type {} on tile x: {} y: {} z: {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), fmt::underlying(type), (tile->getPosition()).getX(), (tile->getPosition()).getY(), (tile->getPosition()).getZ());
 		return;
 	}
@@ -1647,7 +1646,7 @@ void TargetCallback::onTargetCombat(std::shared_ptr<Creature> creature, std::sha
 	// onTargetCombat(creature, target)
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[TargetCallback::onTargetCombat - Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName());
 		return;
 	}
@@ -1707,7 +1706,7 @@ void ChainCallback::onChainCombat(std::shared_ptr<Creature> creature, uint8_t &m
 	// onChainCombat(creature)
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[ChainCallback::onTargetCombat - Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName());
 		return;
 	}
@@ -1749,7 +1748,7 @@ bool ChainPickerCallback::onChainCombat(std::shared_ptr<Creature> creature, std:
 	// onChainCombat(creature, target)
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[ChainPickerCallback::onTargetCombat - Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName());
 		return true;
 	}
@@ -1799,6 +1798,9 @@ bool ChainPickerCallback::onChainCombat(std::shared_ptr<Creature> creature, std:
 
 void AreaCombat::clear() {
 	std::ranges::fill(areas, nullptr);
+	for (auto &areaOffsets : offsets) {
+		areaOffsets.clear();
+	}
 }
 
 AreaCombat::AreaCombat(const AreaCombat &rhs) {
@@ -1808,10 +1810,14 @@ AreaCombat::AreaCombat(const AreaCombat &rhs) {
 			areas[i] = area->clone();
 		}
 	}
+	offsets = rhs.offsets;
 }
 
-void AreaCombat::getList(const Position &centerPos, const Position &targetPos, std::forward_list<std::shared_ptr<Tile>> &list) const {
-	const std::unique_ptr<MatrixArea> &area = getArea(centerPos, targetPos);
+void AreaCombat::compileOffsets(Direction dir) {
+	auto &areaOffsets = offsets[dir];
+	areaOffsets.clear();
+
+	const auto &area = areas[dir];
 	if (!area) {
 		return;
 	}
@@ -1819,17 +1825,24 @@ void AreaCombat::getList(const Position &centerPos, const Position &targetPos, s
 	uint32_t centerY, centerX;
 	area->getCenter(centerY, centerX);
 
-	Position tmpPos(targetPos.x - centerX, targetPos.y - centerY, targetPos.z);
-	uint32_t cols = area->getCols();
-	for (uint32_t y = 0, rows = area->getRows(); y < rows; ++y) {
-		for (uint32_t x = 0; x < cols; ++x) {
-			if (area->getValue(y, x) != 0 && g_game().isSightClear(targetPos, tmpPos, true)) {
-				list.push_front(g_game().map.getOrCreateTile(tmpPos));
+	// Bottom-up like the tile lists used to be built, so targets keep being hit in the same order
+	for (uint32_t y = area->getRows(); y-- > 0;) {
+		for (uint32_t x = area->getCols(); x-- > 0;) {
+			if (area->getValue(y, x)) {
+				areaOffsets.push_back({ static_cast<int32_t>(x) - static_cast<int32_t>(centerX), static_cast<int32_t>(y) - static_cast<int32_t>(centerY) });
 			}
-			tmpPos.x++;
 		}
-		tmpPos.x -= cols;
-		tmpPos.y++;
+	}
+}
+
+void AreaCombat::getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list) const {
+	const auto &areaOffsets = offsets[getDirection(centerPos, targetPos)];
+	list.reserve(list.size() + areaOffsets.size());
+	for (const auto &offset : areaOffsets) {
+		const Position tilePos(static_cast<uint16_t>(targetPos.x + offset.x), static_cast<uint16_t>(targetPos.y + offset.y), targetPos.z);
+		if (g_game().isSightClear(targetPos, tilePos, true)) {
+			list.emplace_back(g_game().map.getOrCreateTile(tilePos));
+		}
 	}
 }
 
@@ -1964,6 +1977,10 @@ void AreaCombat::setupArea(const std::list<uint32_t> &list, uint32_t rows) {
 	areas[DIRECTION_SOUTH] = std::move(southArea);
 	areas[DIRECTION_EAST] = std::move(eastArea);
 	areas[DIRECTION_WEST] = std::move(westArea);
+
+	for (const Direction dir : { DIRECTION_NORTH, DIRECTION_SOUTH, DIRECTION_EAST, DIRECTION_WEST }) {
+		compileOffsets(dir);
+	}
 }
 
 void AreaCombat::setupArea(int32_t length, int32_t spread) {
@@ -2062,6 +2079,10 @@ void AreaCombat::setupExtArea(const std::list<uint32_t> &list, uint32_t rows) {
 	areas[DIRECTION_SOUTHWEST] = std::move(swArea);
 	areas[DIRECTION_NORTHEAST] = std::move(neArea);
 	areas[DIRECTION_SOUTHEAST] = std::move(seArea);
+
+	for (const Direction dir : { DIRECTION_NORTHWEST, DIRECTION_SOUTHWEST, DIRECTION_NORTHEAST, DIRECTION_SOUTHEAST }) {
+		compileOffsets(dir);
+	}
 }
 
 //**********************************************************//
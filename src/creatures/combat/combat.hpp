@@ -208,6 +208,12 @@ private:
 
 class AreaCombat {
 public:
+	// Offset of an area cell from the area center
+	struct AreaOffset {
+		int32_t x;
+		int32_t y;
+	};
+
 	AreaCombat() = default;
 
 	AreaCombat(const AreaCombat &rhs);
@@ -218,7 +224,10 @@ public:
 	// non-assignable
 	AreaCombat &operator=(const AreaCombat &) = delete;
 
-	void getList(const Position &centerPos, const Position &targetPos, std::forward_list<std::shared_ptr<Tile>> &list) const;
+	void getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list) const;
+	const std::vector<AreaOffset> &getOffsets(Direction dir) const {
+		return offsets[dir];
+	}
 
 	void setupArea(const std::list<uint32_t> &list, uint32_t rows);
 	void setupArea(int32_t length, int32_t spread);
@@ -234,7 +243,9 @@ private:
 	std::unique_ptr<MatrixArea> createArea(const std::list<uint32_t> &list, uint32_t rows);
 	void copyArea(const std::unique_ptr<MatrixArea> &input, const std::unique_ptr<MatrixArea> &output, MatrixOperation_t op) const;
 
-	const std::unique_ptr<MatrixArea> &getArea(const Position &centerPos, const Position &targetPos) const {
+	void compileOffsets(Direction dir);
+
+	Direction getDirection(const Position &centerPos, const Position &targetPos) const {
 		int32_t dx = Position::getOffsetX(targetPos, centerPos);
 		int32_t dy = Position::getOffsetY(targetPos, centerPos);
 
@@ -261,10 +272,12 @@ private:
 			}
 		}
 
-		return areas[dir];
+		return dir;
 	}
 
 	std::array<std::unique_ptr<MatrixArea>, Direction::DIRECTION_LAST + 1> areas {};
+	// Set cells of each area, precompiled so a cast doesn't walk the whole matrix
+	std::array<std::vector<AreaOffset>, Direction::DIRECTION_LAST + 1> offsets {};
 	bool hasExtArea = false;
 };
 
@@ -290,7 +303,7 @@ public:
 	static void doCombatDispel(std::shared_ptr<Creature> caster, std::shared_ptr<Creature> target, const CombatParams &params);
 	static void doCombatDispel(std::shared_ptr<Creature> caster, const Position &position, const std::unique_ptr<AreaCombat> &area, const CombatParams &params);
 
-	static void getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::forward_list<std::shared_ptr<Tile>> &list);
+	static void getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::vector<std::shared_ptr<Tile>> &list);
 
 	static bool isInPvpZone(std::shared_ptr<Creature> attacker, std::shared_ptr<Creature> target);
 	static bool isProtected(std::shared_ptr<Player> attacker, std::shared_ptr<Player> target);
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "declarations.hpp"
+#include "utils/tools.hpp"
 
 class Creature;
 class Player;
@@ -45,6 +46,10 @@ public:
 		return endTime;
 	}
 	int32_t getTicks() const {
+		// Passive conditions are not executed every think, so their ticks are derived from the end time
+		if (ticks > 0 && endTime != 0 && isPassive()) {
+			return static_cast<int32_t>(std::max<int64_t>(0, endTime - OTSYS_TIME()));
+		}
 		return ticks;
 	}
 	void setTicks(int32_t newTicks);
@@ -63,6 +68,14 @@ public:
 	bool isPersistent() const;
 	bool isRemovableOnDeath() const;
 
+	/**
+	 * A passive condition does no work on ticks, it only needs to be executed
+	 * once it expires, so Creature::executeConditions skips it until then.
+	 */
+	virtual bool isPassive() const {
+		return false;
+	}
+
 protected:
 	uint8_t drainBodyStage = 0;
 	int64_t endTime;
@@ -74,6 +87,10 @@ protected:
 
 	virtual bool updateCondition(const std::shared_ptr<Condition> addCondition);
 
+	bool hasTickSound() const {
+		return tickSound != SoundEffect_t::SILENCE;
+	}
+
 private:
 	SoundEffect_t tickSound = SoundEffect_t::SILENCE;
 	SoundEffect_t addSound = SoundEffect_t::SILENCE;
@@ -96,6 +113,10 @@ public:
 	std::shared_ptr<Condition> clone() const override {
 		return std::make_shared<ConditionGeneric>(*this);
 	}
+
+	bool isPassive() const override {
+		return !hasTickSound();
+	}
 };
 
 class ConditionAttributes final : public ConditionGeneric {
@@ -184,6 +205,10 @@ public:
 		return std::make_shared<ConditionRegeneration>(*this);
 	}
 
+	bool isPassive() const override {
+		return false;
+	}
+
 	// serialization
 	void serialize(PropWriteStream &propWriteStream) override;
 	bool unserializeProp(ConditionAttr_t attr, PropStream &propStream) override;
@@ -214,6 +239,10 @@ public:
 		return std::make_shared<ConditionManaShield>(*this);
 	}
 
+	bool isPassive() const override {
+		return !hasTickSound();
+	}
+
 	// serialization
 	void serialize(PropWriteStream &propWriteStream) override;
 	bool unserializeProp(ConditionAttr_t attr, PropStream &propStream) override;
@@ -236,6 +265,10 @@ public:
 		return std::make_shared<ConditionSoul>(*this);
 	}
 
+	bool isPassive() const override {
+		return false;
+	}
+
 	// serialization
 	void serialize(PropWriteStream &propWriteStream) override;
 	bool unserializeProp(ConditionAttr_t attr, PropStream &propStream) override;
@@ -367,6 +400,10 @@ public:
 		return std::make_shared<ConditionSpeed>(*this);
 	}
 
+	bool isPassive() const override {
+		return !hasTickSound();
+	}
+
 	bool setParam(ConditionParam_t param, int32_t value) override;
 
 	void setFormulaVars(float mina, float minb, float maxa, float maxb);
@@ -401,6 +438,10 @@ public:
 		return std::make_shared<ConditionOutfit>(*this);
 	}
 
+	bool isPassive() const override {
+		return !hasTickSound();
+	}
+
 	void setOutfit(const Outfit_t &outfit);
 	void setLazyMonsterOutfit(const std::string &monsterName);
 
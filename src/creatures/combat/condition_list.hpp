@@ -0,0 +1,166 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "creatures/combat/condition.hpp"
+
+/**
+ * Per-creature condition storage.
+ *
+ * Conditions are kept in a small contiguous array, with a per-type counter and
+ * a bitmask so that type lookups can bail out without scanning, and an index
+ * sorted by (type, subId) for the lookups of a single spell cooldown, outfit or
+ * similar. The sub id is part of the identity of a condition and must not change
+ * while the condition is in the list. The list also
+ * tracks the earliest time any condition needs to be executed: passive
+ * conditions (see Condition::isPassive) only become due at expiry, so a
+ * creature carrying only long buffs is skipped entirely until then.
+ */
+class ConditionList {
+public:
+	using container = std::vector<std::shared_ptr<Condition>>;
+	using iterator = container::iterator;
+	using const_iterator = container::const_iterator;
+
+	iterator begin() {
+		return conditions.begin();
+	}
+	iterator end() {
+		return conditions.end();
+	}
+	const_iterator begin() const {
+		return conditions.begin();
+	}
+	const_iterator end() const {
+		return conditions.end();
+	}
+
+	size_t size() const {
+		return conditions.size();
+	}
+	bool empty() const {
+		return conditions.empty();
+	}
+
+	void push_back(const std::shared_ptr<Condition> &condition) {
+		conditions.push_back(condition);
+		addType(condition->getType());
+		// After the ones with the same key, so they stay in the order they were added
+		const auto key = makeKey(condition->getType(), condition->getSubId());
+		const auto position = std::ranges::upper_bound(indexKeys, key) - indexKeys.begin();
+		indexKeys.insert(indexKeys.begin() + position, key);
+		indexed.insert(indexed.begin() + position, condition);
+		invalidateDueTime();
+	}
+
+	iterator erase(const_iterator it) {
+		removeType((*it)->getType());
+		removeFromIndex(*it);
+		return conditions.erase(it);
+	}
+
+	bool erase(const std::shared_ptr<Condition> &condition) {
+		const auto it = std::ranges::find(conditions, condition);
+		if (it == conditions.end()) {
+			return false;
+		}
+
+		erase(it);
+		return true;
+	}
+
+	bool hasType(ConditionType_t type) const {
+		return (typeMask & (uint64_t(1) << type)) != 0;
+	}
+
+	// Conditions of the type and sub id, in the order they were added
+	std::span<const std::shared_ptr<Condition>> find(ConditionType_t type, uint32_t subId) const {
+		const auto [first, last] = std::ranges::equal_range(indexKeys, makeKey(type, subId));
+		return { indexed.data() + (first - indexKeys.begin()), static_cast<size_t>(last - first) };
+	}
+
+	/**
+	 * Forces the next executeConditions to walk every condition, must be
+	 * called whenever a condition is modified from outside (e.g. setTicks).
+	 */
+	void invalidateDueTime() const {
+		nextDueTime = 0;
+	}
+
+	bool isDue(int64_t timeNow) const {
+		return timeNow >= nextDueTime;
+	}
+
+	/**
+	 * Fills dueConditions with every condition that has to be executed now,
+	 * and reschedules the list for the earliest expiry of the skipped ones.
+	 * Conditions added while the due ones run invalidate the schedule again.
+	 */
+	void collectDue(int64_t timeNow, std::vector<std::shared_ptr<Condition>> &dueConditions) const {
+		nextDueTime = std::numeric_limits<int64_t>::max();
+		for (const auto &condition : conditions) {
+			if (!condition->isPassive()) {
+				nextDueTime = timeNow;
+				dueConditions.push_back(condition);
+				continue;
+			}
+
+			const int64_t endTime = condition->getEndTime();
+			if (endTime < timeNow) {
+				dueConditions.push_back(condition);
+			} else if (endTime != std::numeric_limits<int64_t>::max()) {
+				// Condition::executeCondition only expires strictly after endTime
+				nextDueTime = std::min(nextDueTime, endTime + 1);
+			}
+		}
+	}
+
+private:
+	static uint64_t makeKey(ConditionType_t type, uint32_t subId) {
+		return (static_cast<uint64_t>(type) << 32) | subId;
+	}
+
+	void removeFromIndex(const std::shared_ptr<Condition> &condition) {
+		const auto [first, last] = std::ranges::equal_range(indexKeys, makeKey(condition->getType(), condition->getSubId()));
+		const auto rangeBegin = indexed.begin() + (first - indexKeys.begin());
+		const auto rangeEnd = indexed.begin() + (last - indexKeys.begin());
+		auto it = std::find(rangeBegin, rangeEnd, condition);
+		if (it == rangeEnd) {
+			// Only if the sub id was changed after adding it
+			it = std::ranges::find(indexed, condition);
+		}
+		if (it != indexed.end()) {
+			indexKeys.erase(indexKeys.begin() + (it - indexed.begin()));
+			indexed.erase(it);
+		}
+	}
+
+	void addType(ConditionType_t type) {
+		if (typeCount[type]++ == 0) {
+			typeMask |= (uint64_t(1) << type);
+		}
+	}
+
+	void removeType(ConditionType_t type) {
+		if (--typeCount[type] == 0) {
+			typeMask &= ~(uint64_t(1) << type);
+		}
+	}
+
+	static_assert(CONDITION_COUNT <= 64, "ConditionList type mask supports up to 64 condition types");
+
+	container conditions;
+	// Sorted by (type, subId), indexed[i] is the condition of indexKeys[i]
+	std::vector<uint64_t> indexKeys;
+	container indexed;
+	std::array<uint16_t, CONDITION_COUNT> typeCount = {};
+	uint64_t typeMask = 0;
+	mutable int64_t nextDueTime = 0;
+};
@@ -361,7 +361,7 @@ bool CombatSpell::executeCastSpell(std::shared_ptr<Creature> creature, const Lua
 	// onCastSpell(creature, var)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CombatSpell::executeCastSpell - Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName());
 		return false;
 	}
@@ -912,7 +912,7 @@ bool InstantSpell::executeCastSpell(std::shared_ptr<Creature> creature, const Lu
 	// onCastSpell(creature, var)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[InstantSpell::executeCastSpell - Creature {} words {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), getWords());
 		return false;
 	}
@@ -1057,7 +1057,7 @@ bool RuneSpell::executeCastSpell(std::shared_ptr<Creature> creature, const LuaVa
 	// onCastSpell(creature, var, isHotkey)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[RuneSpell::executeCastSpell - Creature {} runeId {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), getRuneItemId());
 		return false;
 	}
@@ -1381,15 +1381,22 @@ bool Creature::addCombatCondition(std::shared_ptr<Condition> condition, bool att
 
 void Creature::removeCondition(ConditionType_t type) {
 	metrics::method_latency measure(__METHOD_NAME__);
-	auto it = conditions.begin(), end = conditions.end();
-	while (it != end) {
-		std::shared_ptr<Condition> condition = *it;
-		if (condition->getType() != type) {
-			++it;
-			continue;
+	if (!conditions.hasType(type)) {
+		return;
+	}
+
+	// Ending a condition may change the list, so collect the matches first
+	std::vector<std::shared_ptr<Condition>> removeConditions;
+	for (const auto &condition : conditions) {
+		if (condition->getType() == type) {
+			removeConditions.push_back(condition);
 		}
+	}
 
-		it = conditions.erase(it);
+	for (const auto &condition : removeConditions) {
+		if (!conditions.erase(condition)) {
+			continue;
+		}
 
 		condition->endCondition(getCreature());
 
@@ -1399,14 +1406,18 @@ void Creature::removeCondition(ConditionType_t type) {
 
 void Creature::removeCondition(ConditionType_t conditionType, ConditionId_t conditionId, bool force /* = false*/) {
 	metrics::method_latency measure(__METHOD_NAME__);
-	auto it = conditions.begin(), end = conditions.end();
-	while (it != end) {
-		std::shared_ptr<Condition> condition = *it;
-		if (condition->getType() != conditionType || condition->getId() != conditionId) {
-			++it;
-			continue;
+	if (!conditions.hasType(conditionType)) {
+		return;
+	}
+
+	std::vector<std::shared_ptr<Condition>> removeConditions;
+	for (const auto &condition : conditions) {
+		if (condition->getType() == conditionType && condition->getId() == conditionId) {
+			removeConditions.push_back(condition);
 		}
+	}
 
+	for (const auto &condition : removeConditions) {
 		if (!force && conditionType == CONDITION_PARALYZE) {
 			int32_t walkDelay = getWalkDelay();
 			if (walkDelay > 0) {
@@ -1417,7 +1428,9 @@ void Creature::removeCondition(ConditionType_t conditionType, ConditionId_t cond
 			}
 		}
 
-		it = conditions.erase(it);
+		if (!conditions.erase(condition)) {
+			continue;
+		}
 
 		condition->endCondition(getCreature());
 
@@ -1426,6 +1439,10 @@ void Creature::removeCondition(ConditionType_t conditionType, ConditionId_t cond
 }
 
 void Creature::removeCombatCondition(ConditionType_t type) {
+	if (!conditions.hasType(type)) {
+		return;
+	}
+
 	std::vector<std::shared_ptr<Condition>> removeConditions;
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
@@ -1439,18 +1456,21 @@ void Creature::removeCombatCondition(ConditionType_t type) {
 }
 
 void Creature::removeCondition(std::shared_ptr<Condition> condition) {
-	auto it = std::find(conditions.begin(), conditions.end(), condition);
-	if (it == conditions.end()) {
+	if (!conditions.erase(condition)) {
 		return;
 	}
 
-	conditions.erase(it);
-
 	condition->endCondition(getCreature());
 	onEndCondition(condition->getType());
 }
 
 std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type) const {
+	if (!conditions.hasType(type)) {
+		return nullptr;
+	}
+
+	// The caller may change the condition ticks, so the execution schedule can't be trusted anymore
+	conditions.invalidateDueTime();
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
 			return condition;
@@ -1461,8 +1481,13 @@ std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type) const {
 
 std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type, ConditionId_t conditionId, uint32_t subId /* = 0*/) const {
 	metrics::method_latency measure(__METHOD_NAME__);
-	for (const auto &condition : conditions) {
-		if (condition->getType() == type && condition->getId() == conditionId && condition->getSubId() == subId) {
+	if (!conditions.hasType(type)) {
+		return nullptr;
+	}
+
+	conditions.invalidateDueTime();
+	for (const auto &condition : conditions.find(type, subId)) {
+		if (condition->getId() == conditionId) {
 			return condition;
 		}
 	}
@@ -1471,6 +1496,11 @@ std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type, Conditio
 
 std::vector<std::shared_ptr<Condition>> Creature::getConditionsByType(ConditionType_t type) const {
 	std::vector<std::shared_ptr<Condition>> conditionsVec;
+	if (!conditions.hasType(type)) {
+		return conditionsVec;
+	}
+
+	conditions.invalidateDueTime();
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
 			conditionsVec.push_back(condition);
@@ -1481,35 +1511,37 @@ std::vector<std::shared_ptr<Condition>> Creature::getConditionsByType(ConditionT
 
 void Creature::executeConditions(uint32_t interval) {
 	metrics::method_latency measure(__METHOD_NAME__);
-	auto it = conditions.begin(), end = conditions.end();
-	while (it != end) {
-		std::shared_ptr<Condition> condition = *it;
-		if (!condition->executeCondition(getCreature(), interval)) {
-			ConditionType_t type = condition->getType();
-
-			it = conditions.erase(it);
+	const int64_t timeNow = OTSYS_TIME();
+	if (!conditions.isDue(timeNow)) {
+		return;
+	}
 
-			condition->endCondition(getCreature());
+	// Executing a condition may add or remove others, so run over a snapshot of the due ones
+	std::vector<std::shared_ptr<Condition>> dueConditions;
+	conditions.collectDue(timeNow, dueConditions);
+	for (const auto &condition : dueConditions) {
+		if (condition->executeCondition(getCreature(), interval)) {
+			continue;
+		}
 
-			onEndCondition(type);
-		} else {
-			++it;
+		if (!conditions.erase(condition)) {
+			continue;
 		}
+
+		condition->endCondition(getCreature());
+
+		onEndCondition(condition->getType());
 	}
 }
 
 bool Creature::hasCondition(ConditionType_t type, uint32_t subId /* = 0*/) const {
 	metrics::method_latency measure(__METHOD_NAME__);
-	if (isSuppress(type, false)) {
+	if (!conditions.hasType(type) || isSuppress(type, false)) {
 		return false;
 	}
 
 	int64_t timeNow = OTSYS_TIME();
-	for (const auto &condition : conditions) {
-		if (condition->getType() != type || condition->getSubId() != subId) {
-			continue;
-		}
-
+	for (const auto &condition : conditions.find(type, subId)) {
 		if (condition->getEndTime() >= timeNow || condition->getTicks() == -1) {
 			return true;
 		}
@@ -1726,10 +1758,7 @@ bool FrozenPathingConditionCall::operator()(const Position &startPos, const Posi
 }
 
 bool Creature::isInvisible() const {
-	return std::find_if(conditions.begin(), conditions.end(), [](const std::shared_ptr<Condition> condition) {
-			   return condition->getType() == CONDITION_INVISIBLE;
-		   })
-		!= conditions.end();
+	return conditions.hasType(CONDITION_INVISIBLE);
 }
 
 bool Creature::getPathTo(const Position &targetPos, stdext::arraylist<Direction> &dirList, const FindPathParams &fpp) {
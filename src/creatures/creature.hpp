@@ -11,13 +11,13 @@
 
 #include "declarations.hpp"
 #include "creatures/combat/condition.hpp"
+#include "creatures/combat/condition_list.hpp"
 #include "utils/utils_definitions.hpp"
 #include "lua/creature/creatureevent.hpp"
 #include "map/map.hpp"
 #include "game/movement/position.hpp"
 #include "items/tile.hpp"
 
-using ConditionList = std::list<std::shared_ptr<Condition>>;
 using CreatureEventList = std::list<std::shared_ptr<CreatureEvent>>;
 
 class Map;
@@ -774,6 +774,8 @@ protected:
 	bool isUpdatingPath = false;
 	bool creatureCheck = false;
 	bool inCheckCreaturesVector = false;
+	// Left out of the creature checks while no player is around, see Game::checkCreatures
+	bool hibernating = false;
 	bool skillLoss = true;
 	bool lootDrop = true;
 	bool cancelNextWalk = false;
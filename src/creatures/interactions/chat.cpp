@@ -145,7 +145,7 @@ bool ChatChannel::executeCanJoinEvent(const std::shared_ptr<Player> &player) {
 	LuaScriptInterface* scriptInterface = g_chat().getScriptInterface();
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[CanJoinChannelEvent::execute - Player {}, on channel {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return false;
 	}
@@ -171,7 +171,7 @@ bool ChatChannel::executeOnJoinEvent(const std::shared_ptr<Player> &player) {
 	LuaScriptInterface* scriptInterface = g_chat().getScriptInterface();
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[OnJoinChannelEvent::execute - Player {}, on channel {}] "
-						 "Call stack overflow. Too many lua script calls being nested",
+						 "Could not reserve a script environment",
 						 player->getName(), getName());
 		return false;
 	}
@@ -197,7 +197,7 @@ bool ChatChannel::executeOnLeaveEvent(const std::shared_ptr<Player> &player) {
 	LuaScriptInterface* scriptInterface = g_chat().getScriptInterface();
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[OnLeaveChannelEvent::execute - Player {}, on channel {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return false;
 	}
@@ -223,7 +223,7 @@ bool ChatChannel::executeOnSpeakEvent(const std::shared_ptr<Player> &player, Spe
 	LuaScriptInterface* scriptInterface = g_chat().getScriptInterface();
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("[OnSpeakChannelEvent::execute - Player {}, type {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), fmt::underlying(type));
 		return false;
 	}
@@ -0,0 +1,124 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "creatures/monsters/loot_table.hpp"
+
+#include "game/game.hpp"
+#include "items/containers/container.hpp"
+
+void LootTable::add(const LootBlock &lootBlock) {
+	const ItemType &itemType = Item::items[lootBlock.id];
+
+	Entry entry;
+	entry.itemId = lootBlock.id;
+	entry.chance = lootBlock.chance;
+	entry.minCount = std::max<uint32_t>(1, lootBlock.countmin);
+	entry.maxCount = std::max<uint32_t>(entry.minCount, lootBlock.countmax);
+	entry.charges = itemType.charges;
+	entry.stackSize = std::max<uint8_t>(1, itemType.stackSize);
+	entry.stackable = itemType.stackable;
+	entry.fluidContainer = itemType.isFluidContainer();
+	entry.creatureProduct = itemType.type == ITEM_TYPE_CREATUREPRODUCT;
+	entry.unique = lootBlock.unique;
+	entry.subType = lootBlock.subType;
+	entry.actionId = lootBlock.actionId;
+	entry.text = lootBlock.text;
+	entries.emplace_back(std::move(entry));
+}
+
+void LootTable::roll(double multiplier, uint32_t creatureProductChance, std::vector<Drop> &drops) const {
+	const double scale = 100.0 / std::max(1.0, multiplier);
+	const size_t firstDrop = drops.size();
+	for (uint32_t index = 0; index < entries.size(); ++index) {
+		const Entry &entry = entries[index];
+		const auto merged = std::find_if(drops.begin() + firstDrop, drops.end(), [this, &entry](const Drop &drop) {
+			return entries[drop.entry].itemId == entry.itemId;
+		});
+		// A unique item that already dropped doesn't roll again
+		if (merged != drops.end() && entries[merged->entry].unique && merged->count > 0) {
+			continue;
+		}
+
+		uint32_t chance = entry.chance;
+		if (entry.creatureProduct && creatureProductChance != 100) {
+			chance = static_cast<uint32_t>(std::ceil(chance * creatureProductChance / 100.0));
+		}
+
+		if (uniform_random(0, static_cast<int32_t>(MAX_LOOTCHANCE)) * scale >= chance) {
+			continue;
+		}
+
+		uint32_t count = 1;
+		if (entry.charges > 0) {
+			count = entry.charges;
+		} else if (entry.stackable) {
+			count = static_cast<uint32_t>(uniform_random(static_cast<int32_t>(entry.minCount), static_cast<int32_t>(entry.maxCount)));
+		}
+
+		if (merged != drops.end()) {
+			merged->entry = index;
+			merged->count += count;
+		} else {
+			drops.push_back({ index, count });
+		}
+	}
+}
+
+uint32_t LootTable::addToContainer(const std::shared_ptr<Container> &container, const std::vector<Drop> &drops) const {
+	uint32_t creatureProducts = 0;
+	const auto addItem = [&container](const std::shared_ptr<Item> &item) {
+		if (!item || g_game().internalAddItem(container, item, INDEX_WHEREEVER, FLAG_NOLIMIT) != RETURNVALUE_NOERROR) {
+			g_logger().warn("[LootTable::addToContainer] - Failed to add item {} to corpse {}", item ? item->getID() : 0, container->getID());
+			return false;
+		}
+		return true;
+	};
+
+	for (const auto &[entryIndex, count] : drops) {
+		const Entry &entry = entries[entryIndex];
+		if (entry.creatureProduct) {
+			++creatureProducts;
+		}
+
+		if (entry.stackable) {
+			for (uint32_t remaining = count; remaining > 0;) {
+				const auto stackCount = std::min<uint32_t>(remaining, entry.stackSize);
+				if (!addItem(Item::CreateItem(entry.itemId, stackCount))) {
+					break;
+				}
+				remaining -= stackCount;
+			}
+		} else if (entry.charges != 0) {
+			addItem(Item::CreateItem(entry.itemId, count));
+		} else {
+			uint16_t subType = 1;
+			if (entry.subType != -1) {
+				subType = static_cast<uint16_t>(entry.subType);
+			} else if (entry.fluidContainer) {
+				subType = 0;
+			}
+
+			for (uint32_t i = 0; i < count; ++i) {
+				const auto item = Item::CreateItem(entry.itemId, subType);
+				if (item && entry.actionId != -1) {
+					item->setAttribute(ItemAttribute_t::ACTIONID, entry.actionId);
+				}
+				if (item && !entry.text.empty()) {
+					item->setAttribute(ItemAttribute_t::TEXT, entry.text);
+				}
+				if (!addItem(item)) {
+					break;
+				}
+			}
+		}
+	}
+	return creatureProducts;
+}
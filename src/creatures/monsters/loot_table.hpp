@@ -0,0 +1,66 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "declarations.hpp"
+
+class Container;
+
+// Loot of a monster type flattened at load time, with everything a roll needs from the item types resolved up front.
+// Rolls follow MonsterType:generateLootRoll, each entry is rolled on its own against its chance.
+class LootTable {
+public:
+	struct Entry {
+		uint16_t itemId = 0;
+		uint32_t chance = 0;
+		uint32_t minCount = 1;
+		uint32_t maxCount = 1;
+		uint16_t charges = 0;
+		uint8_t stackSize = 1;
+		bool stackable = false;
+		bool fluidContainer = false;
+		bool creatureProduct = false;
+		bool unique = false;
+		int32_t subType = -1;
+		int32_t actionId = -1;
+		std::string text;
+	};
+
+	struct Drop {
+		// Entry holding the properties of the dropped item, the last one rolled for its item id
+		uint32_t entry;
+		uint32_t count;
+	};
+
+	void add(const LootBlock &lootBlock);
+
+	const std::vector<Entry> &getEntries() const {
+		return entries;
+	}
+	bool empty() const {
+		return entries.empty();
+	}
+
+	/**
+	 * @brief Rolls every entry once and merges the drops by item id.
+	 * @param multiplier Loot rate in percent, rateLoot * schedule loot rate * factor like getLootRandom.
+	 * @param creatureProductChance Percent applied to the chance of creature products, above 100 with the gut charm.
+	 */
+	void roll(double multiplier, uint32_t creatureProductChance, std::vector<Drop> &drops) const;
+
+	/**
+	 * @brief Creates the dropped items into the container, as Container:addLoot does.
+	 * @return Number of dropped creature products.
+	 */
+	uint32_t addToContainer(const std::shared_ptr<Container> &container, const std::vector<Drop> &drops) const;
+
+private:
+	std::vector<Entry> entries;
+};
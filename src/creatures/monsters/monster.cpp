@@ -17,6 +17,8 @@
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
 #include "map/spectators.hpp"
+#include "creatures/monsters/target_acquisition.hpp"
+#include "utils/scratch_buffer.hpp"
 
 int32_t Monster::despawnRange;
 int32_t Monster::despawnRadius;
@@ -107,7 +109,7 @@ void Monster::onCreatureAppear(std::shared_ptr<Creature> creature, bool isLogin)
 		LuaScriptInterface* scriptInterface = mType->info.scriptInterface;
 		if (!scriptInterface->reserveScriptEnv()) {
 			g_logger().error("[Monster::onCreatureAppear - Monster {} creature {}] "
-							 "Call stack overflow. Too many lua script calls being nested.",
+							 "Could not reserve a script environment.",
 							 getName(), creature->getName());
 			return;
 		}
@@ -145,7 +147,7 @@ void Monster::onRemoveCreature(std::shared_ptr<Creature> creature, bool isLogout
 		LuaScriptInterface* scriptInterface = mType->info.scriptInterface;
 		if (!scriptInterface->reserveScriptEnv()) {
 			g_logger().error("[Monster::onCreatureDisappear - Monster {} creature {}] "
-							 "Call stack overflow. Too many lua script calls being nested.",
+							 "Could not reserve a script environment.",
 							 getName(), creature->getName());
 			return;
 		}
@@ -186,7 +188,7 @@ void Monster::onCreatureMove(const std::shared_ptr<Creature> &creature, const st
 		LuaScriptInterface* scriptInterface = mType->info.scriptInterface;
 		if (!scriptInterface->reserveScriptEnv()) {
 			g_logger().error("[Monster::onCreatureMove - Monster {} creature {}] "
-							 "Call stack overflow. Too many lua script calls being nested.",
+							 "Could not reserve a script environment.",
 							 getName(), creature->getName());
 			return;
 		}
@@ -212,7 +214,13 @@ void Monster::onCreatureMove(const std::shared_ptr<Creature> &creature, const st
 	}
 
 	if (creature.get() == this) {
-		updateTargetList();
+		// Without targets the monster must notice the creatures it walks into right away, otherwise the refresh waits
+		// for the next think, where it is shared with every monster of the sector
+		if (targetList.empty()) {
+			updateTargetList();
+		} else {
+			targetListDirty = true;
+		}
 		updateIdleStatus();
 	} else {
 		bool canSeeNewPos = canSee(newPos);
@@ -259,8 +267,8 @@ void Monster::onCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses typ
 		// onCreatureSay(self, creature, type, message)
 		LuaScriptInterface* scriptInterface = mType->info.scriptInterface;
 		if (!scriptInterface->reserveScriptEnv()) {
-			g_logger().error("Monster {} creature {}] Call stack overflow. Too many lua "
-							 "script calls being nested.",
+			g_logger().error("Monster {} creature {}] Could not reserve a script "
+							 "environment.",
 							 getName(), creature->getName());
 			return;
 		}
@@ -357,15 +365,17 @@ void Monster::updateTargetList() {
 		return !target || target->getHealth() <= 0 || !canSee(target->getPosition());
 	});
 
-	for (const auto &spectator : Spectators().find<Creature>(position, true)) {
-		if (spectator.get() != this && canSee(spectator->getPosition())) {
-			onCreatureFound(spectator);
+	targetListDirty = false;
+	for (const auto candidate : TargetAcquisition::getCandidates(position)) {
+		if (candidate != this && canSee(candidate->getPosition())) {
+			onCreatureFound(candidate->getCreature());
 		}
 	}
 }
 
 void Monster::clearTargetList() {
 	targetList.clear();
+	targetListDirty = false;
 }
 
 void Monster::clearFriendList() {
@@ -468,7 +478,9 @@ bool Monster::searchTarget(TargetSearchType_t searchType /*= TARGETSEARCH_DEFAUL
 		}
 	}
 
-	std::vector<std::shared_ptr<Creature>> resultList;
+	// A search started while another one is selecting its target (a script reacting to it) gets its own list
+	const ScratchBuffer<std::vector<std::shared_ptr<Creature>>> buffer;
+	auto &resultList = *buffer;
 	const Position &myPos = getPosition();
 
 	for (const auto &cref : targetList) {
@@ -735,12 +747,16 @@ void Monster::onEndCondition(ConditionType_t type) {
 void Monster::onThink(uint32_t interval) {
 	Creature::onThink(interval);
 
+	if (targetListDirty) {
+		updateTargetList();
+	}
+
 	if (mType->info.thinkEvent != -1) {
 		// onThink(self, interval)
 		LuaScriptInterface* scriptInterface = mType->info.scriptInterface;
 		if (!scriptInterface->reserveScriptEnv()) {
-			g_logger().error("Monster {} Call stack overflow. Too many lua script calls "
-							 "being nested.",
+			g_logger().error("Monster {} Could not reserve a script "
+							 "environment.",
 							 getName());
 			return;
 		}
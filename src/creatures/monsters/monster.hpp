@@ -391,6 +391,8 @@ private:
 
 	bool isWalkingBack = false;
 	bool isIdle = true;
+	// Moved with targets around, the list is refreshed on the next think together with the monsters nearby
+	bool targetListDirty = false;
 	bool extraMeleeAttack = false;
 	bool randomStepping = false;
 	bool ignoreFieldDamage = false;
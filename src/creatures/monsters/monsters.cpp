@@ -28,6 +28,7 @@ void MonsterType::loadLoot(const std::shared_ptr<MonsterType> monsterType, LootB
 	} else {
 		monsterType->info.lootItems.push_back(lootBlock);
 	}
+	monsterType->info.lootTable.add(lootBlock);
 }
 
 bool MonsterType::canSpawn(const Position &pos) {
@@ -11,6 +11,7 @@
 
 #include "io/io_bosstiary.hpp"
 #include "creatures/creature.hpp"
+#include "creatures/monsters/loot_table.hpp"
 #include "declarations.hpp"
 
 class Loot {
@@ -66,6 +67,8 @@ class MonsterType {
 		std::vector<voiceBlock_t> voiceVector;
 
 		std::vector<LootBlock> lootItems;
+		// lootItems precompiled for native rolls
+		LootTable lootTable;
 		// We need to keep the order of scripts, so we use a set isntead of an unordered_set
 		std::set<std::string> scripts;
 		std::vector<spellBlock_t> attackSpells;
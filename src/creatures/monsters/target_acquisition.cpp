@@ -0,0 +1,104 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "creatures/monsters/target_acquisition.hpp"
+
+#include "game/game.hpp"
+
+// Leaf aligned area and floors Spectators::find scans around the sector center with multifloor
+struct TargetAcquisition::SectorArea {
+	uint16_t startX;
+	uint16_t startY;
+	uint16_t endX;
+	uint16_t endY;
+	uint8_t minZ;
+	uint8_t maxZ;
+};
+
+std::array<TargetAcquisition::Sector, TargetAcquisition::SECTOR_SLOTS> TargetAcquisition::sectors;
+
+TargetAcquisition::SectorArea TargetAcquisition::getSectorArea(const Position &center) {
+	int32_t minZ = 0;
+	int32_t maxZ = MAP_INIT_SURFACE_LAYER;
+	if (center.z > MAP_INIT_SURFACE_LAYER) {
+		minZ = std::max<int32_t>(center.z - MAP_LAYER_VIEW_LIMIT, 0);
+		maxZ = std::min<int32_t>(center.z + MAP_LAYER_VIEW_LIMIT, MAP_MAX_LAYERS - 1);
+	} else if (center.z >= MAP_INIT_SURFACE_LAYER - 1) {
+		maxZ = center.z + MAP_LAYER_VIEW_LIMIT;
+	}
+
+	const auto clamp = [](int32_t value) {
+		return static_cast<uint16_t>(std::clamp<int32_t>(value, 0, 0xFFFF));
+	};
+	const uint16_t x1 = clamp(center.x - SECTOR_RANGE_X + center.z - maxZ);
+	const uint16_t y1 = clamp(center.y - SECTOR_RANGE_Y + center.z - maxZ);
+	const uint16_t x2 = clamp(center.x + SECTOR_RANGE_X + center.z - minZ);
+	const uint16_t y2 = clamp(center.y + SECTOR_RANGE_Y + center.z - minZ);
+	return SectorArea {
+		.startX = static_cast<uint16_t>(x1 - x1 % FLOOR_SIZE),
+		.startY = static_cast<uint16_t>(y1 - y1 % FLOOR_SIZE),
+		.endX = static_cast<uint16_t>(x2 - x2 % FLOOR_SIZE),
+		.endY = static_cast<uint16_t>(y2 - y2 % FLOOR_SIZE),
+		.minZ = static_cast<uint8_t>(minZ),
+		.maxZ = static_cast<uint8_t>(maxZ),
+	};
+}
+
+template <typename F>
+void TargetAcquisition::forEachLeaf(const SectorArea &area, F &&f) {
+	// Same walk over the east and south links as Spectators::find
+	auto &map = g_game().map;
+	const QTreeLeafNode* leafS = map.getQTNode(area.startX, area.startY);
+	for (uint32_t ny = area.startY; ny <= area.endY; ny += FLOOR_SIZE) {
+		const QTreeLeafNode* leafE = leafS;
+		for (uint32_t nx = area.startX; nx <= area.endX; nx += FLOOR_SIZE) {
+			if (leafE) {
+				f(*leafE);
+				leafE = leafE->leafE;
+			} else {
+				leafE = map.getQTNode(static_cast<uint16_t>(nx + FLOOR_SIZE), static_cast<uint16_t>(ny));
+			}
+		}
+
+		if (leafS) {
+			leafS = leafS->leafS;
+		} else {
+			leafS = map.getQTNode(area.startX, static_cast<uint16_t>(ny + FLOOR_SIZE));
+		}
+	}
+}
+
+const TargetAcquisition::Candidates &TargetAcquisition::getCandidates(const Position &position) {
+	const uint64_t key = getSectorKey(position);
+	auto &sector = sectors[(key * 0x9E3779B97F4A7C15ull >> 56) % SECTOR_SLOTS];
+
+	const auto area = getSectorArea(getSectorCenter(position));
+	uint64_t occupancy = 0;
+	forEachLeaf(area, [&occupancy](const QTreeLeafNode &leaf) {
+		occupancy += leaf.getCreatureRevision();
+	});
+	if (sector.key == key && sector.occupancy == occupancy) {
+		return sector.candidates;
+	}
+
+	sector.key = key;
+	sector.occupancy = occupancy;
+	sector.candidates.clear();
+	forEachLeaf(area, [&sector, &area](const QTreeLeafNode &leaf) {
+		for (const auto &creature : leaf.creature_list) {
+			const uint8_t z = creature->getPosition().z;
+			if (z >= area.minZ && z <= area.maxZ) {
+				sector.candidates.push_back(creature.get());
+			}
+		}
+	});
+	return sector.candidates;
+}
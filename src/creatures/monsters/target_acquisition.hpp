@@ -0,0 +1,61 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "game/movement/position.hpp"
+#include "map/map_const.hpp"
+
+class Creature;
+
+// Creatures a monster could find as target or friend, gathered once for every monster standing in the same sector.
+// Monsters of a spawn share the query instead of repeating it for each of their own positions.
+// A list holds every creature of the map leaves the sector view touches, so steps inside a leaf keep it valid; it
+// is kept until one of those leaves changes its creature revision. The raw pointers it holds are therefore alive as
+// long as it is returned. Callers must not move creatures while going through it.
+class TargetAcquisition {
+public:
+	static constexpr int32_t SECTOR_SIZE = FLOOR_SIZE * 2;
+	static constexpr int32_t SECTOR_RANGE_X = MAP_MAX_VIEW_PORT_X + SECTOR_SIZE / 2;
+	static constexpr int32_t SECTOR_RANGE_Y = MAP_MAX_VIEW_PORT_Y + SECTOR_SIZE / 2;
+
+	using Candidates = std::vector<Creature*>;
+
+	// Superset of Spectators().find<Creature>(position, true) for any position of the sector, callers filter by sight
+	static const Candidates &getCandidates(const Position &position);
+
+	static constexpr uint64_t getSectorKey(const Position &position) {
+		return static_cast<uint64_t>(position.x / SECTOR_SIZE) | (static_cast<uint64_t>(position.y / SECTOR_SIZE) << 16) | (static_cast<uint64_t>(position.z) << 32);
+	}
+
+	static constexpr Position getSectorCenter(const Position &position) {
+		return Position(
+			static_cast<uint16_t>(position.x - position.x % SECTOR_SIZE + SECTOR_SIZE / 2),
+			static_cast<uint16_t>(position.y - position.y % SECTOR_SIZE + SECTOR_SIZE / 2),
+			position.z
+		);
+	}
+
+private:
+	struct SectorArea;
+	static SectorArea getSectorArea(const Position &center);
+	template <typename F>
+	static void forEachLeaf(const SectorArea &area, F &&f);
+
+	struct Sector {
+		uint64_t key = std::numeric_limits<uint64_t>::max();
+		// Sum of the creature revisions of the covered leaves, revisions only grow so any change moves it
+		uint64_t occupancy = 0;
+		Candidates candidates;
+	};
+
+	// Direct mapped, a sector only evicts another one hashing to the same slot, keeping its buffer
+	static constexpr size_t SECTOR_SLOTS = 256;
+	static std::array<Sector, SECTOR_SLOTS> sectors;
+};
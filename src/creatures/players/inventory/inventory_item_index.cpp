@@ -0,0 +1,127 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "creatures/players/inventory/inventory_item_index.hpp"
+
+#include "items/containers/container.hpp"
+
+namespace {
+	template <typename Map>
+	void subtractCount(Map &counts, typename Map::key_type key, uint32_t count) {
+		const auto it = counts.find(key);
+		if (it == counts.end()) {
+			return;
+		}
+
+		// Entries never go below zero, a missing count shows up in the consistency check instead
+		if (it->second <= count) {
+			counts.erase(it);
+		} else {
+			it->second -= count;
+		}
+	}
+}
+
+template <typename Visitor>
+void InventoryItemIndex::forEachContained(const std::shared_ptr<Item> &item, Visitor visitor) {
+	const auto &root = item->getContainer();
+	if (!root) {
+		return;
+	}
+
+	// Same order-independent content as ContainerIterator, without its per step list allocations
+	std::vector<std::shared_ptr<Container>> pending { root };
+	while (!pending.empty()) {
+		const auto container = std::move(pending.back());
+		pending.pop_back();
+		for (const auto &contained : container->getItemList()) {
+			visitor(contained);
+			if (const auto &subContainer = contained->getContainer()) {
+				pending.push_back(subContainer);
+			}
+		}
+	}
+}
+
+void InventoryItemIndex::add(const std::shared_ptr<Item> &item, bool equipped) {
+	addItem(item, equipped);
+	forEachContained(item, [this](const std::shared_ptr<Item> &contained) {
+		addItem(contained, false);
+	});
+}
+
+void InventoryItemIndex::remove(const std::shared_ptr<Item> &item, bool equipped) {
+	removeItem(item, equipped);
+	forEachContained(item, [this](const std::shared_ptr<Item> &contained) {
+		removeItem(contained, false);
+	});
+}
+
+void InventoryItemIndex::replace(uint16_t oldId, uint8_t oldTier, uint32_t oldCount, const std::shared_ptr<Item> &item, bool equipped) {
+	removeEntry(oldId, oldTier, oldCount, equipped);
+	addItem(item, equipped);
+}
+
+void InventoryItemIndex::rebuild(std::span<const std::shared_ptr<Item>> slots) {
+	itemCounts.clear();
+	tierCounts.clear();
+	saleCounts.clear();
+
+	for (const auto &item : slots) {
+		if (item) {
+			add(item, true);
+		}
+	}
+}
+
+bool InventoryItemIndex::verify(std::span<const std::shared_ptr<Item>> slots) const {
+	InventoryItemIndex fresh;
+	fresh.rebuild(slots);
+	return fresh.itemCounts == itemCounts && fresh.tierCounts == tierCounts && fresh.saleCounts == saleCounts;
+}
+
+void InventoryItemIndex::addItem(const std::shared_ptr<Item> &item, bool equipped) {
+	addEntry(item->getID(), item->getTier(), item->getItemCount(), equipped);
+}
+
+void InventoryItemIndex::removeItem(const std::shared_ptr<Item> &item, bool equipped) {
+	removeEntry(item->getID(), item->getTier(), item->getItemCount(), equipped);
+}
+
+void InventoryItemIndex::addEntry(uint16_t itemId, uint8_t tier, uint32_t count, bool equipped) {
+	if (count == 0) {
+		return;
+	}
+
+	itemCounts[itemId] += count;
+	tierCounts[itemId][tier] += count;
+	// Like the inventory walk it replaces, the tier only keeps items inside containers off the npc sale list
+	if (equipped || tier == 0) {
+		saleCounts[itemId] += count;
+	}
+}
+
+void InventoryItemIndex::removeEntry(uint16_t itemId, uint8_t tier, uint32_t count, bool equipped) {
+	if (count == 0) {
+		return;
+	}
+
+	subtractCount(itemCounts, itemId, count);
+	if (const auto it = tierCounts.find(itemId); it != tierCounts.end()) {
+		subtractCount(it->second, tier, count);
+		if (it->second.empty()) {
+			tierCounts.erase(it);
+		}
+	}
+	if (equipped || tier == 0) {
+		subtractCount(saleCounts, itemId, count);
+	}
+}
@@ -0,0 +1,74 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "creatures/creatures_definitions.hpp"
+
+class Item;
+
+/**
+ * Aggregated item id/tier/count totals of everything a player carries,
+ * equipped items and the full content of nested containers included.
+ *
+ * The totals are kept up to date incrementally: the player slot mutators and
+ * Container::updateItemHolding add or remove whole item subtrees, and id, count
+ * or tier changes made in place report their old values through
+ * Item::updateInventoryItemIndex. Queries (NPC trade windows, imbuement UIs, Lua
+ * quest checks) cost a lookup instead of a walk over every nested container.
+ */
+class InventoryItemIndex {
+public:
+	// Adds the item and everything inside it
+	void add(const std::shared_ptr<Item> &item, bool equipped);
+	// Removes the item and everything inside it
+	void remove(const std::shared_ptr<Item> &item, bool equipped);
+	// Moves the entry of a single item from its old id, tier and count to the current ones
+	void replace(uint16_t oldId, uint8_t oldTier, uint32_t oldCount, const std::shared_ptr<Item> &item, bool equipped);
+
+	void rebuild(std::span<const std::shared_ptr<Item>> slots);
+
+	/**
+	 * @brief Compares the cached totals with a fresh walk of the given slots.
+	 * @return True if the index matches the inventory content.
+	 */
+	bool verify(std::span<const std::shared_ptr<Item>> slots) const;
+
+	uint32_t getItemCount(uint16_t itemId) const {
+		const auto it = itemCounts.find(itemId);
+		return it != itemCounts.end() ? it->second : 0;
+	}
+
+	// Item id -> count of every carried item
+	const phmap::flat_hash_map<uint16_t, uint32_t> &getItemCounts() const {
+		return itemCounts;
+	}
+
+	// Item id -> tier -> count of every carried item
+	const ItemsTierCountList &getTierCounts() const {
+		return tierCounts;
+	}
+
+	// Item id -> count of the items that can be sold to npcs: every equipped item and the items without tier inside containers
+	const std::map<uint16_t, uint32_t> &getSaleCounts() const {
+		return saleCounts;
+	}
+
+private:
+	void addEntry(uint16_t itemId, uint8_t tier, uint32_t count, bool equipped);
+	void removeEntry(uint16_t itemId, uint8_t tier, uint32_t count, bool equipped);
+	void addItem(const std::shared_ptr<Item> &item, bool equipped);
+	void removeItem(const std::shared_ptr<Item> &item, bool equipped);
+	template <typename Visitor>
+	static void forEachContained(const std::shared_ptr<Item> &item, Visitor visitor);
+
+	phmap::flat_hash_map<uint16_t, uint32_t> itemCounts;
+	ItemsTierCountList tierCounts;
+	std::map<uint16_t, uint32_t> saleCounts;
+};
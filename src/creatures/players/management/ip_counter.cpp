@@ -0,0 +1,45 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "creatures/players/management/ip_counter.hpp"
+
+void PlayerIpCounter::setPlayerIp(uint32_t playerId, uint32_t ip) {
+	const auto it = ipByPlayer.find(playerId);
+	const uint32_t oldIp = it != ipByPlayer.end() ? it->second : 0;
+	if (oldIp == ip) {
+		return;
+	}
+
+	if (oldIp != 0) {
+		auto &count = playersByIp[oldIp];
+		if (count <= MAX_PLAYERS_PER_IP) {
+			--realPlayers;
+		}
+		if (--count == 0) {
+			playersByIp.erase(oldIp);
+		}
+	}
+
+	if (ip == 0) {
+		ipByPlayer.erase(it);
+		return;
+	}
+
+	ipByPlayer[playerId] = ip;
+	if (++playersByIp[ip] <= MAX_PLAYERS_PER_IP) {
+		++realPlayers;
+	}
+}
+
+uint32_t PlayerIpCounter::getPlayersByIp(uint32_t ip) const {
+	const auto it = playersByIp.find(ip);
+	return it != playersByIp.end() ? it->second : 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+// Online players per connection ip, kept up to date as players log in, log out, lose or regain their connection.
+// The status document counts at most MAX_PLAYERS_PER_IP connected players per ip as real players.
+class PlayerIpCounter {
+public:
+	static constexpr uint32_t MAX_PLAYERS_PER_IP = 4;
+
+	// ip 0 means the player has no connection, it is not counted
+	void setPlayerIp(uint32_t playerId, uint32_t ip);
+	void removePlayer(uint32_t playerId) {
+		setPlayerIp(playerId, 0);
+	}
+
+	uint32_t getRealPlayers() const {
+		return realPlayers;
+	}
+	uint32_t getPlayersByIp(uint32_t ip) const;
+
+private:
+	phmap::flat_hash_map<uint32_t, uint32_t> ipByPlayer;
+	phmap::flat_hash_map<uint32_t, uint32_t> playersByIp;
+	uint32_t realPlayers = 0;
+};
@@ -18,6 +18,7 @@
 #include "creatures/players/achievement/player_achievement.hpp"
 #include "creatures/players/storages/storages.hpp"
 #include "game/game.hpp"
+#include "game/highscores/highscores.hpp"
 #include "game/modal_window/modal_window.hpp"
 #include "game/scheduling/dispatcher.hpp"
 #include "game/scheduling/task.hpp"
@@ -555,6 +556,15 @@ void Player::updateInventoryWeight() {
 	}
 }
 
+const InventoryItemIndex &Player::getInventoryItemIndex() const {
+	const auto slots = std::span<const std::shared_ptr<Item>>(inventory + CONST_SLOT_FIRST, CONST_SLOT_LAST - CONST_SLOT_FIRST + 1);
+	if (g_configManager().getBoolean(INVENTORY_ITEM_INDEX_CONSISTENCY_CHECK, __FUNCTION__) && !inventoryItemIndex.verify(slots)) {
+		g_logger().error("[{}] - Inventory item index of player {} is out of sync, rebuilding", __FUNCTION__, getName());
+		inventoryItemIndex.rebuild(slots);
+	}
+	return inventoryItemIndex;
+}
+
 void Player::updateInventoryImbuement() {
 	// Get the tile the player is currently on
 	std::shared_ptr<Tile> playerTile = getTile();
@@ -679,6 +689,7 @@ void Player::addSkillAdvance(skills_t skill, uint64_t count) {
 		return;
 	}
 
+	const auto oldSkillLevel = skills[skill].level;
 	bool sendUpdateSkills = false;
 	while ((skills[skill].tries + count) >= nextReqTries) {
 		count -= nextReqTries - skills[skill].tries;
@@ -719,6 +730,10 @@ void Player::addSkillAdvance(skills_t skill, uint64_t count) {
 		sendSkills();
 		sendStats();
 	}
+
+	if (skills[skill].level != oldSkillLevel) {
+		g_highscores().updatePlayer(static_self_cast<Player>(), Highscores::getSkillCategory(skill));
+	}
 }
 
 void Player::setVarStats(stats_t stat, int32_t modifier) {
@@ -2285,6 +2300,7 @@ void Player::addManaSpent(uint64_t amount) {
 		return;
 	}
 
+	const auto oldMagLevel = magLevel;
 	bool sendUpdateStats = false;
 	while ((manaSpent + amount) >= nextReqMana) {
 		amount -= nextReqMana - manaSpent;
@@ -2323,6 +2339,10 @@ void Player::addManaSpent(uint64_t amount) {
 		sendStats();
 		sendSkills();
 	}
+
+	if (magLevel != oldMagLevel) {
+		g_highscores().updatePlayer(static_self_cast<Player>(), HighscoreCategories_t::MAGIC_LEVEL);
+	}
 }
 
 void Player::addExperience(std::shared_ptr<Creature> target, uint64_t exp, bool sendText /* = false*/) {
@@ -2443,6 +2463,7 @@ void Player::addExperience(std::shared_ptr<Creature> target, uint64_t exp, bool
 	}
 	sendStats();
 	sendExperienceTracker(rawExp, exp);
+	g_highscores().updatePlayer(static_self_cast<Player>(), HighscoreCategories_t::EXPERIENCE);
 }
 
 void Player::removeExperience(uint64_t exp, bool sendText /* = false*/) {
@@ -2528,6 +2549,7 @@ void Player::removeExperience(uint64_t exp, bool sendText /* = false*/) {
 	}
 	sendStats();
 	sendExperienceTracker(0, -static_cast<int64_t>(exp));
+	g_highscores().updatePlayer(static_self_cast<Player>(), HighscoreCategories_t::EXPERIENCE);
 }
 
 double_t Player::getPercentLevel(uint64_t count, uint64_t nextLevelCount) {
@@ -2847,6 +2869,7 @@ void Player::death(std::shared_ptr<Creature> lastHitCreature) {
 		sendStats();
 		sendSkills();
 		sendReLoginWindow(unfairFightReduction);
+		g_highscores().updatePlayer(static_self_cast<Player>());
 		sendBlessStatus();
 		if (getSkull() == SKULL_BLACK) {
 			health = 40;
@@ -2856,32 +2879,34 @@ void Player::death(std::shared_ptr<Creature> lastHitCreature) {
 			mana = manaMax;
 		}
 
-		auto it = conditions.begin(), end = conditions.end();
-		while (it != end) {
-			std::shared_ptr<Condition> condition = *it;
+		std::vector<std::shared_ptr<Condition>> removeConditions;
+		for (const auto &condition : conditions) {
 			// isSupress block to delete spells conditions (ensures that the player cannot, for example, reset the cooldown time of the familiar and summon several)
 			if (condition->isPersistent() && condition->isRemovableOnDeath()) {
-				it = conditions.erase(it);
+				removeConditions.push_back(condition);
+			}
+		}
 
+		for (const auto &condition : removeConditions) {
+			if (conditions.erase(condition)) {
 				condition->endCondition(static_self_cast<Player>());
 				onEndCondition(condition->getType());
-			} else {
-				++it;
 			}
 		}
 	} else {
 		setSkillLoss(true);
 
-		auto it = conditions.begin(), end = conditions.end();
-		while (it != end) {
-			std::shared_ptr<Condition> condition = *it;
+		std::vector<std::shared_ptr<Condition>> removeConditions;
+		for (const auto &condition : conditions) {
 			if (condition->isPersistent()) {
-				it = conditions.erase(it);
+				removeConditions.push_back(condition);
+			}
+		}
 
+		for (const auto &condition : removeConditions) {
+			if (conditions.erase(condition)) {
 				condition->endCondition(static_self_cast<Player>());
 				onEndCondition(condition->getType());
-			} else {
-				++it;
 			}
 		}
 
@@ -3615,6 +3640,7 @@ void Player::addThing(int32_t index, std::shared_ptr<Thing> thing) {
 
 	item->setParent(static_self_cast<Player>());
 	inventory[index] = item;
+	inventoryItemIndex.add(item, true);
 
 	// send to client
 	sendInventoryItem(static_cast<Slots_t>(index), item);
@@ -3664,7 +3690,9 @@ void Player::replaceThing(uint32_t index, std::shared_ptr<Thing> thing) {
 
 	item->setParent(static_self_cast<Player>());
 
+	inventoryItemIndex.remove(oldItem, true);
 	inventory[index] = item;
+	inventoryItemIndex.add(item, true);
 }
 
 void Player::removeThing(std::shared_ptr<Thing> thing, uint32_t count) {
@@ -3686,6 +3714,7 @@ void Player::removeThing(std::shared_ptr<Thing> thing, uint32_t count) {
 			// event methods
 			onRemoveInventoryItem(item);
 
+			inventoryItemIndex.remove(item, true);
 			item->resetParent();
 			inventory[index] = nullptr;
 		} else {
@@ -3705,6 +3734,7 @@ void Player::removeThing(std::shared_ptr<Thing> thing, uint32_t count) {
 		// event methods
 		onRemoveInventoryItem(item);
 
+		inventoryItemIndex.remove(item, true);
 		item->resetParent();
 		inventory[index] = nullptr;
 	}
@@ -3728,6 +3758,10 @@ size_t Player::getLastIndex() const {
 }
 
 uint32_t Player::getItemTypeCount(uint16_t itemId, int32_t subType /*= -1*/) const {
+	if (subType == -1) {
+		return getInventoryItemIndex().getItemCount(itemId);
+	}
+
 	uint32_t count = 0;
 	for (int32_t i = CONST_SLOT_FIRST; i <= CONST_SLOT_LAST; i++) {
 		std::shared_ptr<Item> item = inventory[i];
@@ -3914,22 +3948,7 @@ bool Player::removeItemCountById(uint16_t itemId, uint32_t itemAmount, bool remo
 }
 
 ItemsTierCountList Player::getInventoryItemsId() const {
-	ItemsTierCountList itemMap;
-	for (int32_t i = CONST_SLOT_FIRST; i <= CONST_SLOT_LAST; i++) {
-		std::shared_ptr<Item> item = inventory[i];
-		if (!item) {
-			continue;
-		}
-
-		(itemMap[item->getID()])[item->getTier()] += Item::countByType(item, -1);
-		if (std::shared_ptr<Container> container = item->getContainer()) {
-			for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
-				auto containerItem = *it;
-				(itemMap[containerItem->getID()])[containerItem->getTier()] += Item::countByType(containerItem, -1);
-			}
-		}
-	}
-	return itemMap;
+	return getInventoryItemIndex().getTierCounts();
 }
 
 std::vector<std::shared_ptr<Item>> Player::getInventoryItemsFromId(uint16_t itemId, bool ignore /*= true*/) const {
@@ -4074,15 +4093,15 @@ std::vector<std::shared_ptr<Item>> Player::getEquippedItems() const {
 }
 
 std::map<uint32_t, uint32_t> &Player::getAllItemTypeCount(std::map<uint32_t, uint32_t> &countMap) const {
-	for (const auto item : getAllInventoryItems()) {
-		countMap[static_cast<uint32_t>(item->getID())] += Item::countByType(item, -1);
+	for (const auto &[itemId, count] : getInventoryItemIndex().getItemCounts()) {
+		countMap[static_cast<uint32_t>(itemId)] += count;
 	}
 	return countMap;
 }
 
 std::map<uint16_t, uint16_t> &Player::getAllSaleItemIdAndCount(std::map<uint16_t, uint16_t> &countMap) const {
-	for (const auto item : getAllInventoryItems(false, true)) {
-		countMap[item->getID()] += item->getItemCount();
+	for (const auto &[itemId, count] : getInventoryItemIndex().getSaleCounts()) {
+		countMap[itemId] += static_cast<uint16_t>(count);
 	}
 
 	return countMap;
@@ -4284,6 +4303,7 @@ void Player::internalAddThing(uint32_t index, std::shared_ptr<Thing> thing) {
 
 		inventory[index] = item;
 		item->setParent(static_self_cast<Player>());
+		inventoryItemIndex.add(item, true);
 	}
 }
 
@@ -6055,6 +6075,10 @@ bool Player::addOfflineTrainingTries(skills_t skill, uint64_t tries) {
 		sendStats();
 	}
 
+	if (newSkillValue != oldSkillValue) {
+		g_highscores().updatePlayer(static_self_cast<Player>(), Highscores::getSkillCategory(skill));
+	}
+
 	std::string message = fmt::format(
 		"Your {} skill changed from level {} (with {:.2f}% progress towards level {}) to level {} (with {:.2f}% progress towards level {})",
 		ucwords(getSkillName(skill)),
@@ -6651,6 +6675,7 @@ void Player::triggerMomentum() {
 			++it;
 		}
 		if (triggered) {
+			conditions.invalidateDueTime();
 			g_game().addMagicEffect(getPosition(), CONST_ME_HOURGLASS);
 			sendTextMessage(MESSAGE_ATTENTION, "Momentum was triggered.");
 		}
@@ -6671,6 +6696,7 @@ void Player::clearCooldowns() {
 		}
 		++it;
 	}
+	conditions.invalidateDueTime();
 }
 
 void Player::triggerTranscendance() {
@@ -20,6 +20,7 @@
 #include "grouping/groups.hpp"
 #include "grouping/guild.hpp"
 #include "imbuements/imbuements.hpp"
+#include "inventory/inventory_item_index.hpp"
 #include "items/containers/inbox/inbox.hpp"
 #include "io/ioguild.hpp"
 #include "io/ioprey.hpp"
@@ -2572,6 +2573,19 @@ public:
 	// This get all players slot items
 	phmap::flat_hash_map<uint8_t, std::shared_ptr<Item>> getAllSlotItems() const;
 
+	// Adds or removes an item and its content placed in or taken out of a carried container
+	void updateInventoryItemIndex(const std::shared_ptr<Item> &item, bool added) {
+		if (added) {
+			inventoryItemIndex.add(item, false);
+		} else {
+			inventoryItemIndex.remove(item, false);
+		}
+	}
+	// A carried item changed its id, count or tier in place
+	void updateInventoryItemIndex(const std::shared_ptr<Item> &item, uint16_t oldId, uint8_t oldTier, uint32_t oldCount) {
+		inventoryItemIndex.replace(oldId, oldTier, oldCount, item, item->getParent() == getPlayer());
+	}
+
 	/**
 	 * @brief Get the equipped items of the player->
 	 * @details This function returns a vector containing the items currently equipped by the player
@@ -2616,6 +2630,7 @@ private:
 	void removeExperience(uint64_t exp, bool sendText = false);
 
 	void updateInventoryWeight();
+	const InventoryItemIndex &getInventoryItemIndex() const;
 	/**
 	 * @brief Starts checking the imbuements in the item so that the time decay is performed
 	 * Registers the player in an unordered_map in game.h so that the function can be initialized by the task
@@ -2760,6 +2775,7 @@ private:
 	std::shared_ptr<Item> imbuingItem = nullptr;
 	std::shared_ptr<Item> tradeItem = nullptr;
 	std::shared_ptr<Item> inventory[CONST_SLOT_LAST + 1] = {};
+	mutable InventoryItemIndex inventoryItemIndex;
 	std::shared_ptr<Item> writeItem = nullptr;
 	std::shared_ptr<House> editHouse = nullptr;
 	std::shared_ptr<Npc> shopOwner = nullptr;
@@ -116,6 +116,7 @@ void DatabaseManager::updateDatabase() {
 
 		LuaScriptInterface::resetScriptEnv();
 	} while (true);
+	LuaScriptInterface::clearMetatableRefs(L);
 	lua_close(L);
 }
 
@@ -14,6 +14,7 @@
 #include "config/configmanager.hpp"
 #include "lua/creature/events.hpp"
 #include "creatures/players/imbuements/imbuements.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
 #include "lua/scripts/lua_environment.hpp"
 #include "lua/modules/modules.hpp"
 #include "lua/scripts/scripts.hpp"
@@ -99,6 +100,8 @@ bool GameReload::reloadChat() const {
 
 bool GameReload::reloadConfig() const {
 	const bool result = g_configManager().reload();
+	g_luaBytecodeCache().setDirectory(g_configManager().getString(LUA_BYTECODE_CACHE_DIRECTORY, __FUNCTION__));
+	g_luaEnvironment().configureGarbageCollector();
 	logReloadStatus("Config", result);
 	return result;
 }
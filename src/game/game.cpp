@@ -19,8 +19,10 @@
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
 #include "creatures/players/highscore_category.hpp"
+#include "game/highscores/highscores.hpp"
 #include "game/zones/zone.hpp"
 #include "lua/global/globalevent.hpp"
+#include "io/io_name_cache.hpp"
 #include "io/iologindata.hpp"
 #include "io/io_wheel.hpp"
 #include "io/iomarket.hpp"
@@ -53,23 +55,6 @@
 
 #include <appearances.pb.h>
 
-enum class HighscoreCategories_t : uint8_t {
-	EXPERIENCE = 0,
-	FIST_FIGHTING = 1,
-	CLUB_FIGHTING = 2,
-	SWORD_FIGHTING = 3,
-	AXE_FIGHTING = 4,
-	DISTANCE_FIGHTING = 5,
-	SHIELDING = 6,
-	FISHING = 7,
-	MAGIC_LEVEL = 8,
-	LOYALTY = 9,
-	ACHIEVEMENTS = 10,
-	CHARMS = 11,
-	DROME = 12,
-	GOSHNAR = 13,
-};
-
 namespace InternalGame {
 	void sendBlockEffect(BlockType_t blockType, CombatType_t combatType, const Position &targetPos, std::shared_ptr<Creature> source) {
 		if (blockType == BLOCK_DEFENSE) {
@@ -362,11 +347,12 @@ void Game::start(ServiceManager* manager) {
 	g_dispatcher().cycleEvent(
 		EVENT_IMBUEMENT_INTERVAL, [this] { checkImbuements(); }, "Game::checkImbuements"
 	);
+	g_luaEnvironment().configureGarbageCollector();
 	g_dispatcher().cycleEvent(
-		EVENT_LUA_GARBAGE_COLLECTION, [this] { g_luaEnvironment().collectGarbage(); }, "Calling GC"
+		EVENT_REFRESH_MARKET_PRICES, [this] { loadItemsPrice(); }, "Game::loadItemsPrice"
 	);
 	g_dispatcher().cycleEvent(
-		EVENT_REFRESH_MARKET_PRICES, [this] { loadItemsPrice(); }, "Game::loadItemsPrice"
+		static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Highscores::RECONCILE_INTERVAL).count()), [] { g_highscores().reconcile(); }, "Highscores::reconcile"
 	);
 }
 
@@ -461,16 +447,7 @@ void Game::setGameState(GameState_t newState) {
 
 bool Game::loadItemsPrice() {
 	IOMarket::getInstance().updateStatistics();
-	std::ostringstream query, marketQuery;
-	query << "SELECT DISTINCT `itemtype` FROM `market_offers`;";
-
-	Database &db = Database::getInstance();
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
-		return false;
-	}
-
-	auto stats = IOMarket::getInstance().getPurchaseStatistics();
+	const auto &stats = IOMarket::getInstance().getPurchaseStatistics();
 	for (const auto &[itemId, itemStats] : stats) {
 		std::map<uint8_t, uint64_t> tierToPrice;
 		for (const auto &[tier, tierStats] : itemStats) {
@@ -868,15 +845,10 @@ std::string Game::getPlayerNameByGUID(const uint32_t &guid) {
 	if (guid == 0) {
 		return "";
 	}
-	if (m_playerNameCache.contains(guid)) {
-		return m_playerNameCache.at(guid);
+	if (const auto &player = getPlayerByGUID(guid)) {
+		return player->getName();
 	}
-	auto player = getPlayerByGUID(guid, true);
-	auto name = player ? player->getName() : "";
-	if (!name.empty()) {
-		m_playerNameCache[guid] = name;
-	}
-	return name;
+	return g_nameCache().getPlayerName(guid);
 }
 
 ReturnValue Game::getPlayerByNameWildcard(const std::string &s, std::shared_ptr<Player> &player) {
@@ -6112,6 +6084,10 @@ void Game::checkCreatureAttack(uint32_t creatureId) {
 
 void Game::addCreatureCheck(const std::shared_ptr<Creature> &creature) {
 	creature->creatureCheck = true;
+	if (creature->hibernating) {
+		creature->hibernating = false;
+		--hibernatingCreatures;
+	}
 
 	if (creature->inCheckCreaturesVector) {
 		// already in a vector
@@ -6127,17 +6103,55 @@ void Game::removeCreatureCheck(const std::shared_ptr<Creature> &creature) {
 	if (creature->inCheckCreaturesVector) {
 		creature->creatureCheck = false;
 	}
+
+	if (creature->hibernating) {
+		creature->hibernating = false;
+		creature->creatureCheck = false;
+		--g_game().hibernatingCreatures;
+	}
+}
+
+void Game::wakeCreature(const std::shared_ptr<Creature> &creature) {
+	if (creature->hibernating) {
+		addCreatureCheck(creature);
+	}
 }
 
 void Game::checkCreatures() {
 	metrics::method_latency measure(__METHOD_NAME__);
 	static size_t index = 0;
 
+	// Monsters and npcs out of reach of every player stop thinking, their conditions and walk are frozen until
+	// Map::wakeCreaturesInHibernationRange wakes them up. Creatures sharing a leaf share the lookup.
+	const bool hibernation = g_configManager().getBoolean(TOGGLE_CREATURE_HIBERNATION, __FUNCTION__);
+	std::unordered_map<const QTreeLeafNode*, bool> leavesInRange;
+	const auto isOutOfRange = [this, &leavesInRange](const std::shared_ptr<Creature> &creature) {
+		const auto &pos = creature->getPosition();
+		const auto leaf = map.getQTNode(pos.x, pos.y);
+		auto [entry, inserted] = leavesInRange.try_emplace(leaf, true);
+		if (inserted) {
+			entry->second = map.hasPlayersInHibernationRange(pos);
+		}
+		return !entry->second;
+	};
+
 	auto &checkCreatureList = checkCreatureLists[index];
 	size_t it = 0, end = checkCreatureList.size();
 	while (it < end) {
 		auto creature = checkCreatureList[it];
 		if (creature && creature->creatureCheck) {
+			if (hibernation && creature->getHealth() > 0 && !creature->getPlayer() && isOutOfRange(creature)) {
+				creature->stopEventWalk();
+				creature->hibernating = true;
+				creature->inCheckCreaturesVector = false;
+				++hibernatingCreatures;
+
+				checkCreatureList[it] = checkCreatureList.back();
+				checkCreatureList.pop_back();
+				--end;
+				continue;
+			}
+
 			if (creature->getHealth() > 0) {
 				creature->onThink(EVENT_CREATURE_THINK_INTERVAL);
 				creature->onAttacking(EVENT_CREATURE_THINK_INTERVAL);
@@ -6158,6 +6172,16 @@ void Game::checkCreatures() {
 	cleanup();
 
 	index = (index + 1) % EVENT_CREATURECOUNT;
+	if (index == 0) {
+		int64_t activeCreatures = 0;
+		for (const auto &list : checkCreatureLists) {
+			activeCreatures += static_cast<int64_t>(list.size());
+		}
+		g_metrics().addUpDownCounter("creatures_active", static_cast<int>(activeCreatures - reportedActiveCreatures));
+		g_metrics().addUpDownCounter("creatures_hibernating", static_cast<int>(static_cast<int64_t>(hibernatingCreatures) - reportedHibernatingCreatures));
+		reportedActiveCreatures = activeCreatures;
+		reportedHibernatingCreatures = static_cast<int64_t>(hibernatingCreatures);
+	}
 }
 
 void Game::changeSpeed(std::shared_ptr<Creature> creature, int32_t varSpeedDelta) {
@@ -8281,207 +8305,24 @@ void Game::playerCyclopediaCharacterInfo(std::shared_ptr<Player> player, uint32_
 	}
 }
 
-std::string Game::generateHighscoreQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation) {
-	std::ostringstream query;
-	uint32_t startPage = (static_cast<uint32_t>(page - 1) * static_cast<uint32_t>(entriesPerPage));
-	uint32_t endPage = startPage + static_cast<uint32_t>(entriesPerPage);
-
-	query << "SELECT *, @row AS `entries`, " << page << " AS `page` FROM (SELECT *, (@row := @row + 1) AS `rn` FROM (SELECT `id`, `name`, `level`, `vocation`, `"
-		  << categoryName << "` AS `points`, @curRank := IF(@prevRank = `" << categoryName << "`, @curRank, IF(@prevRank := `" << categoryName
-		  << "`, @curRank + 1, @curRank + 1)) AS `rank` FROM `players` `p`, (SELECT @curRank := 0, @prevRank := NULL, @row := 0) `r` WHERE `group_id` < "
-		  << static_cast<int>(GROUP_TYPE_GAMEMASTER) << " ORDER BY `" << categoryName << "` DESC) `t`";
-
-	if (vocation != 0xFFFFFFFF) {
-		query << generateVocationConditionHighscore(vocation);
-	}
-	query << ") `T` WHERE `rn` > " << startPage << " AND `rn` <= " << endPage;
-
-	return query.str();
-}
-
-std::string Game::generateHighscoreQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation) {
-	std::ostringstream query;
-	std::string entriesStr = std::to_string(entriesPerPage);
-
-	query << "SELECT *, @row AS `entries`, (@ourRow DIV " << entriesStr << ") + 1 AS `page` FROM (SELECT *, (@row := @row + 1) AS `rn`, @ourRow := IF(`id` = "
-		  << playerGUID << ", @row - 1, @ourRow) AS `rw` FROM (SELECT `id`, `name`, `level`, `vocation`, `" << categoryName << "` AS `points`, @curRank := IF(@prevRank = `"
-		  << categoryName << "`, @curRank, IF(@prevRank := `" << categoryName << "`, @curRank + 1, @curRank + 1)) AS `rank` FROM `players` `p`, (SELECT @curRank := 0, @prevRank := NULL, @row := 0, @ourRow := 0) `r` WHERE `group_id` < "
-		  << static_cast<int>(GROUP_TYPE_GAMEMASTER) << " ORDER BY `" << categoryName << "` DESC) `t`";
-
-	if (vocation != 0xFFFFFFFF) {
-		query << generateVocationConditionHighscore(vocation);
-	}
-	query << ") `T` WHERE `rn` > ((@ourRow DIV " << entriesStr << ") * " << entriesStr << ") AND `rn` <= (((@ourRow DIV " << entriesStr << ") * " << entriesStr << ") + " << entriesStr << ")";
-
-	return query.str();
-}
-
-std::string Game::generateVocationConditionHighscore(uint32_t vocation) {
-	std::ostringstream queryPart;
-	bool firstVocation = true;
-
-	const auto vocationsMap = g_vocations().getVocations();
-	for (const auto &it : vocationsMap) {
-		const auto &voc = it.second;
-		if (voc.getFromVocation() == vocation) {
-			if (firstVocation) {
-				queryPart << " WHERE `vocation` = " << voc.getId();
-				firstVocation = false;
-			} else {
-				queryPart << " OR `vocation` = " << voc.getId();
-			}
-		}
+void Game::playerHighscores(std::shared_ptr<Player> player, HighscoreType_t type, uint8_t category, uint32_t vocation, const std::string &, uint16_t page, uint8_t entriesPerPage) {
+	if (category >= Highscores::CATEGORY_COUNT) {
+		category = static_cast<uint8_t>(HighscoreCategories_t::EXPERIENCE);
 	}
 
-	return queryPart.str();
-}
-
-void Game::processHighscoreResults(DBResult_ptr result, uint32_t playerID, uint8_t category, uint32_t vocation, uint8_t entriesPerPage) {
-	std::shared_ptr<Player> player = g_game().getPlayerByID(playerID);
-	if (!player) {
-		return;
+	std::optional<Highscores::Page> result;
+	if (type == HIGHSCORE_GETENTRIES) {
+		result = g_highscores().getPage(category, vocation, page, entriesPerPage);
+	} else if (type == HIGHSCORE_OURRANK) {
+		result = g_highscores().getOurPage(category, vocation, player->getGUID(), entriesPerPage);
 	}
 
-	player->resetAsyncOngoingTask(PlayerAsyncTask_Highscore);
-
 	if (!result) {
 		player->sendHighscoresNoData();
 		return;
 	}
 
-	uint16_t page = result->getNumber<uint16_t>("page");
-	uint32_t pages = result->getNumber<uint32_t>("entries");
-	pages += entriesPerPage - 1;
-	pages /= entriesPerPage;
-
-	std::ostringstream cacheKeyStream;
-	cacheKeyStream << "Highscore_" << static_cast<int>(category) << "_" << static_cast<int>(vocation) << "_" << static_cast<int>(entriesPerPage) << "_" << page;
-	std::string cacheKey = cacheKeyStream.str();
-
-	auto it = highscoreCache.find(cacheKey);
-	auto now = std::chrono::system_clock::now();
-	if (it != highscoreCache.end() && (now - it->second.timestamp < HIGHSCORE_CACHE_EXPIRATION_TIME)) {
-		auto &cacheEntry = it->second;
-		auto cachedTime = it->second.timestamp;
-		auto durationSinceEpoch = cachedTime.time_since_epoch();
-		auto secondsSinceEpoch = std::chrono::duration_cast<std::chrono::seconds>(durationSinceEpoch).count();
-		auto updateTimer = static_cast<uint32_t>(secondsSinceEpoch);
-		player->sendHighscores(cacheEntry.characters, category, vocation, cacheEntry.page, static_cast<uint16_t>(cacheEntry.entriesPerPage), updateTimer);
-	} else {
-		std::vector<HighscoreCharacter> characters;
-		characters.reserve(result->countResults());
-		if (result) {
-			do {
-				uint8_t characterVocation;
-				const auto &voc = g_vocations().getVocation(result->getNumber<uint16_t>("vocation"));
-				if (voc) {
-					characterVocation = voc->getClientId();
-				} else {
-					characterVocation = 0;
-				}
-				characters.emplace_back(std::move(result->getString("name")), result->getNumber<uint64_t>("points"), result->getNumber<uint32_t>("id"), result->getNumber<uint32_t>("rank"), result->getNumber<uint16_t>("level"), characterVocation);
-			} while (result->next());
-		}
-
-		player->sendHighscores(characters, category, vocation, page, static_cast<uint16_t>(pages), getTimeNow());
-		highscoreCache[cacheKey] = { characters, page, pages, now };
-	}
-}
-
-void Game::cacheQueryHighscore(const std::string &key, const std::string &query, uint32_t page, uint8_t entriesPerPage) {
-	QueryHighscoreCacheEntry queryEntry { query, page, entriesPerPage, std::chrono::steady_clock::now() };
-	queryCache[key] = queryEntry;
-}
-
-std::string Game::generateHighscoreOrGetCachedQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation) {
-	std::ostringstream cacheKeyStream;
-	cacheKeyStream << "Entries_" << categoryName << "_" << page << "_" << static_cast<int>(entriesPerPage) << "_" << vocation;
-	std::string cacheKey = cacheKeyStream.str();
-
-	if (queryCache.find(cacheKey) != queryCache.end()) {
-		const QueryHighscoreCacheEntry &cachedEntry = queryCache[cacheKey];
-		if (cachedEntry.page == page) {
-			return cachedEntry.query;
-		}
-	}
-
-	std::string newQuery = generateHighscoreQueryForEntries(categoryName, page, entriesPerPage, vocation);
-	cacheQueryHighscore(cacheKey, newQuery, page, entriesPerPage);
-
-	return newQuery;
-}
-
-std::string Game::generateHighscoreOrGetCachedQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation) {
-	std::ostringstream cacheKeyStream;
-	cacheKeyStream << "OurRank_" << categoryName << "_" << static_cast<int>(entriesPerPage) << "_" << playerGUID << "_" << vocation;
-	std::string cacheKey = cacheKeyStream.str();
-
-	if (queryCache.find(cacheKey) != queryCache.end()) {
-		const QueryHighscoreCacheEntry &cachedEntry = queryCache[cacheKey];
-		if (cachedEntry.page == entriesPerPage) {
-			return cachedEntry.query;
-		}
-	}
-
-	std::string newQuery = generateHighscoreQueryForOurRank(categoryName, entriesPerPage, playerGUID, vocation);
-	cacheQueryHighscore(cacheKey, newQuery, entriesPerPage, entriesPerPage);
-
-	return newQuery;
-}
-
-void Game::playerHighscores(std::shared_ptr<Player> player, HighscoreType_t type, uint8_t category, uint32_t vocation, const std::string &, uint16_t page, uint8_t entriesPerPage) {
-	if (player->hasAsyncOngoingTask(PlayerAsyncTask_Highscore)) {
-		return;
-	}
-
-	std::string categoryName;
-	const auto &categoryType = static_cast<HighscoreCategories_t>(category);
-	switch (categoryType) {
-		case HighscoreCategories_t::FIST_FIGHTING:
-			categoryName = "skill_fist";
-			break;
-		case HighscoreCategories_t::CLUB_FIGHTING:
-			categoryName = "skill_club";
-			break;
-		case HighscoreCategories_t::SWORD_FIGHTING:
-			categoryName = "skill_sword";
-			break;
-		case HighscoreCategories_t::AXE_FIGHTING:
-			categoryName = "skill_axe";
-			break;
-		case HighscoreCategories_t::DISTANCE_FIGHTING:
-			categoryName = "skill_dist";
-			break;
-		case HighscoreCategories_t::SHIELDING:
-			categoryName = "skill_shielding";
-			break;
-		case HighscoreCategories_t::FISHING:
-			categoryName = "skill_fishing";
-			break;
-		case HighscoreCategories_t::MAGIC_LEVEL:
-			categoryName = "maglevel";
-			break;
-		default: {
-			category = static_cast<uint8_t>(HighscoreCategories_t::EXPERIENCE);
-			categoryName = "experience";
-			break;
-		}
-	}
-
-	std::string query;
-	if (type == HIGHSCORE_GETENTRIES) {
-		query = generateHighscoreOrGetCachedQueryForEntries(categoryName, page, entriesPerPage, vocation);
-	} else if (type == HIGHSCORE_OURRANK) {
-		query = generateHighscoreOrGetCachedQueryForOurRank(categoryName, entriesPerPage, player->getGUID(), vocation);
-	}
-
-	uint32_t playerID = player->getID();
-	std::function<void(DBResult_ptr, bool)> callback = [this, playerID, category, vocation, entriesPerPage](DBResult_ptr result, bool) {
-		processHighscoreResults(std::move(result), playerID, category, vocation, entriesPerPage);
-	};
-
-	g_databaseTasks().store(query, callback);
-	player->addAsyncOngoingTask(PlayerAsyncTask_Highscore);
+	player->sendHighscores(result->characters, category, vocation, result->page, result->pages, getTimeNow());
 }
 
 void Game::playerReportRuleViolationReport(uint32_t playerId, const std::string &targetName, uint8_t reportType, uint8_t reportReason, const std::string &comment, const std::string &translation) {
@@ -8632,9 +8473,15 @@ void Game::playerBrowseMarketOwnHistory(uint32_t playerId) {
 		return;
 	}
 
-	const HistoryMarketOfferList &buyOffers = IOMarket::getOwnHistory(MARKETACTION_BUY, player->getGUID());
-	const HistoryMarketOfferList &sellOffers = IOMarket::getOwnHistory(MARKETACTION_SELL, player->getGUID());
-	player->sendMarketBrowseOwnHistory(buyOffers, sellOffers);
+	IOMarket::loadOwnHistory(player->getGUID(), [this, playerId](const HistoryMarketOfferList &buyOffers, const HistoryMarketOfferList &sellOffers) {
+		// The player may have left the market, or the game, while the history was read
+		const auto &marketPlayer = getPlayerByID(playerId);
+		if (!marketPlayer || !marketPlayer->isInMarket()) {
+			return;
+		}
+
+		marketPlayer->sendMarketBrowseOwnHistory(buyOffers, sellOffers);
+	});
 }
 
 namespace {
@@ -9691,6 +9538,8 @@ void Game::addPlayer(std::shared_ptr<Player> player) {
 	mappedPlayerNames[lowercase_name] = player;
 	wildcardTree->insert(lowercase_name);
 	players[player->getID()] = player;
+	playerIps.setPlayerIp(player->getID(), player->getIP());
+	g_highscores().updatePlayer(player);
 }
 
 void Game::removePlayer(std::shared_ptr<Player> player) {
@@ -9698,6 +9547,15 @@ void Game::removePlayer(std::shared_ptr<Player> player) {
 	mappedPlayerNames.erase(lowercase_name);
 	wildcardTree->remove(lowercase_name);
 	players.erase(player->getID());
+	playerIps.removePlayer(player->getID());
+	// What the logout saves, a reconcile loading meanwhile must not roll it back
+	g_highscores().updatePlayer(player);
+}
+
+void Game::updatePlayerIp(const std::shared_ptr<Player> &player) {
+	if (players.contains(player->getID())) {
+		playerIps.setPlayerIp(player->getID(), player->getIP());
+	}
 }
 
 void Game::addNpc(std::shared_ptr<Npc> npc) {
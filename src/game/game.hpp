@@ -19,6 +19,7 @@
 #include "creatures/npcs/npc.hpp"
 #include "movement/position.hpp"
 #include "creatures/players/player.hpp"
+#include "creatures/players/management/ip_counter.hpp"
 #include "lua/creature/raids.hpp"
 #include "creatures/players/grouping/team_finder.hpp"
 #include "utils/wildcardtree.hpp"
@@ -57,25 +58,9 @@ static constexpr int32_t EVENT_LIGHTINTERVAL_MS = 10000;
 static constexpr int32_t EVENT_DECAYINTERVAL = 250;
 static constexpr int32_t EVENT_DECAY_BUCKETS = 4;
 static constexpr int32_t EVENT_FORGEABLEMONSTERCHECKINTERVAL = 300000;
-static constexpr int32_t EVENT_LUA_GARBAGE_COLLECTION = 60000 * 10; // 10min
 static constexpr int32_t EVENT_REFRESH_MARKET_PRICES = 60000; // 1min
 
 static constexpr std::chrono::minutes CACHE_EXPIRATION_TIME { 10 }; // 10min
-static constexpr std::chrono::minutes HIGHSCORE_CACHE_EXPIRATION_TIME { 10 }; // 10min
-
-struct QueryHighscoreCacheEntry {
-	std::string query;
-	uint32_t page;
-	uint8_t entriesPerPage;
-	std::chrono::time_point<std::chrono::steady_clock> timestamp;
-};
-
-struct HighscoreCacheEntry {
-	std::vector<HighscoreCharacter> characters;
-	uint32_t page;
-	uint32_t entriesPerPage;
-	std::chrono::time_point<std::chrono::system_clock> timestamp;
-};
 
 class Game {
 public:
@@ -185,6 +170,11 @@ public:
 
 	void addCreatureCheck(const std::shared_ptr<Creature> &creature);
 	static void removeCreatureCheck(const std::shared_ptr<Creature> &creature);
+	void wakeCreature(const std::shared_ptr<Creature> &creature);
+
+	size_t getHibernatingCreatures() const {
+		return hibernatingCreatures;
+	}
 
 	size_t getPlayersOnline() const {
 		return players.size();
@@ -198,6 +188,10 @@ public:
 	uint32_t getPlayersRecord() const {
 		return playersRecord;
 	}
+	// Connected players, at most PlayerIpCounter::MAX_PLAYERS_PER_IP per ip
+	uint32_t getRealPlayersOnline() const {
+		return playerIps.getRealPlayers();
+	}
 
 	void addItemsClassification(ItemClassification* itemsClassification) {
 		itemsClassifications.push_back(itemsClassification);
@@ -548,6 +542,8 @@ public:
 
 	void addPlayer(std::shared_ptr<Player> player);
 	void removePlayer(std::shared_ptr<Player> player);
+	// The connection of an online player changed
+	void updatePlayerIp(const std::shared_ptr<Player> &player);
 
 	void addNpc(std::shared_ptr<Npc> npc);
 	void removeNpc(std::shared_ptr<Npc> npc);
@@ -811,15 +807,11 @@ private:
 	 */
 	ReturnValue collectRewardChestItems(std::shared_ptr<Player> player, uint32_t maxMoveItems = 0);
 
-	phmap::flat_hash_map<std::string, QueryHighscoreCacheEntry> queryCache;
-	phmap::flat_hash_map<std::string, HighscoreCacheEntry> highscoreCache;
-
 	phmap::flat_hash_map<std::string, std::weak_ptr<Player>> m_uniqueLoginPlayerNames;
 	phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Player>> players;
 	phmap::flat_hash_map<std::string, std::weak_ptr<Player>> mappedPlayerNames;
 	phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Guild>> guilds;
 	phmap::flat_hash_map<uint16_t, std::shared_ptr<Item>> uniqueItems;
-	phmap::parallel_flat_hash_map<uint32_t, std::string> m_playerNameCache;
 
 	/* Items stored from the lua scripts positions
 	 * For example: ActionFunctions::luaActionPosition
@@ -832,6 +824,10 @@ private:
 
 	std::vector<std::shared_ptr<Charm>> CharmList;
 	std::vector<std::shared_ptr<Creature>> checkCreatureLists[EVENT_CREATURECOUNT];
+	size_t hibernatingCreatures = 0;
+	PlayerIpCounter playerIps;
+	int64_t reportedActiveCreatures = 0;
+	int64_t reportedHibernatingCreatures = 0;
 
 	std::vector<uint16_t> registeredMagicEffects;
 	std::vector<uint16_t> registeredDistanceEffects;
@@ -935,15 +931,6 @@ private:
 
 	// Variable members (m_)
 	std::unique_ptr<IOWheel> m_IOWheel;
-
-	void cacheQueryHighscore(const std::string &key, const std::string &query, uint32_t page, uint8_t entriesPerPage);
-	void processHighscoreResults(DBResult_ptr result, uint32_t playerID, uint8_t category, uint32_t vocation, uint8_t entriesPerPage);
-
-	std::string generateVocationConditionHighscore(uint32_t vocation);
-	std::string generateHighscoreQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation);
-	std::string generateHighscoreQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation);
-	std::string generateHighscoreOrGetCachedQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation);
-	std::string generateHighscoreOrGetCachedQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation);
 };
 
 constexpr auto g_game = Game::getInstance;
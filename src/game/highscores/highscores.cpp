@@ -0,0 +1,280 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "game/highscores/highscores.hpp"
+
+#include "creatures/players/player.hpp"
+#include "creatures/players/vocations/vocation.hpp"
+#include "database/database.hpp"
+#include "enums/account_group_type.hpp"
+#include "game/game.hpp"
+#include "game/scheduling/dispatcher.hpp"
+
+namespace {
+	// Columns of the categories, in HighscoreCategories_t order
+	constexpr std::array<std::string_view, Highscores::CATEGORY_COUNT> categoryColumns = {
+		"experience", "skill_fist", "skill_club", "skill_sword", "skill_axe", "skill_dist", "skill_shielding", "skill_fishing", "maglevel"
+	};
+
+	uint64_t getPoints(const std::shared_ptr<Player> &player, HighscoreCategories_t category) {
+		switch (category) {
+			case HighscoreCategories_t::EXPERIENCE:
+				return player->getExperience();
+			case HighscoreCategories_t::MAGIC_LEVEL:
+				return player->getBaseMagicLevel();
+			default:
+				return player->getBaseSkill(static_cast<uint8_t>(category) - static_cast<uint8_t>(HighscoreCategories_t::FIST_FIGHTING));
+		}
+	}
+}
+
+void Highscores::load() {
+	Benchmark bm_load;
+	const auto loaded = loadCharacters();
+
+	std::array<std::vector<Leaderboard::Entry>, CATEGORY_COUNT> entries;
+	for (auto &categoryEntries : entries) {
+		categoryEntries.reserve(loaded.size());
+	}
+
+	characters.clear();
+	updatedAt.clear();
+	characters.reserve(loaded.size());
+	for (const auto &[guid, character] : loaded) {
+		const auto group = getGroup(character.vocation);
+		for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+			entries[category].push_back({ character.points[category], guid, group });
+		}
+		characters.emplace(guid, character);
+	}
+
+	for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+		boards[category].assign(std::move(entries[category]));
+	}
+
+	g_logger().info("Loaded {} characters into the highscores in {} milliseconds", characters.size(), bm_load.duration());
+}
+
+Highscores::CharacterList Highscores::loadCharacters() {
+	CharacterList loaded;
+	std::string query = "SELECT `id`, `name`, `level`, `vocation`";
+	for (const auto column : categoryColumns) {
+		query += fmt::format(", `{}`", column);
+	}
+	query += fmt::format(" FROM `players` WHERE `group_id` < {}", static_cast<int>(GROUP_TYPE_GAMEMASTER));
+
+	const DBResult_ptr result = Database::getInstance().storeQuery(query);
+	if (!result) {
+		return loaded;
+	}
+
+	loaded.reserve(result->countResults());
+	do {
+		Character character;
+		character.name = result->getString("name");
+		character.level = result->getNumber<uint32_t>("level");
+		character.vocation = result->getNumber<uint16_t>("vocation");
+		for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+			character.points[category] = result->getNumber<uint64_t>(std::string(categoryColumns[category]));
+		}
+		loaded.emplace_back(result->getNumber<uint32_t>("id"), std::move(character));
+	} while (result->next());
+	return loaded;
+}
+
+void Highscores::reconcile() {
+	const auto snapshot = revision;
+	threadPool.addLoad([this, snapshot] {
+		auto loaded = std::make_shared<CharacterList>(loadCharacters());
+		g_dispatcher().addEvent([this, loaded, snapshot] { applyReconcile(*loaded, snapshot); }, "Highscores::reconcile");
+	});
+}
+
+void Highscores::applyReconcile(const CharacterList &loaded, uint64_t snapshot) {
+	Benchmark bm_reconcile;
+	// Players who logged out while the load ran were saved after it may have read them, their entry is newer
+	const auto updatedSince = [this, snapshot](uint32_t guid) {
+		const auto it = updatedAt.find(guid);
+		return it != updatedAt.end() && it->second > snapshot;
+	};
+
+	std::unordered_set<uint32_t> seen;
+	seen.reserve(loaded.size());
+	for (const auto &[guid, character] : loaded) {
+		seen.insert(guid);
+		// Online players keep their live points, the database only has their last save
+		if (const auto player = g_game().getPlayerByGUID(guid)) {
+			updatePlayer(player);
+		} else if (!updatedSince(guid)) {
+			setCharacter(guid, character);
+		}
+	}
+
+	std::vector<uint32_t> removed;
+	for (const auto &[guid, _] : characters) {
+		if (!seen.contains(guid) && !g_game().getPlayerByGUID(guid) && !updatedSince(guid)) {
+			removed.push_back(guid);
+		}
+	}
+	for (const auto guid : removed) {
+		removeCharacter(guid);
+	}
+
+	g_logger().debug("Reconciled {} highscore characters in {} milliseconds, {} removed", loaded.size(), bm_reconcile.duration(), removed.size());
+}
+
+void Highscores::updatePlayer(const std::shared_ptr<Player> &player) {
+	if (!player) {
+		return;
+	}
+
+	updatedAt[player->getGUID()] = ++revision;
+	if (player->getGroup()->id >= GROUP_TYPE_GAMEMASTER) {
+		removeCharacter(player->getGUID());
+		return;
+	}
+
+	Character character;
+	character.name = player->getName();
+	character.level = player->getLevel();
+	character.vocation = player->getVocationId();
+	for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+		character.points[category] = getPoints(player, static_cast<HighscoreCategories_t>(category));
+	}
+	setCharacter(player->getGUID(), std::move(character));
+}
+
+void Highscores::updatePlayer(const std::shared_ptr<Player> &player, HighscoreCategories_t category) {
+	const auto index = static_cast<size_t>(category);
+	if (!player || index >= CATEGORY_COUNT) {
+		return;
+	}
+
+	const auto guid = player->getGUID();
+	const auto it = characters.find(guid);
+	if (it == characters.end() || it->second.vocation != player->getVocationId() || player->getGroup()->id >= GROUP_TYPE_GAMEMASTER) {
+		updatePlayer(player);
+		return;
+	}
+
+	updatedAt[guid] = ++revision;
+	auto &character = it->second;
+	if (category == HighscoreCategories_t::EXPERIENCE) {
+		character.level = player->getLevel();
+	}
+
+	const auto points = getPoints(player, category);
+	if (character.points[index] == points) {
+		return;
+	}
+
+	const auto group = getGroup(character.vocation);
+	boards[index].erase({ character.points[index], guid, group });
+	boards[index].insert({ points, guid, group });
+	character.points[index] = points;
+}
+
+void Highscores::setCharacter(uint32_t guid, Character character) {
+	const auto group = getGroup(character.vocation);
+	const auto it = characters.find(guid);
+	if (it == characters.end()) {
+		for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+			boards[category].insert({ character.points[category], guid, group });
+		}
+		characters.emplace(guid, std::move(character));
+		return;
+	}
+
+	const auto oldGroup = getGroup(it->second.vocation);
+	for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+		const auto oldPoints = it->second.points[category];
+		const auto newPoints = character.points[category];
+		if (oldPoints == newPoints && oldGroup == group) {
+			continue;
+		}
+
+		boards[category].erase({ oldPoints, guid, oldGroup });
+		boards[category].insert({ newPoints, guid, group });
+	}
+	it->second = std::move(character);
+}
+
+void Highscores::removeCharacter(uint32_t guid) {
+	const auto it = characters.find(guid);
+	if (it == characters.end()) {
+		return;
+	}
+
+	const auto group = getGroup(it->second.vocation);
+	for (size_t category = 0; category < CATEGORY_COUNT; ++category) {
+		boards[category].erase({ it->second.points[category], guid, group });
+	}
+	characters.erase(it);
+}
+
+std::optional<Highscores::Page> Highscores::getPage(uint8_t category, uint32_t vocation, uint16_t page, uint8_t entriesPerPage) const {
+	if (category >= CATEGORY_COUNT || entriesPerPage == 0) {
+		return std::nullopt;
+	}
+
+	const auto &board = boards[category];
+	const auto group = getFilterGroup(vocation);
+	const auto pages = (board.size(group) + entriesPerPage - 1) / entriesPerPage;
+	page = std::max<uint16_t>(page, 1);
+	if (page > pages) {
+		return std::nullopt;
+	}
+
+	const size_t first = static_cast<size_t>(page - 1) * entriesPerPage;
+	const auto entries = board.getRange(first, entriesPerPage, group);
+
+	Page result;
+	result.page = page;
+	result.pages = static_cast<uint16_t>(std::min<size_t>(pages, std::numeric_limits<uint16_t>::max()));
+	result.characters.reserve(entries.size());
+	// Only the first rank needs a lookup, the next ones follow from the position
+	size_t rank = entries.empty() ? 0 : board.getRank(entries.front().points, group);
+	for (size_t i = 0; i < entries.size(); ++i) {
+		const auto &entry = entries[i];
+		if (i > 0 && entry.points != entries[i - 1].points) {
+			rank = first + i + 1;
+		}
+
+		const auto &character = characters.at(entry.guid);
+		const auto voc = g_vocations().getVocation(character.vocation);
+		const uint8_t clientVocation = voc ? voc->getClientId() : 0;
+		result.characters.emplace_back(character.name, entry.points, entry.guid, static_cast<uint32_t>(rank), static_cast<uint16_t>(character.level), clientVocation);
+	}
+	return result;
+}
+
+std::optional<Highscores::Page> Highscores::getOurPage(uint8_t category, uint32_t vocation, uint32_t guid, uint8_t entriesPerPage) const {
+	if (category >= CATEGORY_COUNT || entriesPerPage == 0) {
+		return std::nullopt;
+	}
+
+	uint16_t page = 1;
+	if (const auto it = characters.find(guid); it != characters.end()) {
+		const Leaderboard::Entry entry { it->second.points[category], guid, getGroup(it->second.vocation) };
+		if (const auto position = boards[category].getPosition(entry, getFilterGroup(vocation))) {
+			page = static_cast<uint16_t>(*position / entriesPerPage + 1);
+		}
+	}
+	return getPage(category, vocation, page, entriesPerPage);
+}
+
+uint8_t Highscores::getGroup(uint16_t vocationId) {
+	const auto vocation = g_vocations().getVocation(vocationId);
+	if (!vocation || vocation->getFromVocation() >= Leaderboard::ALL_GROUPS) {
+		return VOCATION_NONE;
+	}
+	return static_cast<uint8_t>(vocation->getFromVocation());
+}
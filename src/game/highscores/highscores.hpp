@@ -0,0 +1,100 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "creatures/creatures_definitions.hpp"
+#include "creatures/players/highscore_category.hpp"
+#include "game/highscores/leaderboard.hpp"
+#include "lib/di/container.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "server/server_definitions.hpp"
+
+class Player;
+
+// A leaderboard per highscore category, from experience to magic level, holding every character below the gamemaster group.
+// Online players update their entries as they gain or lose points, offline characters are reconciled against the
+// database every RECONCILE_INTERVAL. Only touched from the dispatcher, after being loaded at startup.
+class Highscores {
+public:
+	static constexpr size_t CATEGORY_COUNT = 9;
+	static constexpr uint32_t ALL_VOCATIONS = 0xFFFFFFFF;
+	static constexpr std::chrono::minutes RECONCILE_INTERVAL { 10 };
+
+	struct Character {
+		std::string name;
+		uint32_t level = 0;
+		uint16_t vocation = 0;
+		std::array<uint64_t, CATEGORY_COUNT> points {};
+	};
+
+	struct Page {
+		std::vector<HighscoreCharacter> characters;
+		uint16_t page = 0;
+		uint16_t pages = 0;
+	};
+
+	explicit Highscores(ThreadPool &threadPool) :
+		threadPool(threadPool) { }
+
+	// Singleton - ensures we don't accidentally copy it
+	Highscores(const Highscores &) = delete;
+	void operator=(const Highscores &) = delete;
+
+	static Highscores &getInstance() {
+		return inject<Highscores>();
+	}
+
+	void load();
+	// Loads the characters on the thread pool, then applies them on the dispatcher
+	void reconcile();
+
+	// Rebuilds the whole character, on login, logout and death
+	void updatePlayer(const std::shared_ptr<Player> &player);
+	// Moves the character on the one board whose points changed, falls back to a rebuild when the character is not
+	// on the boards yet or its vocation changed
+	void updatePlayer(const std::shared_ptr<Player> &player, HighscoreCategories_t category);
+	// The board of a fighting skill or the magic level
+	static HighscoreCategories_t getSkillCategory(skills_t skill) {
+		if (skill == SKILL_MAGLEVEL) {
+			return HighscoreCategories_t::MAGIC_LEVEL;
+		}
+		return static_cast<HighscoreCategories_t>(static_cast<uint8_t>(HighscoreCategories_t::FIST_FIGHTING) + skill);
+	}
+	void setCharacter(uint32_t guid, Character character);
+	void removeCharacter(uint32_t guid);
+
+	std::optional<Page> getPage(uint8_t category, uint32_t vocation, uint16_t page, uint8_t entriesPerPage) const;
+	// The page holding the character, the first one if it is not on the board
+	std::optional<Page> getOurPage(uint8_t category, uint32_t vocation, uint32_t guid, uint8_t entriesPerPage) const;
+
+	size_t size() const {
+		return characters.size();
+	}
+
+private:
+	using CharacterList = std::vector<std::pair<uint32_t, Character>>;
+
+	static CharacterList loadCharacters();
+	static uint8_t getGroup(uint16_t vocationId);
+	static uint8_t getFilterGroup(uint32_t vocation) {
+		return vocation >= Leaderboard::ALL_GROUPS ? Leaderboard::ALL_GROUPS : static_cast<uint8_t>(vocation);
+	}
+
+	void applyReconcile(const CharacterList &loaded, uint64_t snapshot);
+
+	ThreadPool &threadPool;
+	std::unordered_map<uint32_t, Character> characters;
+	// Bumped by every live update, a reconcile leaves alone the characters updated after its load started
+	uint64_t revision = 0;
+	std::unordered_map<uint32_t, uint64_t> updatedAt;
+	std::array<Leaderboard, CATEGORY_COUNT> boards;
+};
+
+constexpr auto g_highscores = Highscores::getInstance;
@@ -0,0 +1,238 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "game/highscores/leaderboard.hpp"
+
+void Leaderboard::assign(std::vector<Entry> entries) {
+	std::sort(entries.begin(), entries.end());
+	blocks.clear();
+	trees.assign(1, {});
+
+	uint8_t groupCount = 0;
+	for (const auto &entry : entries) {
+		groupCount = std::max<uint8_t>(groupCount, entry.group + 1);
+	}
+
+	// Blocks start half full, so the first inserts do not split them
+	constexpr size_t fill = BLOCK_CAPACITY / 2;
+	for (size_t first = 0; first < entries.size(); first += fill) {
+		const auto last = std::min(entries.size(), first + fill);
+		auto &block = blocks.emplace_back();
+		block.entries.assign(entries.begin() + first, entries.begin() + last);
+		block.groupCounts.assign(groupCount, 0);
+		for (const auto &entry : block.entries) {
+			++block.groupCounts[entry.group];
+		}
+	}
+
+	trees.resize(static_cast<size_t>(groupCount) + 1);
+	rebuildTrees();
+}
+
+void Leaderboard::insert(const Entry &entry) {
+	ensureGroup(entry.group);
+	if (blocks.empty()) {
+		auto &block = blocks.emplace_back();
+		block.entries.push_back(entry);
+		block.groupCounts.assign(trees.size() - 1, 0);
+		++block.groupCounts[entry.group];
+		rebuildTrees();
+		return;
+	}
+
+	auto blockIndex = std::min(findBlock(entry), blocks.size() - 1);
+	auto &block = blocks[blockIndex];
+	block.entries.insert(std::upper_bound(block.entries.begin(), block.entries.end(), entry), entry);
+	++block.groupCounts[entry.group];
+	if (block.entries.size() <= BLOCK_CAPACITY) {
+		addToTrees(blockIndex, entry, 1);
+		return;
+	}
+
+	Block upper;
+	upper.entries.assign(block.entries.begin() + block.entries.size() / 2, block.entries.end());
+	block.entries.resize(block.entries.size() / 2);
+	upper.groupCounts.assign(block.groupCounts.size(), 0);
+	for (const auto &moved : upper.entries) {
+		++upper.groupCounts[moved.group];
+		--block.groupCounts[moved.group];
+	}
+	blocks.insert(blocks.begin() + static_cast<std::ptrdiff_t>(blockIndex) + 1, std::move(upper));
+	rebuildTrees();
+}
+
+bool Leaderboard::erase(const Entry &entry) {
+	const auto blockIndex = findBlock(entry);
+	if (blockIndex == blocks.size()) {
+		return false;
+	}
+
+	auto &block = blocks[blockIndex];
+	const auto it = std::lower_bound(block.entries.begin(), block.entries.end(), entry);
+	if (it == block.entries.end() || it->guid != entry.guid || it->points != entry.points) {
+		return false;
+	}
+
+	const auto erased = *it;
+	block.entries.erase(it);
+	--block.groupCounts[erased.group];
+	if (block.entries.empty()) {
+		blocks.erase(blocks.begin() + static_cast<std::ptrdiff_t>(blockIndex));
+		rebuildTrees();
+	} else {
+		addToTrees(blockIndex, erased, -1);
+	}
+	return true;
+}
+
+std::optional<size_t> Leaderboard::getPosition(const Entry &entry, uint8_t group) const {
+	const auto blockIndex = findBlock(entry);
+	if (blockIndex == blocks.size() || !matches(entry, group)) {
+		return std::nullopt;
+	}
+
+	const auto &block = blocks[blockIndex];
+	const auto it = std::lower_bound(block.entries.begin(), block.entries.end(), entry);
+	if (it == block.entries.end() || it->guid != entry.guid || it->points != entry.points) {
+		return std::nullopt;
+	}
+
+	const auto index = static_cast<size_t>(std::distance(block.entries.begin(), it));
+	return countBefore(blockIndex, group) + countInBlock(block, index, group);
+}
+
+size_t Leaderboard::getRank(uint64_t points, uint8_t group) const {
+	// Guid 0 ranks ahead of every character with the same points
+	const Entry first { points, 0, 0 };
+	const auto blockIndex = findBlock(first);
+	if (blockIndex == blocks.size()) {
+		return size(group) + 1;
+	}
+
+	const auto &block = blocks[blockIndex];
+	const auto index = static_cast<size_t>(std::distance(block.entries.begin(), std::lower_bound(block.entries.begin(), block.entries.end(), first)));
+	return countBefore(blockIndex, group) + countInBlock(block, index, group) + 1;
+}
+
+std::vector<Leaderboard::Entry> Leaderboard::getRange(size_t first, size_t count, uint8_t group) const {
+	std::vector<Entry> result;
+	const auto treeIndex = getTreeIndex(group);
+	if (count == 0 || treeIndex >= trees.size() || first >= size(group)) {
+		return result;
+	}
+
+	// Fenwick descent to the block holding the first entry
+	const auto &tree = trees[treeIndex];
+	size_t blockIndex = 0;
+	auto remaining = first;
+	for (size_t step = std::bit_floor(blocks.size()); step > 0; step >>= 1) {
+		if (blockIndex + step <= blocks.size() && tree[blockIndex + step] <= remaining) {
+			blockIndex += step;
+			remaining -= tree[blockIndex];
+		}
+	}
+
+	result.reserve(count);
+	for (; blockIndex < blocks.size() && result.size() < count; ++blockIndex) {
+		for (const auto &entry : blocks[blockIndex].entries) {
+			if (!matches(entry, group)) {
+				continue;
+			}
+			if (remaining > 0) {
+				--remaining;
+				continue;
+			}
+			result.push_back(entry);
+			if (result.size() == count) {
+				break;
+			}
+		}
+	}
+	return result;
+}
+
+size_t Leaderboard::size(uint8_t group) const {
+	return countBefore(blocks.size(), group);
+}
+
+size_t Leaderboard::findBlock(const Entry &entry) const {
+	const auto it = std::ranges::partition_point(blocks, [&entry](const Block &block) {
+		return block.entries.back() < entry;
+	});
+	return static_cast<size_t>(std::distance(blocks.begin(), it));
+}
+
+size_t Leaderboard::countInBlock(const Block &block, size_t end, uint8_t group) const {
+	if (group == ALL_GROUPS) {
+		return end;
+	}
+
+	size_t count = 0;
+	for (size_t i = 0; i < end; ++i) {
+		count += block.entries[i].group == group ? 1 : 0;
+	}
+	return count;
+}
+
+size_t Leaderboard::countBefore(size_t blockIndex, uint8_t group) const {
+	const auto treeIndex = getTreeIndex(group);
+	if (treeIndex >= trees.size()) {
+		return 0;
+	}
+
+	const auto &tree = trees[treeIndex];
+	size_t count = 0;
+	for (auto i = blockIndex; i > 0; i &= i - 1) {
+		count += tree[i];
+	}
+	return count;
+}
+
+void Leaderboard::addToTrees(size_t blockIndex, const Entry &entry, int32_t delta) {
+	for (const auto treeIndex : { getTreeIndex(ALL_GROUPS), getTreeIndex(entry.group) }) {
+		auto &tree = trees[treeIndex];
+		for (auto i = blockIndex + 1; i < tree.size(); i += i & (~i + 1)) {
+			tree[i] += static_cast<uint32_t>(delta);
+		}
+	}
+}
+
+void Leaderboard::ensureGroup(uint8_t group) {
+	const auto treeCount = static_cast<size_t>(group) + 2;
+	if (trees.size() >= treeCount) {
+		return;
+	}
+
+	trees.resize(treeCount);
+	for (auto &block : blocks) {
+		block.groupCounts.resize(treeCount - 1, 0);
+	}
+	rebuildTrees();
+}
+
+void Leaderboard::rebuildTrees() {
+	if (trees.empty()) {
+		trees.resize(1);
+	}
+
+	for (size_t treeIndex = 0; treeIndex < trees.size(); ++treeIndex) {
+		auto &tree = trees[treeIndex];
+		tree.assign(blocks.size() + 1, 0);
+		for (size_t i = 1; i <= blocks.size(); ++i) {
+			const auto &block = blocks[i - 1];
+			tree[i] += treeIndex == 0 ? static_cast<uint32_t>(block.entries.size()) : block.groupCounts[treeIndex - 1];
+			// Linear build, each node hands its sum to its parent
+			if (const auto parent = i + (i & (~i + 1)); parent <= blocks.size()) {
+				tree[parent] += tree[i];
+			}
+		}
+	}
+}
@@ -0,0 +1,72 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+// Characters ranked by points, highest first and lowest guid first on ties, filterable by vocation group.
+// Entries are kept sorted in blocks of at most BLOCK_CAPACITY, with a Fenwick tree over the block sizes
+// (one for every entry and one per group), so positions, ranks and pages cost O(log n) plus one block scan.
+class Leaderboard {
+public:
+	static constexpr size_t BLOCK_CAPACITY = 512;
+	static constexpr uint8_t ALL_GROUPS = 0xFF;
+
+	struct Entry {
+		uint64_t points = 0;
+		uint32_t guid = 0;
+		uint8_t group = 0;
+
+		// Ranks ahead of the other entry
+		bool operator<(const Entry &other) const {
+			return points != other.points ? points > other.points : guid < other.guid;
+		}
+	};
+
+	void assign(std::vector<Entry> entries);
+	void insert(const Entry &entry);
+	bool erase(const Entry &entry);
+
+	// Entries of the group ahead of this one, nullopt if it is not on the board
+	std::optional<size_t> getPosition(const Entry &entry, uint8_t group = ALL_GROUPS) const;
+	// 1 + entries of the group with more points, ties share their rank
+	size_t getRank(uint64_t points, uint8_t group = ALL_GROUPS) const;
+	std::vector<Entry> getRange(size_t first, size_t count, uint8_t group = ALL_GROUPS) const;
+	size_t size(uint8_t group = ALL_GROUPS) const;
+
+	size_t getBlockCount() const {
+		return blocks.size();
+	}
+
+private:
+	struct Block {
+		std::vector<Entry> entries;
+		std::vector<uint32_t> groupCounts;
+	};
+
+	static bool matches(const Entry &entry, uint8_t group) {
+		return group == ALL_GROUPS || entry.group == group;
+	}
+
+	// Index 0 counts every entry, index group + 1 counts the group
+	static size_t getTreeIndex(uint8_t group) {
+		return group == ALL_GROUPS ? 0 : static_cast<size_t>(group) + 1;
+	}
+
+	// First block whose last entry does not rank ahead of the entry, blocks.size() if there is none
+	size_t findBlock(const Entry &entry) const;
+	size_t countInBlock(const Block &block, size_t end, uint8_t group) const;
+	// Entries of the group in the blocks before the given one
+	size_t countBefore(size_t blockIndex, uint8_t group) const;
+	void addToTrees(size_t blockIndex, const Entry &entry, int32_t delta);
+	void ensureGroup(uint8_t group);
+	void rebuildTrees();
+
+	std::vector<Block> blocks;
+	std::vector<std::vector<uint32_t>> trees;
+};
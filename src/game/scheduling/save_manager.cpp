@@ -3,6 +3,7 @@
 #include "game/game.hpp"
 #include "game/scheduling/save_manager.hpp"
 #include "io/iologindata.hpp"
+#include "io/iomarket.hpp"
 
 SaveManager::SaveManager(ThreadPool &threadPool, KVStore &kvStore, Logger &logger, Game &game) :
 	threadPool(threadPool), kv(kvStore), logger(logger), game(game) { }
@@ -28,6 +29,7 @@ void SaveManager::saveAll() {
 
 	saveMap();
 	saveKV();
+	saveMarket();
 	logger.info("Server saved in {} milliseconds.", bm_saveAll.duration());
 }
 
@@ -151,3 +153,12 @@ void SaveManager::saveKV() {
 	auto duration = bm_saveKV.duration();
 	logger.debug("Key-value store saved in {} milliseconds.", duration);
 }
+
+void SaveManager::saveMarket() {
+	Benchmark bm_saveMarket;
+	logger.debug("Saving market...");
+	const auto written = IOMarket::getInstance().flushWrites();
+
+	auto duration = bm_saveMarket.duration();
+	logger.debug("Market saved in {} milliseconds, {} queued writes.", duration, written);
+}
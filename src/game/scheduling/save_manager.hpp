@@ -30,6 +30,7 @@ public:
 private:
 	void saveMap();
 	void saveKV();
+	void saveMarket();
 
 	void schedulePlayer(std::weak_ptr<Player> player);
 	bool doSavePlayer(std::shared_ptr<Player> player);
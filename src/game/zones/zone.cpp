@@ -18,18 +18,98 @@
 
 phmap::parallel_flat_hash_map<std::string, std::shared_ptr<Zone>> Zone::zones = {};
 phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Zone>> Zone::zonesByID = {};
+std::shared_mutex Zone::indexMutex;
+std::vector<Zone::IndexedZone> Zone::indexedZones;
+phmap::flat_hash_map<uint64_t, std::vector<Zone::IndexedArea>> Zone::sectorIndex;
+std::vector<Zone::IndexedArea> Zone::largeAreas;
+bool Zone::indexDirty = true;
 const static std::shared_ptr<Zone> nullZone = nullptr;
 
+namespace {
+	Area normalized(const Area &area) {
+		return Area(
+			Position(std::min(area.from.x, area.to.x), std::min(area.from.y, area.to.y), std::min(area.from.z, area.to.z)),
+			Position(std::max(area.from.x, area.to.x), std::max(area.from.y, area.to.y), std::max(area.from.z, area.to.z))
+		);
+	}
+
+	// Splits what is left of area once cut is taken out of it in up to six boxes: below and above cut on z, then
+	// before and after it on y, then before and after it on x
+	void subtractBox(const Area &area, const Area &cut, std::vector<Area> &result) {
+		if (!area.intersects(cut)) {
+			result.push_back(area);
+			return;
+		}
+
+		const auto &from = area.from;
+		const auto &to = area.to;
+		if (from.z < cut.from.z) {
+			result.emplace_back(from, Position(to.x, to.y, cut.from.z - 1));
+		}
+		if (to.z > cut.to.z) {
+			result.emplace_back(Position(from.x, from.y, cut.to.z + 1), to);
+		}
+
+		const uint8_t minZ = std::max(from.z, cut.from.z);
+		const uint8_t maxZ = std::min(to.z, cut.to.z);
+		if (from.y < cut.from.y) {
+			result.emplace_back(Position(from.x, from.y, minZ), Position(to.x, cut.from.y - 1, maxZ));
+		}
+		if (to.y > cut.to.y) {
+			result.emplace_back(Position(from.x, cut.to.y + 1, minZ), Position(to.x, to.y, maxZ));
+		}
+
+		const uint16_t minY = std::max(from.y, cut.from.y);
+		const uint16_t maxY = std::min(to.y, cut.to.y);
+		if (from.x < cut.from.x) {
+			result.emplace_back(Position(from.x, minY, minZ), Position(cut.from.x - 1, maxY, maxZ));
+		}
+		if (to.x > cut.to.x) {
+			result.emplace_back(Position(cut.to.x + 1, minY, minZ), Position(to.x, maxY, maxZ));
+		}
+	}
+}
+
+template <typename Visit>
+void Zone::visitIndexedAreas(const Position &position, Visit &&visit) {
+	std::shared_lock sharedLock(indexMutex);
+	while (indexDirty) {
+		sharedLock.unlock();
+		{
+			std::unique_lock lock(indexMutex);
+			if (indexDirty) {
+				rebuildIndex();
+			}
+		}
+		sharedLock.lock();
+	}
+
+	const auto visitAreas = [&position, &visit](const std::vector<IndexedArea> &indexedAreas) {
+		for (const auto &[area, zoneIndex] : indexedAreas) {
+			if (area.contains(position)) {
+				visit(zoneIndex);
+			}
+		}
+	};
+
+	if (const auto it = sectorIndex.find(getIndexSectorKey(position.x, position.y, position.z)); it != sectorIndex.end()) {
+		visitAreas(it->second);
+	}
+	visitAreas(largeAreas);
+}
+
 std::shared_ptr<Zone> Zone::addZone(const std::string &name, uint32_t zoneID /* = 0 */) {
 	if (name == "default") {
 		g_logger().error("Zone name {} is reserved", name);
 		return nullZone;
 	}
+	std::unique_lock lock(indexMutex);
 	if (zoneID != 0 && zonesByID.contains(zoneID)) {
 		g_logger().trace("[Zone::addZone] Found with ID {} while adding {}, linking them together...", zoneID, name);
 		auto zone = zonesByID[zoneID];
 		zone->name = name;
 		zones[name] = zone;
+		indexDirty = true;
 		return zone;
 	}
 
@@ -38,6 +118,7 @@ std::shared_ptr<Zone> Zone::addZone(const std::string &name, uint32_t zoneID /*
 		return nullZone;
 	}
 	zones[name] = std::make_shared<Zone>(name, zoneID);
+	indexDirty = true;
 	if (zoneID != 0) {
 		zonesByID[zoneID] = zones[name];
 	}
@@ -45,21 +126,102 @@ std::shared_ptr<Zone> Zone::addZone(const std::string &name, uint32_t zoneID /*
 }
 
 void Zone::addArea(Area area) {
-	for (const auto &pos : area) {
-		addPosition(pos);
+	{
+		std::unique_lock lock(indexMutex);
+		compactLastArea();
+		areas.push_back(normalized(area));
+		indexDirty = true;
 	}
 	refresh();
 }
 
 void Zone::subtractArea(Area area) {
-	for (const auto &pos : area) {
-		removePosition(pos);
+	const auto cut = normalized(area);
+	std::vector<Area> remaining;
+	remaining.reserve(areas.size());
+	for (const auto &current : areas) {
+		subtractBox(current, cut, remaining);
+	}
+	{
+		std::unique_lock lock(indexMutex);
+		areas = std::move(remaining);
+		indexDirty = true;
 	}
 	refresh();
 }
 
+void Zone::addPosition(const Position &position) {
+	std::unique_lock lock(indexMutex);
+	if (!areas.empty()) {
+		auto &last = areas.back();
+		if (last.contains(position)) {
+			return;
+		}
+
+		if (last.from.z == position.z && last.to.z == position.z) {
+			if (last.from.y == position.y && last.to.y == position.y && last.to.x + 1 == position.x) {
+				last.to.x = position.x;
+				compactLastArea();
+				indexDirty = true;
+				return;
+			}
+			if (last.from.x == position.x && last.to.x == position.x && last.to.y + 1 == position.y) {
+				last.to.y = position.y;
+				compactLastArea();
+				indexDirty = true;
+				return;
+			}
+		}
+	}
+
+	compactLastArea();
+	areas.emplace_back(position, position);
+	indexDirty = true;
+}
+
+void Zone::removePosition(const Position &position) {
+	const Area cut(position, position);
+	if (std::ranges::none_of(areas, [&cut](const Area &area) { return area.intersects(cut); })) {
+		return;
+	}
+
+	std::vector<Area> remaining;
+	remaining.reserve(areas.size() + 3);
+	for (const auto &current : areas) {
+		subtractBox(current, cut, remaining);
+	}
+	std::unique_lock lock(indexMutex);
+	areas = std::move(remaining);
+	indexDirty = true;
+}
+
+void Zone::compactLastArea() {
+	// Rows (or columns) of tiles added one after the other become a single rectangle
+	if (areas.size() < 2) {
+		return;
+	}
+
+	auto &previous = areas[areas.size() - 2];
+	const auto &last = areas.back();
+	if (previous.from.z != last.from.z || previous.to.z != last.to.z) {
+		return;
+	}
+
+	if (previous.from.x == last.from.x && previous.to.x == last.to.x && previous.to.y + 1 == last.from.y) {
+		previous.to.y = last.to.y;
+		areas.pop_back();
+	} else if (previous.from.y == last.from.y && previous.to.y == last.to.y && previous.to.x + 1 == last.from.x) {
+		previous.to.x = last.to.x;
+		areas.pop_back();
+	}
+}
+
 bool Zone::contains(const Position &pos) const {
-	return positions.contains(pos);
+	bool found = false;
+	visitIndexedAreas(pos, [this, &found](uint32_t zoneIndex) {
+		found = found || indexedZones[zoneIndex].zone.get() == this;
+	});
+	return found;
 }
 
 Position Zone::getRemoveDestination(const std::shared_ptr<Creature> &creature /* = nullptr */) const {
@@ -76,7 +238,8 @@ Position Zone::getRemoveDestination(const std::shared_ptr<Creature> &creature /*
 }
 
 std::shared_ptr<Zone> Zone::getZone(const std::string &name) {
-	return zones[name];
+	const auto it = zones.find(name);
+	return it != zones.end() ? it->second : nullZone;
 }
 
 std::shared_ptr<Zone> Zone::getZone(uint32_t zoneID) {
@@ -87,14 +250,22 @@ std::shared_ptr<Zone> Zone::getZone(uint32_t zoneID) {
 		return zonesByID[zoneID];
 	}
 	auto zone = std::make_shared<Zone>(zoneID);
+	std::unique_lock lock(indexMutex);
 	zonesByID[zoneID] = zone;
 	return zone;
 }
 
 std::vector<Position> Zone::getPositions() const {
 	std::vector<Position> result;
-	for (const auto &pos : positions) {
-		result.push_back(pos);
+	for (const auto &area : areas) {
+		for (const auto &pos : area) {
+			result.push_back(pos);
+		}
+	}
+	// Areas added from scripts may overlap
+	if (areas.size() > 1) {
+		std::sort(result.begin(), result.end());
+		result.erase(std::unique(result.begin(), result.end()), result.end());
 	}
 	return result;
 }
@@ -145,24 +316,69 @@ void Zone::clearZones() {
 		}
 		zone->refresh();
 	}
+	std::unique_lock lock(indexMutex);
 	zones.clear();
 	for (const auto &[_, zone] : zonesByID) {
 		zones[zone->name] = zone;
 	}
+	indexDirty = true;
 }
 
-std::vector<std::shared_ptr<Zone>> Zone::getZones(const Position position) {
-	Benchmark bm_getZones;
-	std::vector<std::shared_ptr<Zone>> result;
-	for (const auto &[_, zone] : zones) {
-		if (zone && zone->contains(position)) {
-			result.push_back(zone);
+void Zone::rebuildIndex() {
+	Benchmark bm_rebuild;
+	indexedZones.clear();
+	sectorIndex.clear();
+	largeAreas.clear();
+
+	size_t indexedAreas = 0;
+	phmap::flat_hash_set<const Zone*> seen;
+	const auto indexZone = [&](const std::shared_ptr<Zone> &zone, bool listed) {
+		if (!zone || zone->areas.empty() || !seen.insert(zone.get()).second) {
+			return;
+		}
+
+		const auto zoneIndex = static_cast<uint32_t>(indexedZones.size());
+		indexedZones.push_back({ zone, listed });
+		for (const auto &area : zone->areas) {
+			const uint32_t sectorsX = (area.to.x >> INDEX_SECTOR_BITS) - (area.from.x >> INDEX_SECTOR_BITS) + 1;
+			const uint32_t sectorsY = (area.to.y >> INDEX_SECTOR_BITS) - (area.from.y >> INDEX_SECTOR_BITS) + 1;
+			const uint32_t floors = area.to.z - area.from.z + 1;
+			if (static_cast<size_t>(sectorsX) * sectorsY * floors > INDEX_MAX_AREA_SECTORS) {
+				largeAreas.push_back({ area, zoneIndex });
+				continue;
+			}
+
+			for (uint32_t z = area.from.z; z <= area.to.z; ++z) {
+				for (uint32_t y = area.from.y >> INDEX_SECTOR_BITS; y <= static_cast<uint32_t>(area.to.y >> INDEX_SECTOR_BITS); ++y) {
+					for (uint32_t x = area.from.x >> INDEX_SECTOR_BITS; x <= static_cast<uint32_t>(area.to.x >> INDEX_SECTOR_BITS); ++x) {
+						sectorIndex[getIndexSectorKey(x << INDEX_SECTOR_BITS, y << INDEX_SECTOR_BITS, z)].push_back({ area, zoneIndex });
+						++indexedAreas;
+					}
+				}
+			}
 		}
+	};
+
+	for (const auto &[_, zone] : zones) {
+		indexZone(zone, true);
 	}
-	auto duration = bm_getZones.duration();
-	if (duration > 100) {
-		g_logger().warn("Listed {} zones for position {} in {} milliseconds", result.size(), position.toString(), duration);
+	for (const auto &[_, zone] : zonesByID) {
+		indexZone(zone, false);
 	}
+
+	indexDirty = false;
+	g_logger().trace("Indexed {} zones in {} sectors ({} entries, {} large areas) in {} milliseconds", indexedZones.size(), sectorIndex.size(), indexedAreas, largeAreas.size(), bm_rebuild.duration());
+}
+
+std::vector<std::shared_ptr<Zone>> Zone::getZones(const Position &position) {
+	std::vector<std::shared_ptr<Zone>> result;
+	visitIndexedAreas(position, [&result](uint32_t zoneIndex) {
+		// A zone with several areas around the position is listed once
+		const auto &[zone, listed] = indexedZones[zoneIndex];
+		if (listed && std::ranges::find(result, zone) == result.end()) {
+			result.push_back(zone);
+		}
+	});
 	return result;
 }
 
@@ -157,11 +157,10 @@ public:
 	}
 	void addArea(Area area);
 	void subtractArea(Area area);
-	void addPosition(const Position &position) {
-		positions.emplace(position);
-	}
-	void removePosition(const Position &position) {
-		positions.erase(position);
+	void addPosition(const Position &position);
+	void removePosition(const Position &position);
+	const std::vector<Area> &getAreas() const {
+		return areas;
 	}
 	Position getRemoveDestination(const std::shared_ptr<Creature> &creature = nullptr) const;
 	void setRemoveDestination(const Position &position) {
@@ -199,7 +198,7 @@ public:
 	static std::shared_ptr<Zone> addZone(const std::string &name, uint32_t id = 0);
 	static std::shared_ptr<Zone> getZone(const std::string &name);
 	static std::shared_ptr<Zone> getZone(uint32_t id);
-	static std::vector<std::shared_ptr<Zone>> getZones(const Position position);
+	static std::vector<std::shared_ptr<Zone>> getZones(const Position &position);
 	static std::vector<std::shared_ptr<Zone>> getZones();
 	static void refreshAll() {
 		for (const auto &[_, zone] : zones) {
@@ -212,11 +211,19 @@ public:
 
 protected:
 	bool contains(const Position &position) const;
+	void compactLastArea();
+
+	// Calls visit(area, zone) for each indexed area holding the position, rebuilding the index first if needed
+	template <typename Visit>
+	static void visitIndexedAreas(const Position &position, Visit &&visit);
+	// The index lock must be held exclusively
+	static void rebuildIndex();
 
 	Position removeDestination = Position();
 	std::string name;
 	std::string monsterVariant;
-	std::unordered_set<Position> positions;
+	// Covered tiles as rectangles, tiles added one by one (map zones) are merged into the last one when adjacent
+	std::vector<Area> areas;
 	uint32_t id = 0; // ID 0 is used in zones created dynamically from lua. The map editor uses IDs starting from 1 (automatically generated).
 
 	weak::set<Item> itemsCache;
@@ -227,4 +234,34 @@ protected:
 
 	static phmap::parallel_flat_hash_map<std::string, std::shared_ptr<Zone>> zones;
 	static phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Zone>> zonesByID;
+
+	// Spatial index of the zone areas, by sectors of INDEX_SECTOR_SIZE x INDEX_SECTOR_SIZE tiles of a floor.
+	// Areas covering more than INDEX_MAX_AREA_SECTORS sectors are kept apart and checked on every lookup instead.
+	// Rebuilt on the first lookup after any zone or area change. Lookups also come from the pathfinding threads
+	// (through Map::getTile), so changes to the zones or their areas and the rebuild hold indexMutex exclusively
+	// and lookups hold it shared.
+	static constexpr int32_t INDEX_SECTOR_BITS = 5;
+	static constexpr int32_t INDEX_SECTOR_SIZE = 1 << INDEX_SECTOR_BITS;
+	static constexpr size_t INDEX_MAX_AREA_SECTORS = 256;
+
+	struct IndexedArea {
+		Area area;
+		uint32_t zoneIndex;
+	};
+
+	struct IndexedZone {
+		std::shared_ptr<Zone> zone;
+		// Zones known only by id are indexed for contains, but not listed by getZones
+		bool listed;
+	};
+
+	static constexpr uint64_t getIndexSectorKey(uint16_t x, uint16_t y, uint8_t z) {
+		return static_cast<uint64_t>(x >> INDEX_SECTOR_BITS) | (static_cast<uint64_t>(y >> INDEX_SECTOR_BITS) << 16) | (static_cast<uint64_t>(z) << 32);
+	}
+
+	static std::shared_mutex indexMutex;
+	static std::vector<IndexedZone> indexedZones;
+	static phmap::flat_hash_map<uint64_t, std::vector<IndexedArea>> sectorIndex;
+	static std::vector<IndexedArea> largeAreas;
+	static bool indexDirty;
 };
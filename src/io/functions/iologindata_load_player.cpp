@@ -12,6 +12,7 @@
 #include "creatures/players/wheel/player_wheel.hpp"
 #include "creatures/players/achievement/player_achievement.hpp"
 #include "io/functions/iologindata_load_player.hpp"
+#include "io/io_name_cache.hpp"
 #include "game/game.hpp"
 #include "enums/object_category.hpp"
 #include "enums/account_coins.hpp"
@@ -113,6 +114,8 @@ bool IOLoginDataLoad::loadPlayerFirst(std::shared_ptr<Player> player, DBResult_p
 
 	player->setGUID(result->getNumber<uint32_t>("id"));
 	player->name = result->getString("name");
+	// Freshly read from the database, refreshes the cached name
+	g_nameCache().setPlayer(player->getGUID(), player->name);
 
 	if (!player->getAccount()) {
 		player->setAccount(result->getNumber<uint32_t>("account_id"));
@@ -472,6 +472,12 @@ bool IOLoginDataSave::savePlayerItem(std::shared_ptr<Player> player) {
 	for (int32_t slotId = CONST_SLOT_FIRST; slotId <= CONST_SLOT_LAST; ++slotId) {
 		std::shared_ptr<Item> item = player->inventory[slotId];
 		if (item) {
+#ifndef NDEBUG
+			// The save walks every item anyway, a good time to check the cached container counters
+			if (const auto &container = item->getContainer()) {
+				container->validateCachedAggregates();
+			}
+#endif
 			itemList.emplace_back(slotId, item);
 		}
 	}
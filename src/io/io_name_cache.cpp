@@ -0,0 +1,223 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "io/io_name_cache.hpp"
+
+#include "database/database.hpp"
+#include "lib/metrics/metrics.hpp"
+
+std::optional<uint32_t> NameIdMap::getId(const std::string &name, int64_t now) {
+	const auto it = idsByName.find(asLowerCaseString(name));
+	if (it == idsByName.end() || eraseExpired(it->second, now)) {
+		++stats.misses;
+		return std::nullopt;
+	}
+	++stats.hits;
+	touch(namesById.at(it->second));
+	return it->second;
+}
+
+std::optional<std::string> NameIdMap::getName(uint32_t id, int64_t now) {
+	eraseExpired(id, now);
+	const auto it = namesById.find(id);
+	if (it == namesById.end()) {
+		++stats.misses;
+		return std::nullopt;
+	}
+	++stats.hits;
+	touch(it->second);
+	return it->second.name;
+}
+
+void NameIdMap::set(uint32_t id, const std::string &name, int64_t now) {
+	erase(id);
+	if (namesById.size() >= capacity) {
+		evictLeastRecentlyUsed();
+	}
+
+	auto lowerName = asLowerCaseString(name);
+	// A name taken over by another id, the old id keeps no name
+	if (const auto it = idsByName.find(lowerName); it != idsByName.end()) {
+		if (const auto previous = namesById.find(it->second); previous != namesById.end()) {
+			recency.erase(previous->second.recent);
+			namesById.erase(previous);
+		}
+	}
+	idsByName[std::move(lowerName)] = id;
+	recency.push_front(id);
+	namesById[id] = { name, now, recency.begin() };
+}
+
+void NameIdMap::erase(uint32_t id) {
+	const auto it = namesById.find(id);
+	if (it == namesById.end()) {
+		return;
+	}
+	idsByName.erase(asLowerCaseString(it->second.name));
+	recency.erase(it->second.recent);
+	namesById.erase(it);
+}
+
+void NameIdMap::touch(Entry &entry) {
+	recency.splice(recency.begin(), recency, entry.recent);
+}
+
+void NameIdMap::evictLeastRecentlyUsed() {
+	const size_t batch = std::max<size_t>(1, capacity / EVICTION_DIVISOR);
+	for (size_t i = 0; i < batch && !recency.empty(); ++i) {
+		erase(recency.back());
+	}
+}
+
+bool NameIdMap::eraseExpired(uint32_t id, int64_t now) {
+	const auto it = namesById.find(id);
+	if (ttl == 0 || it == namesById.end() || now - it->second.addedAt < ttl) {
+		return false;
+	}
+	erase(id);
+	return true;
+}
+
+void NameIdMap::clear() {
+	idsByName.clear();
+	namesById.clear();
+	recency.clear();
+}
+
+std::unordered_map<std::string, uint32_t> IONameCache::resolve(NameIdMap &map, const std::vector<std::string> &names, std::string_view table) {
+	std::unordered_map<std::string, uint32_t> result;
+	std::unordered_set<std::string> seen;
+	std::vector<std::string> missing;
+	{
+		std::scoped_lock lock(mutex);
+		const auto now = OTSYS_TIME();
+		for (const auto &name : names) {
+			auto lowerName = asLowerCaseString(name);
+			if (!seen.insert(lowerName).second) {
+				continue;
+			}
+
+			if (const auto id = map.getId(lowerName, now)) {
+				result.emplace(std::move(lowerName), *id);
+			} else {
+				missing.push_back(std::move(lowerName));
+			}
+		}
+	}
+	publishLookups(table, result.size(), missing.size());
+
+	// The queries run without the lock, other lookups keep being served from the cache meanwhile
+	Database &db = Database::getInstance();
+	std::vector<std::pair<uint32_t, std::string>> found;
+	for (size_t first = 0; first < missing.size(); first += QUERY_CHUNK_SIZE) {
+		const auto last = std::min(missing.size(), first + QUERY_CHUNK_SIZE);
+		std::string query = fmt::format("SELECT `id`, `name` FROM `{}` WHERE `name` IN (", table);
+		for (size_t i = first; i < last; ++i) {
+			if (i != first) {
+				query += ',';
+			}
+			query += db.escapeString(missing[i]);
+		}
+		query += ')';
+
+		++queries;
+		const DBResult_ptr dbResult = db.storeQuery(query);
+		if (!dbResult) {
+			continue;
+		}
+
+		do {
+			const auto id = dbResult->getNumber<uint32_t>("id");
+			auto name = dbResult->getString("name");
+			result.emplace(asLowerCaseString(name), id);
+			found.emplace_back(id, std::move(name));
+		} while (dbResult->next());
+	}
+
+	if (!found.empty()) {
+		std::scoped_lock lock(mutex);
+		const auto now = OTSYS_TIME();
+		for (const auto &[id, name] : found) {
+			map.set(id, name, now);
+		}
+	}
+	return result;
+}
+
+std::unordered_map<std::string, uint32_t> IONameCache::resolvePlayers(const std::vector<std::string> &names) {
+	return resolve(players, names, "players");
+}
+
+std::unordered_map<std::string, uint32_t> IONameCache::resolveGuilds(const std::vector<std::string> &names) {
+	return resolve(guilds, names, "guilds");
+}
+
+uint32_t IONameCache::getPlayerGuid(const std::string &name) {
+	const auto result = resolvePlayers({ name });
+	const auto it = result.find(asLowerCaseString(name));
+	return it != result.end() ? it->second : 0;
+}
+
+std::string IONameCache::getPlayerName(uint32_t guid) {
+	{
+		std::scoped_lock lock(mutex);
+		if (auto name = players.getName(guid, OTSYS_TIME())) {
+			publishLookups("players", 1, 0);
+			return *name;
+		}
+	}
+
+	publishLookups("players", 0, 1);
+	++queries;
+	const DBResult_ptr result = Database::getInstance().storeQuery(fmt::format("SELECT `name` FROM `players` WHERE `id` = {}", guid));
+	if (!result) {
+		return std::string();
+	}
+
+	auto name = result->getString("name");
+	setPlayer(guid, name);
+	return name;
+}
+
+uint32_t IONameCache::getGuildId(const std::string &name) {
+	const auto result = resolveGuilds({ name });
+	const auto it = result.find(asLowerCaseString(name));
+	return it != result.end() ? it->second : 0;
+}
+
+void IONameCache::setPlayer(uint32_t guid, const std::string &name) {
+	std::scoped_lock lock(mutex);
+	players.set(guid, name, OTSYS_TIME());
+}
+
+void IONameCache::setGuild(uint32_t guildId, const std::string &name) {
+	std::scoped_lock lock(mutex);
+	guilds.set(guildId, name, OTSYS_TIME());
+}
+
+NameIdMap::Stats IONameCache::getPlayerStats() const {
+	std::scoped_lock lock(mutex);
+	return players.getStats();
+}
+
+NameIdMap::Stats IONameCache::getGuildStats() const {
+	std::scoped_lock lock(mutex);
+	return guilds.getStats();
+}
+
+void IONameCache::publishLookups(std::string_view table, uint64_t hits, uint64_t misses) {
+	if (hits != 0) {
+		g_metrics().addCounter("name_cache_lookups", static_cast<double>(hits), { { "cache", std::string(table) }, { "result", "hit" } });
+	}
+	if (misses != 0) {
+		g_metrics().addCounter("name_cache_lookups", static_cast<double>(misses), { { "cache", std::string(table) }, { "result", "miss" } });
+	}
+}
@@ -0,0 +1,120 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/di/container.hpp"
+
+// Id <-> name pairs, looked up by lower case name. Holds up to capacity pairs; once full, a batch of the least
+// recently used ones (1/EVICTION_DIVISOR of the capacity) makes room. Pairs older than ttl milliseconds count as
+// missing, a ttl of 0 keeps them until they are evicted.
+class NameIdMap {
+public:
+	static constexpr size_t EVICTION_DIVISOR = 64;
+
+	struct Stats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+
+		double getHitRate() const {
+			const auto lookups = hits + misses;
+			return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+		}
+	};
+
+	explicit NameIdMap(size_t capacity, int64_t ttl = 0) :
+		capacity(capacity), ttl(ttl) { }
+
+	std::optional<uint32_t> getId(const std::string &name, int64_t now);
+	std::optional<std::string> getName(uint32_t id, int64_t now);
+	void set(uint32_t id, const std::string &name, int64_t now);
+	void erase(uint32_t id);
+	void clear();
+
+	size_t size() const {
+		return namesById.size();
+	}
+	const Stats &getStats() const {
+		return stats;
+	}
+	double getHitRate() const {
+		return stats.getHitRate();
+	}
+
+private:
+	struct Entry {
+		std::string name;
+		int64_t addedAt;
+		// Position in recency, moved to the front on every hit
+		std::list<uint32_t>::iterator recent;
+	};
+
+	bool eraseExpired(uint32_t id, int64_t now);
+	void touch(Entry &entry);
+	void evictLeastRecentlyUsed();
+
+	size_t capacity;
+	int64_t ttl;
+	std::unordered_map<std::string, uint32_t> idsByName;
+	std::unordered_map<uint32_t, Entry> namesById;
+	// Ids from the most to the least recently used
+	std::list<uint32_t> recency;
+	Stats stats;
+};
+
+// Player and guild names resolved to their ids, shared by everything looking them up by name (house access lists,
+// guild lookups). Names missing from the cache are queried together, QUERY_CHUNK_SIZE per query.
+// Guilds are created, renamed and disbanded and characters deleted outside the server (website, account manager),
+// so cached pairs are queried again once they are older than NAME_TTL.
+class IONameCache {
+public:
+	static constexpr size_t CAPACITY = 50000;
+	static constexpr size_t QUERY_CHUNK_SIZE = 500;
+	static constexpr int64_t NAME_TTL = 10 * 60 * 1000;
+
+	IONameCache() = default;
+
+	// Singleton - ensures we don't accidentally copy it
+	IONameCache(const IONameCache &) = delete;
+	void operator=(const IONameCache &) = delete;
+
+	static IONameCache &getInstance() {
+		return inject<IONameCache>();
+	}
+
+	// Ids by lower case name, names that do not exist are left out
+	std::unordered_map<std::string, uint32_t> resolvePlayers(const std::vector<std::string> &names);
+	std::unordered_map<std::string, uint32_t> resolveGuilds(const std::vector<std::string> &names);
+
+	uint32_t getPlayerGuid(const std::string &name);
+	std::string getPlayerName(uint32_t guid);
+	uint32_t getGuildId(const std::string &name);
+
+	// Write through, for names the server changes or reads from the database itself
+	void setPlayer(uint32_t guid, const std::string &name);
+	void setGuild(uint32_t guildId, const std::string &name);
+
+	// Hits and misses are also published as the name_cache_lookups metric, by cache and result
+	NameIdMap::Stats getPlayerStats() const;
+	NameIdMap::Stats getGuildStats() const;
+	uint64_t getQueryCount() const {
+		return queries;
+	}
+
+private:
+	std::unordered_map<std::string, uint32_t> resolve(NameIdMap &map, const std::vector<std::string> &names, std::string_view table);
+	static void publishLookups(std::string_view table, uint64_t hits, uint64_t misses);
+
+	mutable std::mutex mutex;
+	NameIdMap players { CAPACITY, NAME_TTL };
+	NameIdMap guilds { CAPACITY, NAME_TTL };
+	std::atomic<uint64_t> queries = 0;
+};
+
+constexpr auto g_nameCache = IONameCache::getInstance;
@@ -12,6 +12,7 @@
 #include "database/database.hpp"
 #include "creatures/players/grouping/guild.hpp"
 #include "io/ioguild.hpp"
+#include "io/io_name_cache.hpp"
 
 std::shared_ptr<Guild> IOGuild::loadGuild(uint32_t guildId) {
 	Database &db = Database::getInstance();
@@ -20,6 +21,7 @@ std::shared_ptr<Guild> IOGuild::loadGuild(uint32_t guildId) {
 	if (DBResult_ptr result = db.storeQuery(query.str())) {
 		const auto guild = std::make_shared<Guild>(guildId, result->getString("name"));
 		guild->setBankBalance(result->getNumber<uint64_t>("balance"));
+		g_nameCache().setGuild(guildId, guild->getName());
 		query.str(std::string());
 		query << "SELECT `id`, `name`, `level` FROM `guild_ranks` WHERE `guild_id` = " << guildId;
 
@@ -46,16 +48,7 @@ void IOGuild::saveGuild(const std::shared_ptr<Guild> guild) {
 }
 
 uint32_t IOGuild::getGuildIdByName(const std::string &name) {
-	Database &db = Database::getInstance();
-
-	std::ostringstream query;
-	query << "SELECT `id` FROM `guilds` WHERE `name` = " << db.escapeString(name);
-
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
-		return 0;
-	}
-	return result->getNumber<uint32_t>("id");
+	return g_nameCache().getGuildId(name);
 }
 
 void IOGuild::getWarList(uint32_t guildId, GuildWarVector &guildWarVector) {
@@ -10,6 +10,7 @@
 #include "pch.hpp"
 
 #include "io/iologindata.hpp"
+#include "io/io_name_cache.hpp"
 #include "io/functions/iologindata_load_player.hpp"
 #include "io/functions/iologindata_save_player.hpp"
 #include "game/game.hpp"
@@ -279,25 +280,11 @@ bool IOLoginData::savePlayerGuard(std::shared_ptr<Player> player) {
 }
 
 std::string IOLoginData::getNameByGuid(uint32_t guid) {
-	std::ostringstream query;
-	query << "SELECT `name` FROM `players` WHERE `id` = " << guid;
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return std::string();
-	}
-	return result->getString("name");
+	return g_nameCache().getPlayerName(guid);
 }
 
 uint32_t IOLoginData::getGuidByName(const std::string &name) {
-	Database &db = Database::getInstance();
-
-	std::ostringstream query;
-	query << "SELECT `id` FROM `players` WHERE `name` = " << db.escapeString(name);
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
-		return 0;
-	}
-	return result->getNumber<uint32_t>("id");
+	return g_nameCache().getPlayerGuid(name);
 }
 
 bool IOLoginData::getGuidByNameEx(uint32_t &guid, bool &specialVip, std::string &name) {
@@ -11,6 +11,7 @@
 
 #include "io/iomapserialize.hpp"
 #include "io/iologindata.hpp"
+#include "io/io_name_cache.hpp"
 #include "game/game.hpp"
 #include "items/bed.hpp"
 
@@ -305,12 +306,27 @@ bool IOMapSerialize::loadHouseInfo() {
 
 	result = db.storeQuery("SELECT `house_id`, `listid`, `list` FROM `house_lists`");
 	if (result) {
+		Benchmark bm_lists;
+		const auto queries = g_nameCache().getQueryCount();
+		std::vector<std::tuple<std::shared_ptr<House>, uint32_t, std::string>> accessLists;
 		do {
 			const auto &house = g_game().map.houses.getHouse(result->getNumber<uint32_t>("house_id"));
 			if (house) {
-				house->setAccessList(result->getNumber<uint32_t>("listid"), result->getString("list"));
+				accessLists.emplace_back(house, result->getNumber<uint32_t>("listid"), result->getString("list"));
 			}
 		} while (result->next());
+
+		std::vector<std::string> lists;
+		lists.reserve(accessLists.size());
+		for (const auto &[house, listId, list] : accessLists) {
+			lists.push_back(list);
+		}
+		AccessList::resolveNames(lists);
+
+		for (const auto &[house, listId, list] : accessLists) {
+			house->setAccessList(listId, list);
+		}
+		g_logger().info("Loaded {} house access lists in {} milliseconds with {} name queries (name cache hit rate: players {:.1f}%, guilds {:.1f}%)", accessLists.size(), bm_lists.duration(), g_nameCache().getQueryCount() - queries, g_nameCache().getPlayerStats().getHitRate() * 100, g_nameCache().getGuildStats().getHitRate() * 100);
 	}
 	return true;
 }
@@ -10,7 +10,6 @@
 #include "pch.hpp"
 
 #include "io/iomarket.hpp"
-#include "database/databasetasks.hpp"
 #include "io/iologindata.hpp"
 #include "game/game.hpp"
 #include "game/scheduling/dispatcher.hpp"
@@ -26,92 +25,130 @@ uint8_t IOMarket::getTierFromDatabaseTable(const std::string &string) {
 	return tier;
 }
 
-MarketOfferList IOMarket::getActiveOffers(MarketAction_t action) {
-	MarketOfferList offerList;
+namespace {
+	MarketOffer toMarketOffer(const MarketOrderBook::Offer &offer, int32_t marketOfferDuration) {
+		MarketOffer marketOffer;
+		marketOffer.amount = offer.amount;
+		marketOffer.price = offer.price;
+		marketOffer.timestamp = offer.created + marketOfferDuration;
+		marketOffer.counter = offer.getCounter();
+		marketOffer.itemId = offer.itemId;
+		marketOffer.tier = offer.tier;
+		marketOffer.playerName = offer.anonymous ? "Anonymous" : offer.playerName;
+		return marketOffer;
+	}
 
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `tier`, `created`, `anonymous`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `sale` = " << action;
+	MarketOfferList toMarketOfferList(const std::vector<const MarketOrderBook::Offer*> &offers) {
+		const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
 
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+		MarketOfferList offerList;
+		for (const auto offer : offers) {
+			offerList.push_back(toMarketOffer(*offer, marketOfferDuration));
+		}
 		return offerList;
 	}
 
-	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+	constexpr std::string_view historyInsert = "INSERT INTO `market_history` (`player_id`, `sale`, `itemtype`, `amount`, `price`, `expires_at`, `inserted`, `state`, `tier`) VALUES ";
+	// Expired offers deleted per query
+	constexpr size_t EXPIRED_OFFERS_CHUNK_SIZE = 1000;
 
-	do {
-		MarketOffer offer;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		if (result->getNumber<uint16_t>("anonymous") == 0) {
-			offer.playerName = result->getString("player_name");
-		} else {
-			offer.playerName = "Anonymous";
-		}
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-		offerList.push_back(offer);
-	} while (result->next());
-	return offerList;
+	std::string historyRow(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state) {
+		std::ostringstream row;
+		row << playerId << ',' << type << ',' << itemId << ',' << amount << ',' << price << ','
+			<< timestamp << ',' << getTimeNow() << ',' << state << ',' << std::to_string(tier);
+		return row.str();
+	}
+
+	std::string historyQuery(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state) {
+		return fmt::format("{}({})", historyInsert, historyRow(playerId, type, itemId, amount, price, timestamp, tier, state));
+	}
 }
 
-MarketOfferList IOMarket::getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier) {
-	MarketOfferList offerList;
+void IOMarket::loadOffers() {
+	Benchmark bm_loadOffers;
+	const DBResult_ptr result = Database::getInstance().storeQuery("SELECT `market_offers`.`id`, `market_offers`.`player_id`, `market_offers`.`sale`, `market_offers`.`itemtype`, `market_offers`.`amount`, `market_offers`.`created`, `market_offers`.`anonymous`, `market_offers`.`price`, `market_offers`.`tier`, `players`.`name` AS `player_name` FROM `market_offers` LEFT JOIN `players` ON `players`.`id` = `market_offers`.`player_id`");
+	if (result) {
+		do {
+			MarketOrderBook::Offer offer;
+			offer.id = result->getNumber<uint32_t>("id");
+			offer.playerId = result->getNumber<uint32_t>("player_id");
+			offer.type = static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale"));
+			offer.itemId = result->getNumber<uint16_t>("itemtype");
+			offer.amount = result->getNumber<uint16_t>("amount");
+			offer.created = result->getNumber<uint32_t>("created");
+			offer.anonymous = result->getNumber<uint16_t>("anonymous") != 0;
+			offer.price = result->getNumber<uint64_t>("price");
+			offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+			offer.playerName = result->getString("player_name");
+			orderBook.add(std::move(offer));
+		} while (result->next());
+	}
 
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `tier`, `created`, `anonymous`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `sale` = " << action << " AND `itemtype` = " << itemId << " AND `tier` = " << std::to_string(tier);
+	g_logger().info("Loaded {} market offers in {} milliseconds", orderBook.size(), bm_loadOffers.duration());
+}
 
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return offerList;
+void IOMarket::enqueueWrite(std::string query) {
+	std::scoped_lock lock(writeMutex);
+	pendingWrites.push_back(std::move(query));
+	if (flushScheduled) {
+		return;
 	}
 
-	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+	flushScheduled = true;
+	threadPool.addLoad([this] { flushWrites(); });
+}
 
-	do {
-		MarketOffer offer;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		if (result->getNumber<uint16_t>("anonymous") == 0) {
-			offer.playerName = result->getString("player_name");
-		} else {
-			offer.playerName = "Anonymous";
+size_t IOMarket::flushWrites() {
+	std::scoped_lock flushLock(flushMutex);
+	Database &db = Database::getInstance();
+	size_t written = 0;
+	while (true) {
+		std::vector<std::string> batch;
+		{
+			std::scoped_lock lock(writeMutex);
+			if (pendingWrites.empty()) {
+				flushScheduled = false;
+				return written;
+			}
+			batch.swap(pendingWrites);
 		}
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-		offerList.push_back(offer);
-	} while (result->next());
-	return offerList;
-}
 
-MarketOfferList IOMarket::getOwnOffers(MarketAction_t action, uint32_t playerId) {
-	MarketOfferList offerList;
+		for (const auto &query : batch) {
+			if (!db.executeQuery(query)) {
+				g_logger().error("[{}] - Failed to write market query: {}", __FUNCTION__, query);
+			}
+		}
+		written += batch.size();
+	}
+}
 
-	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+MarketOfferList IOMarket::getActiveOffers(MarketAction_t action) {
+	return toMarketOfferList(getInstance().orderBook.getOffers(action));
+}
 
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `created`, `itemtype`, `tier` FROM `market_offers` WHERE `player_id` = " << playerId << " AND `sale` = " << action;
+MarketOfferList IOMarket::getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier) {
+	return toMarketOfferList(getInstance().orderBook.getOffers(action, itemId, tier));
+}
 
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return offerList;
+MarketOfferList IOMarket::getOwnOffers(MarketAction_t action, uint32_t playerId) {
+	auto offerList = toMarketOfferList(getInstance().orderBook.getPlayerOffers(playerId, action));
+	for (auto &offer : offerList) {
+		offer.playerName.clear();
 	}
-
-	do {
-		MarketOffer offer;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		offer.itemId = result->getNumber<uint16_t>("itemtype");
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-		offerList.push_back(offer);
-	} while (result->next());
 	return offerList;
 }
 
+void IOMarket::loadOwnHistory(uint32_t playerId, std::function<void(const HistoryMarketOfferList &buyOffers, const HistoryMarketOfferList &sellOffers)> callback) {
+	auto &market = getInstance();
+	market.threadPool.addLoad([&market, playerId, callback = std::move(callback)] {
+		// The history is only read when a player browses it, the queued writes go first so it is complete
+		market.flushWrites();
+		auto buyOffers = std::make_shared<HistoryMarketOfferList>(getOwnHistory(MARKETACTION_BUY, playerId));
+		auto sellOffers = std::make_shared<HistoryMarketOfferList>(getOwnHistory(MARKETACTION_SELL, playerId));
+		g_dispatcher().addEvent([callback, buyOffers, sellOffers] { callback(*buyOffers, *sellOffers); }, "IOMarket::loadOwnHistory");
+	});
+}
+
 HistoryMarketOfferList IOMarket::getOwnHistory(MarketAction_t action, uint32_t playerId) {
 	HistoryMarketOfferList offerList;
 
@@ -143,21 +180,58 @@ HistoryMarketOfferList IOMarket::getOwnHistory(MarketAction_t action, uint32_t p
 	return offerList;
 }
 
-void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
-	if (!result) {
-		return;
+bool IOMarket::expireOffers(const std::vector<MarketOrderBook::Offer> &offers) {
+	if (offers.empty()) {
+		return true;
 	}
 
-	do {
-		if (!IOMarket::moveOfferToHistory(result->getNumber<uint32_t>("id"), OFFERSTATE_EXPIRED)) {
-			continue;
+	// The queued writes go first, the offers' own INSERTs may still be among them
+	flushWrites();
+
+	std::scoped_lock flushLock(flushMutex);
+	Database &db = Database::getInstance();
+	const auto now = getTimeNow();
+	return DBTransaction::executeWithinTransaction([&] {
+		for (size_t first = 0; first < offers.size(); first += EXPIRED_OFFERS_CHUNK_SIZE) {
+			const auto last = std::min(offers.size(), first + EXPIRED_OFFERS_CHUNK_SIZE);
+			std::string deleteQuery = "DELETE FROM `market_offers` WHERE `id` IN (";
+			for (size_t i = first; i < last; ++i) {
+				if (i != first) {
+					deleteQuery += ',';
+				}
+				deleteQuery += std::to_string(offers[i].id);
+			}
+			deleteQuery += ')';
+			if (!db.executeQuery(deleteQuery)) {
+				throw DatabaseException(fmt::format("[IOMarket::expireOffers] - Failed to delete {} expired market offers", last - first));
+			}
 		}
 
-		const uint32_t playerId = result->getNumber<uint32_t>("player_id");
-		const uint16_t amount = result->getNumber<uint16_t>("amount");
-		auto tier = getTierFromDatabaseTable(result->getString("tier"));
-		if (result->getNumber<uint16_t>("sale") == 1) {
-			const ItemType &itemType = Item::items[result->getNumber<uint16_t>("itemtype")];
+		DBInsert insert(std::string { historyInsert });
+		for (const auto &offer : offers) {
+			insert.addRow(historyRow(offer.playerId, offer.type, offer.itemId, offer.amount, offer.price, now, offer.tier, OFFERSTATE_EXPIRED));
+		}
+		if (!insert.execute()) {
+			g_logger().error("[IOMarket::expireOffers] - Failed to write the history of {} expired market offers", offers.size());
+		}
+		return true;
+	});
+}
+
+void IOMarket::processExpiredOffers(const std::vector<MarketOrderBook::Offer> &expiredOffers) {
+	// The refunds are not queued, so the offers leave the database before they are paid out or a crash would pay them twice.
+	// If they cannot be deleted they are left there, and expire again after the next start.
+	if (!getInstance().expireOffers(expiredOffers)) {
+		g_logger().error("[{}] - Failed to delete {} expired market offers, refunds skipped", __FUNCTION__, expiredOffers.size());
+		return;
+	}
+
+	for (const auto &offer : expiredOffers) {
+		const uint32_t playerId = offer.playerId;
+		const uint16_t amount = offer.amount;
+		const auto tier = offer.tier;
+		if (offer.type == MARKETACTION_SELL) {
+			const ItemType &itemType = Item::items[offer.itemId];
 			if (itemType.id == 0) {
 				continue;
 			}
@@ -208,7 +282,7 @@ void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
 				g_saveManager().savePlayer(player);
 			}
 		} else {
-			uint64_t totalPrice = result->getNumber<uint64_t>("price") * amount;
+			uint64_t totalPrice = offer.price * amount;
 
 			std::shared_ptr<Player> player = g_game().getPlayerByGUID(playerId);
 			if (player) {
@@ -217,15 +291,12 @@ void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
 				IOLoginData::increaseBankBalance(playerId, totalPrice);
 			}
 		}
-	} while (result->next());
+	}
 }
 
 void IOMarket::checkExpiredOffers() {
 	const time_t lastExpireDate = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
-
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `itemtype`, `player_id`, `sale`, `tier` FROM `market_offers` WHERE `created` <= " << lastExpireDate;
-	g_databaseTasks().store(query.str(), IOMarket::processExpiredOffers);
+	processExpiredOffers(getInstance().orderBook.takeExpired(static_cast<uint32_t>(lastExpireDate)));
 
 	int32_t checkExpiredMarketOffersEachMinutes = g_configManager().getNumber(CHECK_EXPIRED_MARKET_OFFERS_EACH_MINUTES, __FUNCTION__);
 	if (checkExpiredMarketOffersEachMinutes <= 0) {
@@ -236,14 +307,7 @@ void IOMarket::checkExpiredOffers() {
 }
 
 uint32_t IOMarket::getPlayerOfferCount(uint32_t playerId) {
-	std::ostringstream query;
-	query << "SELECT COUNT(*) AS `count` FROM `market_offers` WHERE `player_id` = " << playerId;
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return 0;
-	}
-	return result->getNumber<int32_t>("count");
+	return static_cast<uint32_t>(getInstance().orderBook.getPlayerOfferCount(playerId));
 }
 
 MarketOfferEx IOMarket::getOfferByCounter(uint32_t timestamp, uint16_t counter) {
@@ -251,108 +315,136 @@ MarketOfferEx IOMarket::getOfferByCounter(uint32_t timestamp, uint16_t counter)
 
 	const int32_t created = timestamp - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
 
-	std::ostringstream query;
-	query << "SELECT `id`, `sale`, `itemtype`, `amount`, `created`, `price`, `player_id`, `anonymous`, `tier`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `created` = " << created << " AND (`id` & 65535) = " << counter << " LIMIT 1";
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+	const auto bookOffer = getInstance().orderBook.find(static_cast<uint32_t>(created), counter);
+	if (!bookOffer) {
 		offer.id = 0;
 		return offer;
 	}
 
-	offer.id = result->getNumber<uint32_t>("id");
-	offer.type = static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale"));
-	offer.amount = result->getNumber<uint16_t>("amount");
-	offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-	offer.timestamp = result->getNumber<uint32_t>("created");
-	offer.price = result->getNumber<uint64_t>("price");
-	offer.itemId = result->getNumber<uint16_t>("itemtype");
-	offer.playerId = result->getNumber<uint32_t>("player_id");
-	offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-	if (result->getNumber<uint16_t>("anonymous") == 0) {
-		offer.playerName = result->getString("player_name");
-	} else {
-		offer.playerName = "Anonymous";
-	}
+	offer.id = bookOffer->id;
+	offer.type = bookOffer->type;
+	offer.amount = bookOffer->amount;
+	offer.counter = bookOffer->getCounter();
+	offer.timestamp = bookOffer->created;
+	offer.price = bookOffer->price;
+	offer.itemId = bookOffer->itemId;
+	offer.playerId = bookOffer->playerId;
+	offer.tier = bookOffer->tier;
+	offer.playerName = bookOffer->anonymous ? "Anonymous" : bookOffer->playerName;
 	return offer;
 }
 
 void IOMarket::createOffer(uint32_t playerId, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous) {
+	MarketOrderBook::Offer offer;
+	offer.playerId = playerId;
+	offer.type = action;
+	offer.itemId = static_cast<uint16_t>(itemId);
+	offer.amount = amount;
+	offer.created = static_cast<uint32_t>(getTimeNow());
+	offer.anonymous = anonymous;
+	offer.price = price;
+	offer.tier = tier;
+	offer.playerName = g_game().getPlayerNameByGUID(playerId);
+
+	auto &market = getInstance();
+	offer = market.orderBook.createOffer(std::move(offer));
+
 	std::ostringstream query;
-	query << "INSERT INTO `market_offers` (`player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`) VALUES (" << playerId << ',' << action << ',' << itemId << ',' << amount << ',' << getTimeNow() << ',' << anonymous << ',' << price << ',' << std::to_string(tier) << ')';
-	Database::getInstance().executeQuery(query.str());
+	query << "INSERT INTO `market_offers` (`id`, `player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`) VALUES (" << offer.id << ',' << playerId << ',' << action << ',' << itemId << ',' << amount << ',' << offer.created << ',' << anonymous << ',' << price << ',' << std::to_string(tier) << ')';
+	market.enqueueWrite(query.str());
 }
 
 void IOMarket::acceptOffer(uint32_t offerId, uint16_t amount) {
+	auto &market = getInstance();
+	if (!market.orderBook.reduceAmount(offerId, amount)) {
+		return;
+	}
+
+	// The amount left is written as is, the queued writes stay correct whenever they run
 	std::ostringstream query;
-	query << "UPDATE `market_offers` SET `amount` = `amount` - " << amount << " WHERE `id` = " << offerId;
-	Database::getInstance().executeQuery(query.str());
+	query << "UPDATE `market_offers` SET `amount` = " << market.orderBook.get(offerId)->amount << " WHERE `id` = " << offerId;
+	market.enqueueWrite(query.str());
 }
 
 void IOMarket::deleteOffer(uint32_t offerId) {
+	auto &market = getInstance();
+	if (!market.orderBook.remove(offerId)) {
+		return;
+	}
+
 	std::ostringstream query;
 	query << "DELETE FROM `market_offers` WHERE `id` = " << offerId;
-	Database::getInstance().executeQuery(query.str());
+	market.enqueueWrite(query.str());
 }
 
 void IOMarket::appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state) {
-	std::ostringstream query;
-	query << "INSERT INTO `market_history` (`player_id`, `sale`, `itemtype`, `amount`, `price`, `expires_at`, `inserted`, `state`, `tier`) VALUES ("
-		  << playerId << ',' << type << ',' << itemId << ',' << amount << ',' << price << ','
-		  << timestamp << ',' << getTimeNow() << ',' << state << ',' << std::to_string(tier) << ')';
-	g_databaseTasks().execute(query.str());
+	auto &market = getInstance();
+	market.enqueueWrite(historyQuery(playerId, type, itemId, amount, price, timestamp, tier, state));
+
+	// The owner's side of an accepted offer, what `market_history` statistics were always built from
+	if (state == OFFERSTATE_ACCEPTED) {
+		market.addTransaction(type, itemId, tier, price);
+	}
 }
 
 bool IOMarket::moveOfferToHistory(uint32_t offerId, MarketOfferState_t state) {
-	Database &db = Database::getInstance();
-
-	std::ostringstream query;
-	query << "SELECT `player_id`, `sale`, `itemtype`, `amount`, `price`, `created`, `tier` FROM `market_offers` WHERE `id` = " << offerId;
-
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
+	auto &market = getInstance();
+	const auto offer = market.orderBook.remove(offerId);
+	if (!offer) {
 		return false;
 	}
 
-	query.str(std::string());
+	std::ostringstream query;
 	query << "DELETE FROM `market_offers` WHERE `id` = " << offerId;
-	if (!db.executeQuery(query.str())) {
-		return false;
-	}
+	market.enqueueWrite(query.str());
 
-	appendHistory(
-		result->getNumber<uint32_t>("player_id"),
-		static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale")),
-		result->getNumber<uint16_t>("itemtype"),
-		result->getNumber<uint16_t>("amount"),
-		result->getNumber<uint64_t>("price"),
-		getTimeNow(),
-		getTierFromDatabaseTable(result->getString("tier")), state
-	);
+	appendHistory(offer->playerId, offer->type, offer->itemId, offer->amount, offer->price, getTimeNow(), offer->tier, state);
 	return true;
 }
 
-void IOMarket::updateStatistics() {
-	std::ostringstream query;
-	query << "SELECT `sale` AS `sale`, `itemtype` AS `itemtype`, COUNT(`price`) AS `num`, MIN(`price`) AS `min`, MAX(`price`) AS `max`, SUM(`price`) AS `sum`, `tier` AS `tier` FROM `market_history` WHERE `state` = " << OFFERSTATE_ACCEPTED << " GROUP BY `itemtype`, `sale`, `tier`";
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
+void IOMarket::renamePlayer(uint32_t playerId, const std::string &name) {
+	getInstance().orderBook.renamePlayer(playerId, name);
+}
+
+void IOMarket::loadStatistics() {
+	const DBResult_ptr result = Database::getInstance().storeQuery("SELECT `itemtype`, `sale`, `tier`, `day`, `num`, `min`, `max`, `sum` FROM `market_statistics`");
 	if (!result) {
 		return;
 	}
 
 	do {
-		MarketStatistics* statistics = nullptr;
-		const auto tier = getTierFromDatabaseTable(result->getString("tier"));
-		auto itemId = result->getNumber<uint16_t>("itemtype");
-		if (result->getNumber<uint16_t>("sale") == MARKETACTION_BUY) {
-			statistics = &purchaseStatistics[itemId][tier];
-		} else {
-			statistics = &saleStatistics[itemId][tier];
-		}
-
-		statistics->numTransactions = result->getNumber<uint32_t>("num");
-		statistics->lowestPrice = result->getNumber<uint64_t>("min");
-		statistics->totalPrice = result->getNumber<uint64_t>("sum");
-		statistics->highestPrice = result->getNumber<uint64_t>("max");
+		MarketStatistics dayStatistics;
+		dayStatistics.numTransactions = result->getNumber<uint32_t>("num");
+		dayStatistics.lowestPrice = result->getNumber<uint64_t>("min");
+		dayStatistics.highestPrice = result->getNumber<uint64_t>("max");
+		dayStatistics.totalPrice = result->getNumber<uint64_t>("sum");
+		statistics.addDay(
+			result->getNumber<uint32_t>("day"),
+			static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale")),
+			result->getNumber<uint16_t>("itemtype"),
+			getTierFromDatabaseTable(result->getString("tier")),
+			dayStatistics
+		);
 	} while (result->next());
 }
+
+void IOMarket::addTransaction(MarketAction_t type, uint16_t itemId, uint8_t tier, uint64_t price) {
+	const auto now = getTimeNow();
+	statistics.addTransaction(now, type, itemId, tier, price);
+
+	std::ostringstream query;
+	query << "INSERT INTO `market_statistics` (`itemtype`, `sale`, `tier`, `day`, `num`, `min`, `max`, `sum`) VALUES ("
+		  << itemId << ',' << type << ',' << std::to_string(tier) << ',' << MarketStatisticsLedger::getDay(now) << ",1," << price << ',' << price << ',' << price
+		  << ") ON DUPLICATE KEY UPDATE `num` = `num` + 1, `min` = LEAST(`min`, " << price << "), `max` = GREATEST(`max`, " << price << "), `sum` = `sum` + " << price;
+	enqueueWrite(query.str());
+}
+
+void IOMarket::updateStatistics() {
+	const time_t firstKept = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+	const auto firstDay = MarketStatisticsLedger::getDay(firstKept);
+	if (statistics.expire(firstDay) == 0) {
+		return;
+	}
+
+	enqueueWrite(fmt::format("DELETE FROM `market_statistics` WHERE `day` < {}", firstDay));
+}
@@ -11,24 +11,41 @@
 
 #include "database/database.hpp"
 #include "declarations.hpp"
+#include "io/market_order_book.hpp"
+#include "io/market_statistics.hpp"
 #include "lib/di/container.hpp"
+#include "lib/thread/thread_pool.hpp"
 
 class IOMarket {
-	using StatisticsMap = std::map<uint16_t, std::map<uint8_t, MarketStatistics>>;
+	using StatisticsMap = MarketStatisticsLedger::StatisticsMap;
 
 public:
-	IOMarket() = default;
+	explicit IOMarket(ThreadPool &threadPool) :
+		threadPool(threadPool) { }
+
+	// Singleton - ensures we don't accidentally copy it
+	IOMarket(const IOMarket &) = delete;
+	void operator=(const IOMarket &) = delete;
 
 	static IOMarket &getInstance() {
 		return inject<IOMarket>();
 	}
 
+	// Loads the active offers into the order book, from then on the book is authoritative and
+	// `market_offers`/`market_history` are only written to, in order, from a write-behind queue
+	void loadOffers();
+	// Runs the queued writes on the calling thread, returns how many were run
+	size_t flushWrites();
+	// Loads the daily summaries of `market_statistics`, accepted offers keep them up to date from then on
+	void loadStatistics();
+
 	static MarketOfferList getActiveOffers(MarketAction_t action);
 	static MarketOfferList getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier);
 	static MarketOfferList getOwnOffers(MarketAction_t action, uint32_t playerId);
-	static HistoryMarketOfferList getOwnHistory(MarketAction_t action, uint32_t playerId);
+	// Reads the player's history on the thread pool, after the queued writes, and hands it to callback on the dispatcher
+	static void loadOwnHistory(uint32_t playerId, std::function<void(const HistoryMarketOfferList &buyOffers, const HistoryMarketOfferList &sellOffers)> callback);
 
-	static void processExpiredOffers(DBResult_ptr result, bool);
+	static void processExpiredOffers(const std::vector<MarketOrderBook::Offer> &expiredOffers);
 	static void checkExpiredOffers();
 
 	static uint32_t getPlayerOfferCount(uint32_t playerId);
@@ -41,19 +58,39 @@ public:
 	static void appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state);
 	static bool moveOfferToHistory(uint32_t offerId, MarketOfferState_t state);
 
+	static void renamePlayer(uint32_t playerId, const std::string &name);
+
+	// Drops the days older than the market offer duration, the same window `market_history` is kept for
 	void updateStatistics();
 
-	StatisticsMap getPurchaseStatistics() const {
-		return purchaseStatistics;
+	const StatisticsMap &getPurchaseStatistics() const {
+		return statistics.getPurchaseStatistics();
+	}
+	const StatisticsMap &getSaleStatistics() const {
+		return statistics.getSaleStatistics();
 	}
-	StatisticsMap getSaleStatistics() const {
-		return saleStatistics;
+	MarketStatistics getStatistics(MarketAction_t action, uint16_t itemId, uint8_t tier) const {
+		return statistics.getStatistics(action, itemId, tier);
 	}
 
 	static uint8_t getTierFromDatabaseTable(const std::string &string);
 
 private:
-	// [uint16_t = item id, [uint8_t = item tier, MarketStatistics = structure of the statistics]]
-	StatisticsMap purchaseStatistics;
-	StatisticsMap saleStatistics;
+	void enqueueWrite(std::string query);
+	// Runs the query on the calling thread
+	static HistoryMarketOfferList getOwnHistory(MarketAction_t action, uint32_t playerId);
+	// Deletes the offers and writes their history right away, all in one transaction
+	bool expireOffers(const std::vector<MarketOrderBook::Offer> &offers);
+	void addTransaction(MarketAction_t type, uint16_t itemId, uint8_t tier, uint64_t price);
+
+	MarketOrderBook orderBook;
+
+	ThreadPool &threadPool;
+	std::mutex writeMutex;
+	// Held while running a batch, keeps batches in queue order whichever thread runs them
+	std::mutex flushMutex;
+	std::vector<std::string> pendingWrites;
+	bool flushScheduled = false;
+
+	MarketStatisticsLedger statistics;
 };
@@ -0,0 +1,167 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "io/market_order_book.hpp"
+
+bool MarketOrderBook::add(Offer offer) {
+	const auto offerId = offer.id;
+	if (offerId == 0 || offers.contains(offerId)) {
+		return false;
+	}
+
+	lastId = std::max(lastId, offerId);
+	books[makeKey(offer.type, offer.itemId, offer.tier)].emplace(offer.price, offerId);
+	offersByPlayer[offer.playerId].insert(offerId);
+	offersByCreation.emplace(offer.created, offerId);
+	offers.emplace(offerId, std::move(offer));
+	return true;
+}
+
+MarketOrderBook::Offer MarketOrderBook::createOffer(Offer offer) {
+	offer.id = lastId + 1;
+	add(offer);
+	return offer;
+}
+
+const MarketOrderBook::Offer* MarketOrderBook::get(uint32_t offerId) const {
+	const auto it = offers.find(offerId);
+	return it != offers.end() ? &it->second : nullptr;
+}
+
+const MarketOrderBook::Offer* MarketOrderBook::find(uint32_t created, uint16_t counter) const {
+	for (auto it = offersByCreation.lower_bound({ created, 0 }); it != offersByCreation.end() && it->first == created; ++it) {
+		if ((it->second & 0xFFFF) == counter) {
+			return get(it->second);
+		}
+	}
+	return nullptr;
+}
+
+std::vector<const MarketOrderBook::Offer*> MarketOrderBook::getOffers(MarketAction_t type, uint16_t itemId, uint8_t tier) const {
+	std::vector<const Offer*> result;
+	const auto it = books.find(makeKey(type, itemId, tier));
+	if (it == books.end()) {
+		return result;
+	}
+
+	result.reserve(it->second.size());
+	if (type == MARKETACTION_BUY) {
+		for (auto levelIt = it->second.rbegin(); levelIt != it->second.rend(); ++levelIt) {
+			result.push_back(get(levelIt->second));
+		}
+	} else {
+		for (const auto &[_, offerId] : it->second) {
+			result.push_back(get(offerId));
+		}
+	}
+	return result;
+}
+
+std::vector<const MarketOrderBook::Offer*> MarketOrderBook::getOffers(MarketAction_t type) const {
+	std::vector<const Offer*> result;
+	for (const auto &[_, offer] : offers) {
+		if (offer.type == type) {
+			result.push_back(&offer);
+		}
+	}
+	return result;
+}
+
+std::vector<const MarketOrderBook::Offer*> MarketOrderBook::getPlayerOffers(uint32_t playerId, MarketAction_t type) const {
+	std::vector<const Offer*> result;
+	const auto it = offersByPlayer.find(playerId);
+	if (it == offersByPlayer.end()) {
+		return result;
+	}
+
+	for (const auto offerId : it->second) {
+		const auto offer = get(offerId);
+		if (offer && offer->type == type) {
+			result.push_back(offer);
+		}
+	}
+	return result;
+}
+
+size_t MarketOrderBook::getPlayerOfferCount(uint32_t playerId) const {
+	const auto it = offersByPlayer.find(playerId);
+	return it != offersByPlayer.end() ? it->second.size() : 0;
+}
+
+bool MarketOrderBook::reduceAmount(uint32_t offerId, uint16_t amount) {
+	const auto it = offers.find(offerId);
+	if (it == offers.end() || it->second.amount < amount) {
+		return false;
+	}
+
+	it->second.amount -= amount;
+	return true;
+}
+
+std::optional<MarketOrderBook::Offer> MarketOrderBook::remove(uint32_t offerId) {
+	const auto it = offers.find(offerId);
+	if (it == offers.end()) {
+		return std::nullopt;
+	}
+
+	auto offer = std::move(it->second);
+	offers.erase(it);
+
+	const auto key = makeKey(offer.type, offer.itemId, offer.tier);
+	if (const auto bookIt = books.find(key); bookIt != books.end()) {
+		bookIt->second.erase({ offer.price, offerId });
+		if (bookIt->second.empty()) {
+			books.erase(bookIt);
+		}
+	}
+
+	if (const auto playerIt = offersByPlayer.find(offer.playerId); playerIt != offersByPlayer.end()) {
+		playerIt->second.erase(offerId);
+		if (playerIt->second.empty()) {
+			offersByPlayer.erase(playerIt);
+		}
+	}
+
+	offersByCreation.erase({ offer.created, offerId });
+	return offer;
+}
+
+std::vector<MarketOrderBook::Offer> MarketOrderBook::takeExpired(uint32_t createdBefore) {
+	std::vector<uint32_t> expiredIds;
+	for (const auto &[created, offerId] : offersByCreation) {
+		if (created > createdBefore) {
+			break;
+		}
+		expiredIds.push_back(offerId);
+	}
+
+	std::vector<Offer> expired;
+	expired.reserve(expiredIds.size());
+	for (const auto offerId : expiredIds) {
+		if (auto offer = remove(offerId)) {
+			expired.push_back(std::move(*offer));
+		}
+	}
+	return expired;
+}
+
+void MarketOrderBook::renamePlayer(uint32_t playerId, const std::string &name) {
+	const auto it = offersByPlayer.find(playerId);
+	if (it == offersByPlayer.end()) {
+		return;
+	}
+
+	for (const auto offerId : it->second) {
+		if (const auto offerIt = offers.find(offerId); offerIt != offers.end()) {
+			offerIt->second.playerName = name;
+		}
+	}
+}
@@ -0,0 +1,77 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "creatures/creatures_definitions.hpp"
+
+// Every active market offer, indexed by (item, tier, side) sorted by price, by owner and by creation time.
+// Not thread safe, it is only touched from the dispatcher (and from the startup thread before it runs).
+class MarketOrderBook {
+public:
+	struct Offer {
+		uint32_t id = 0;
+		uint32_t playerId = 0;
+		uint32_t created = 0;
+		uint64_t price = 0;
+		uint16_t amount = 0;
+		uint16_t itemId = 0;
+		uint8_t tier = 0;
+		MarketAction_t type = MARKETACTION_BUY;
+		bool anonymous = false;
+		std::string playerName;
+
+		// Offers are identified by the client by their expiration timestamp and the lower bits of their id
+		uint16_t getCounter() const {
+			return static_cast<uint16_t>(id & 0xFFFF);
+		}
+	};
+
+	// Takes over ids loaded from the database, new offers get the following ones
+	bool add(Offer offer);
+	Offer createOffer(Offer offer);
+
+	const Offer* get(uint32_t offerId) const;
+	const Offer* find(uint32_t created, uint16_t counter) const;
+
+	// Best price first: lowest for sell offers, highest for buy offers
+	std::vector<const Offer*> getOffers(MarketAction_t type, uint16_t itemId, uint8_t tier) const;
+	std::vector<const Offer*> getOffers(MarketAction_t type) const;
+	std::vector<const Offer*> getPlayerOffers(uint32_t playerId, MarketAction_t type) const;
+	size_t getPlayerOfferCount(uint32_t playerId) const;
+
+	bool reduceAmount(uint32_t offerId, uint16_t amount);
+	std::optional<Offer> remove(uint32_t offerId);
+	// Removes and returns the offers created at or before the given time, oldest first
+	std::vector<Offer> takeExpired(uint32_t createdBefore);
+
+	void renamePlayer(uint32_t playerId, const std::string &name);
+
+	size_t size() const {
+		return offers.size();
+	}
+	uint32_t getLastId() const {
+		return lastId;
+	}
+
+private:
+	using BookKey = uint32_t;
+	// Price first, id as the tie break so same priced offers keep their creation order
+	using PriceLevel = std::set<std::pair<uint64_t, uint32_t>>;
+
+	static BookKey makeKey(MarketAction_t type, uint16_t itemId, uint8_t tier) {
+		return (static_cast<uint32_t>(itemId) << 16) | (static_cast<uint32_t>(tier) << 8) | static_cast<uint32_t>(type);
+	}
+
+	std::unordered_map<uint32_t, Offer> offers;
+	std::unordered_map<BookKey, PriceLevel> books;
+	std::unordered_map<uint32_t, std::set<uint32_t>> offersByPlayer;
+	std::set<std::pair<uint32_t, uint32_t>> offersByCreation;
+	uint32_t lastId = 0;
+};
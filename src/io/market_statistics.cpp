@@ -0,0 +1,76 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "io/market_statistics.hpp"
+
+void MarketStatisticsLedger::merge(MarketStatistics &statistics, const MarketStatistics &other) {
+	if (other.numTransactions == 0) {
+		return;
+	}
+
+	if (statistics.numTransactions == 0) {
+		statistics = other;
+		return;
+	}
+
+	statistics.numTransactions += other.numTransactions;
+	statistics.totalPrice += other.totalPrice;
+	statistics.lowestPrice = std::min(statistics.lowestPrice, other.lowestPrice);
+	statistics.highestPrice = std::max(statistics.highestPrice, other.highestPrice);
+}
+
+void MarketStatisticsLedger::addDay(uint32_t day, MarketAction_t type, uint16_t itemId, uint8_t tier, const MarketStatistics &statistics) {
+	merge(days[day][{ type, itemId, tier }], statistics);
+	merge(getTotals(type)[itemId][tier], statistics);
+}
+
+void MarketStatisticsLedger::addTransaction(time_t timestamp, MarketAction_t type, uint16_t itemId, uint8_t tier, uint64_t price) {
+	MarketStatistics transaction;
+	transaction.numTransactions = 1;
+	transaction.totalPrice = price;
+	transaction.lowestPrice = price;
+	transaction.highestPrice = price;
+	addDay(getDay(timestamp), type, itemId, tier, transaction);
+}
+
+size_t MarketStatisticsLedger::expire(uint32_t firstDay) {
+	const auto last = days.lower_bound(firstDay);
+	const auto dropped = static_cast<size_t>(std::distance(days.begin(), last));
+	if (dropped == 0) {
+		return 0;
+	}
+
+	days.erase(days.begin(), last);
+	rebuildTotals();
+	return dropped;
+}
+
+MarketStatistics MarketStatisticsLedger::getStatistics(MarketAction_t type, uint16_t itemId, uint8_t tier) const {
+	const auto &totals = type == MARKETACTION_BUY ? purchaseStatistics : saleStatistics;
+	const auto itemIt = totals.find(itemId);
+	if (itemIt == totals.end()) {
+		return {};
+	}
+
+	const auto tierIt = itemIt->second.find(tier);
+	return tierIt != itemIt->second.end() ? tierIt->second : MarketStatistics();
+}
+
+void MarketStatisticsLedger::rebuildTotals() {
+	purchaseStatistics.clear();
+	saleStatistics.clear();
+	for (const auto &[_, daySummary] : days) {
+		for (const auto &[key, statistics] : daySummary) {
+			const auto &[type, itemId, tier] = key;
+			merge(getTotals(type)[itemId][tier], statistics);
+		}
+	}
+}
@@ -0,0 +1,59 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "creatures/creatures_definitions.hpp"
+#include "io/io_definitions.hpp"
+
+// Accepted market transactions summed per day, item, tier and side, and the totals of the days still in the window.
+// A transaction only touches its day and the totals, the totals are rebuilt from the days when old days leave the window.
+class MarketStatisticsLedger {
+public:
+	// [uint16_t = item id, [uint8_t = item tier, MarketStatistics = structure of the statistics]]
+	using StatisticsMap = std::map<uint16_t, std::map<uint8_t, MarketStatistics>>;
+
+	static constexpr time_t DAY_SECONDS = 24 * 60 * 60;
+
+	static uint32_t getDay(time_t timestamp) {
+		return static_cast<uint32_t>(timestamp / DAY_SECONDS);
+	}
+
+	// Loads a day summed elsewhere, such as the `market_statistics` table
+	void addDay(uint32_t day, MarketAction_t type, uint16_t itemId, uint8_t tier, const MarketStatistics &statistics);
+	void addTransaction(time_t timestamp, MarketAction_t type, uint16_t itemId, uint8_t tier, uint64_t price);
+	// Drops the days before firstDay, returns how many were dropped
+	size_t expire(uint32_t firstDay);
+
+	const StatisticsMap &getPurchaseStatistics() const {
+		return purchaseStatistics;
+	}
+	const StatisticsMap &getSaleStatistics() const {
+		return saleStatistics;
+	}
+	MarketStatistics getStatistics(MarketAction_t type, uint16_t itemId, uint8_t tier) const;
+
+	size_t getDayCount() const {
+		return days.size();
+	}
+
+	static void merge(MarketStatistics &statistics, const MarketStatistics &other);
+
+private:
+	using DayKey = std::tuple<MarketAction_t, uint16_t, uint8_t>;
+
+	StatisticsMap &getTotals(MarketAction_t type) {
+		return type == MARKETACTION_BUY ? purchaseStatistics : saleStatistics;
+	}
+	void rebuildTotals();
+
+	std::map<uint32_t, std::map<DayKey, MarketStatistics>> days;
+	StatisticsMap purchaseStatistics;
+	StatisticsMap saleStatistics;
+};
@@ -52,6 +52,7 @@ std::shared_ptr<Container> Container::create(std::shared_ptr<Tile> tile) {
 		for (auto &item : *itemVector) {
 			if (((item->getContainer() || item->hasProperty(CONST_PROP_MOVABLE)) || (item->isWrapable() && !item->hasProperty(CONST_PROP_MOVABLE) && !item->hasProperty(CONST_PROP_BLOCKPATH))) && !item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
 				container->itemlist.push_front(item);
+				container->updateItemHolding(item, true);
 				item->setParent(container);
 			}
 		}
@@ -121,6 +122,7 @@ bool Container::hasParent() {
 
 void Container::addItem(std::shared_ptr<Item> item) {
 	itemlist.push_back(item);
+	updateItemHolding(item, true);
 	item->setParent(getContainer());
 }
 
@@ -213,6 +215,100 @@ uint32_t Container::getWeight() const {
 	return Item::getWeight() + totalWeight;
 }
 
+namespace {
+	using HoldingIds = std::vector<std::pair<uint16_t, uint32_t>>;
+
+	void addHoldingId(HoldingIds &ids, uint16_t id, uint32_t count) {
+		const auto it = std::ranges::lower_bound(ids, id, {}, &HoldingIds::value_type::first);
+		if (it != ids.end() && it->first == id) {
+			it->second += count;
+		} else {
+			ids.emplace(it, id, count);
+		}
+	}
+
+	void removeHoldingId(HoldingIds &ids, uint16_t id, uint32_t count) {
+		const auto it = std::ranges::lower_bound(ids, id, {}, &HoldingIds::value_type::first);
+		if (it != ids.end() && it->first == id && (it->second -= count) == 0) {
+			ids.erase(it);
+		}
+	}
+}
+
+void Container::updateItemHolding(const std::shared_ptr<Item> &item, bool added) {
+	uint32_t countDiff = 1;
+	uint32_t containerDiff = 0;
+	HoldingIds idDiff;
+	if (const auto &container = item->getContainer()) {
+		countDiff += container->holdingCount;
+		containerDiff += 1 + container->containerHoldingCount;
+		idDiff = container->holdingContainerIds;
+		addHoldingId(idDiff, container->getID(), 1);
+	}
+
+	std::shared_ptr<Container> current = getContainer();
+	while (current) {
+		if (added) {
+			current->holdingCount += countDiff;
+			current->containerHoldingCount += containerDiff;
+			for (const auto &[id, count] : idDiff) {
+				addHoldingId(current->holdingContainerIds, id, count);
+			}
+		} else {
+			current->holdingCount -= countDiff;
+			current->containerHoldingCount -= containerDiff;
+			for (const auto &[id, count] : idDiff) {
+				removeHoldingId(current->holdingContainerIds, id, count);
+			}
+		}
+		current = current->getParentContainer();
+	}
+
+	if (const auto &player = getHoldingPlayer()) {
+		player->updateInventoryItemIndex(item, added);
+	}
+}
+
+void Container::updateContainerHoldingId(uint16_t oldId, uint16_t newId) {
+	if (oldId == newId) {
+		return;
+	}
+
+	std::shared_ptr<Container> current = getContainer();
+	while (current) {
+		removeHoldingId(current->holdingContainerIds, oldId, 1);
+		addHoldingId(current->holdingContainerIds, newId, 1);
+		current = current->getParentContainer();
+	}
+}
+
+bool Container::validateCachedAggregates() {
+	uint32_t weight = 0;
+	uint32_t count = 0;
+	uint32_t containers = 0;
+	HoldingIds containerIds;
+	bool valid = true;
+	for (const auto &item : itemlist) {
+		weight += item->getWeight();
+		++count;
+		if (const auto &container = item->getContainer()) {
+			valid = container->validateCachedAggregates() && valid;
+			count += container->holdingCount;
+			containers += 1 + container->containerHoldingCount;
+			addHoldingId(containerIds, container->getID(), 1);
+			for (const auto &[id, idCount] : container->holdingContainerIds) {
+				addHoldingId(containerIds, id, idCount);
+			}
+		}
+	}
+
+	if (weight != totalWeight || count != holdingCount || containers != containerHoldingCount || containerIds != holdingContainerIds) {
+		g_logger().error("[{}] - Container {} aggregates out of sync: weight {}/{}, items {}/{}, containers {}/{}", __FUNCTION__, getID(), totalWeight, weight, holdingCount, count, containerHoldingCount, containers);
+		return false;
+	}
+	return valid;
+}
+
 std::string Container::getContentDescription(bool oldProtocol) {
 	std::ostringstream os;
 	return getContentDescription(os, oldProtocol).str();
@@ -335,21 +431,11 @@ std::shared_ptr<Item> Container::getItemByIndex(size_t index) const {
 }
 
 uint32_t Container::getItemHoldingCount() {
-	uint32_t counter = 0;
-	for (ContainerIterator it = iterator(); it.hasNext(); it.advance()) {
-		++counter;
-	}
-	return counter;
+	return holdingCount;
 }
 
 uint32_t Container::getContainerHoldingCount() {
-	uint32_t counter = 0;
-	for (ContainerIterator it = iterator(); it.hasNext(); it.advance()) {
-		if ((*it)->getContainer()) {
-			++counter;
-		}
-	}
-	return counter;
+	return containerHoldingCount;
 }
 
 bool Container::isHoldingItem(std::shared_ptr<Item> item) {
@@ -362,9 +448,13 @@ bool Container::isHoldingItem(std::shared_ptr<Item> item) {
 }
 
 bool Container::isHoldingItemWithId(const uint16_t id) {
+	// Nested containers are cached, which covers the reward container and chest lookups
+	if (Item::items[id].isContainer()) {
+		return std::ranges::binary_search(holdingContainerIds, id, {}, &std::pair<uint16_t, uint32_t>::first);
+	}
+
 	for (ContainerIterator it = iterator(); it.hasNext(); it.advance()) {
-		std::shared_ptr<Item> item = *it;
-		if (item->getID() == id) {
+		if ((*it)->getID() == id) {
 			return true;
 		}
 	}
@@ -695,6 +785,7 @@ void Container::addThing(int32_t index, std::shared_ptr<Thing> thing) {
 
 	item->setParent(getContainer());
 	itemlist.push_front(item);
+	updateItemHolding(item, true);
 	updateItemWeight(item->getWeight());
 
 	// send change to client
@@ -746,7 +837,9 @@ void Container::replaceThing(uint32_t index, std::shared_ptr<Thing> thing) {
 		return /*RETURNVALUE_NOTPOSSIBLE*/;
 	}
 
+	updateItemHolding(replacedItem, false);
 	itemlist[index] = item;
+	updateItemHolding(item, true);
 	item->setParent(getContainer());
 	updateItemWeight(-static_cast<int32_t>(replacedItem->getWeight()) + item->getWeight());
 
@@ -787,6 +880,7 @@ void Container::removeThing(std::shared_ptr<Thing> thing, uint32_t count) {
 			onRemoveContainerItem(index, item);
 		}
 
+		updateItemHolding(item, false);
 		item->resetParent();
 		itemlist.erase(itemlist.begin() + index);
 	}
@@ -890,6 +984,7 @@ void Container::internalAddThing(uint32_t, std::shared_ptr<Thing> thing) {
 
 	item->setParent(getContainer());
 	itemlist.push_front(item);
+	updateItemHolding(item, true);
 	updateItemWeight(item->getWeight());
 }
 
@@ -945,6 +1040,8 @@ void Container::removeItem(std::shared_ptr<Thing> thing, bool sendUpdateToClient
 			onRemoveContainerItem(thingIndex, itemToRemove);
 		}
 
+		updateItemHolding(itemToRemove, false);
+		updateItemWeight(-static_cast<int32_t>(itemToRemove->getWeight()));
 		itemlist.erase(it);
 		itemToRemove->resetParent();
 	}
@@ -123,6 +123,7 @@ public:
 	std::shared_ptr<Item> getFilteredItemByIndex(size_t index) const;
 	std::shared_ptr<Item> getItemByIndex(size_t index) const;
 	bool isHoldingItem(std::shared_ptr<Item> item);
+	// Container ids are answered from the cached nested container ids, any other id walks the content
 	bool isHoldingItemWithId(const uint16_t id);
 
 	uint32_t getItemHoldingCount();
@@ -130,6 +131,18 @@ public:
 	uint16_t getFreeSlots();
 	uint32_t getWeight() const override final;
 
+	/**
+	 * @brief Keeps the cached container ids in sync when a contained container changes its id in place.
+	 */
+	void updateContainerHoldingId(uint16_t oldId, uint16_t newId);
+
+	/**
+	 * @brief Recomputes weight and holding counters by walking the content and compares them with the cached values.
+	 * @return True if every cached aggregate of this container and its sub containers is correct.
+	 * @note Debug builds run it on the inventory containers of every player save.
+	 */
+	bool validateCachedAggregates();
+
 	bool isUnlocked() const {
 		return !this->isCorpse() && unlocked;
 	}
@@ -184,12 +197,22 @@ protected:
 	uint32_t m_maxItems;
 	uint32_t maxSize;
 	uint32_t totalWeight = 0;
+	// Aggregates over the whole content tree, kept in sync by updateItemHolding
+	uint32_t holdingCount = 0;
+	uint32_t containerHoldingCount = 0;
+	// Id -> count of the nested containers, sorted by id; most bags keep it empty.
+	// There are deliberately no per item id counters: carried item totals come from the
+	// player InventoryItemIndex, and a counter map per bag would cost an allocation for
+	// every bag plus an upward update on every stack count change.
+	std::vector<std::pair<uint16_t, uint32_t>> holdingContainerIds;
 	ItemDeque itemlist;
 	uint32_t serializationCount = 0;
 
 	bool unlocked;
 	bool pagination;
 
+	void updateItemHolding(const std::shared_ptr<Item> &item, bool added);
+
 	friend class MapCache;
 
 private:
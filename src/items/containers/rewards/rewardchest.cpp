@@ -53,6 +53,7 @@ void RewardChest::removeItem(std::shared_ptr<Thing> thing, bool /* sendToClient
 
 	auto it = std::ranges::find(itemlist.begin(), itemlist.end(), itemToRemove);
 	if (it != itemlist.end()) {
+		updateItemHolding(itemToRemove, false);
 		itemlist.erase(it);
 		itemToRemove->resetParent();
 	}
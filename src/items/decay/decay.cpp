@@ -14,6 +14,7 @@
 #include "lib/di/container.hpp"
 #include "game/game.hpp"
 #include "game/scheduling/dispatcher.hpp"
+#include "lib/metrics/metrics.hpp"
 
 Decay &Decay::getInstance() {
 	return inject<Decay>();
@@ -45,91 +46,52 @@ void Decay::startDecay(std::shared_ptr<Item> item) {
 			stopDecay(item);
 		}
 
-		int64_t timestamp = OTSYS_TIME() + duration;
-		if (decayMap.empty()) {
-			eventId = g_dispatcher().scheduleEvent(
-				std::max<int32_t>(SCHEDULER_MINTICKS, duration), [this] { checkDecay(); }, "Decay::checkDecay"
-			);
-		} else {
-			if (timestamp < decayMap.begin()->first) {
-				g_dispatcher().stopEvent(eventId);
-				eventId = g_dispatcher().scheduleEvent(
-					std::max<int32_t>(SCHEDULER_MINTICKS, duration), [this] { checkDecay(); }, "Decay::checkDecay"
-				);
-			}
-		}
-
+		const int64_t now = OTSYS_TIME();
+		const int64_t timestamp = now + duration;
 		item->setDecaying(DECAYING_TRUE);
 		item->setAttribute(ItemAttribute_t::DURATION_TIMESTAMP, timestamp);
-		decayMap[timestamp].push_back(item);
+		wheel.add(item, timestamp, now);
+		scheduleCheck();
 	}
 }
 
 void Decay::stopDecay(std::shared_ptr<Item> item) {
-	if (item->hasAttribute(ItemAttribute_t::DECAYSTATE)) {
-		auto timestamp = item->getAttribute<int64_t>(ItemAttribute_t::DURATION_TIMESTAMP);
-		if (item->hasAttribute(ItemAttribute_t::DURATION_TIMESTAMP)) {
-			auto it = decayMap.find(timestamp);
-			if (it != decayMap.end()) {
-				auto &decayItems = it->second;
-
-				size_t i = 0, end = decayItems.size();
-				auto decayItem = decayItems[i];
-				if (end == 1) {
-					if (item == decayItem) {
-						if (item->hasAttribute(ItemAttribute_t::DURATION)) {
-							// Incase we removed duration attribute don't assign new duration
-							item->setDuration(item->getDuration());
-						}
-						item->removeAttribute(ItemAttribute_t::DECAYSTATE);
-
-						decayMap.erase(it);
-					}
-					return;
-				}
-				while (i < end) {
-					decayItem = decayItems[i];
-					if (item == decayItem) {
-						if (item->hasAttribute(ItemAttribute_t::DURATION)) {
-							// Incase we removed duration attribute don't assign new duration
-							item->setDuration(item->getDuration());
-						}
-						item->removeAttribute(ItemAttribute_t::DECAYSTATE);
-
-						decayItems[i] = decayItems.back();
-						decayItems.pop_back();
-						return;
-					}
-					++i;
-				}
-			}
-			item->removeAttribute(ItemAttribute_t::DURATION_TIMESTAMP);
-		} else {
-			item->removeAttribute(ItemAttribute_t::DECAYSTATE);
+	if (!item->hasAttribute(ItemAttribute_t::DECAYSTATE)) {
+		return;
+	}
+
+	if (!item->hasAttribute(ItemAttribute_t::DURATION_TIMESTAMP)) {
+		item->removeAttribute(ItemAttribute_t::DECAYSTATE);
+		return;
+	}
+
+	if (wheel.remove(item)) {
+		if (item->hasAttribute(ItemAttribute_t::DURATION)) {
+			// Incase we removed duration attribute don't assign new duration
+			item->setDuration(item->getDuration());
 		}
+		item->removeAttribute(ItemAttribute_t::DECAYSTATE);
+		return;
+	}
+
+	item->removeAttribute(ItemAttribute_t::DURATION_TIMESTAMP);
+}
+
+void Decay::scheduleCheck() {
+	if (eventId == 0) {
+		eventId = g_dispatcher().scheduleEvent(
+			DecayWheel<Item>::BUCKET_DURATION, [this] { checkDecay(); }, "Decay::checkDecay"
+		);
 	}
 }
 
 void Decay::checkDecay() {
-	int64_t timestamp = OTSYS_TIME();
+	metrics::method_latency measure(__METHOD_NAME__);
+	eventId = 0;
 
 	std::vector<std::shared_ptr<Item>> tempItems;
-	tempItems.reserve(32); // Small preallocation
-
-	auto it = decayMap.begin(), end = decayMap.end();
-	while (it != end) {
-		if (it->first > timestamp) {
-			break;
-		}
-
-		// Iterating here is unsafe so let's copy our items into temporary vector
-		auto &decayItems = it->second;
-		tempItems.reserve(tempItems.size() + decayItems.size());
-		for (auto &decayItem : decayItems) {
-			tempItems.push_back(decayItem);
-		}
-		it = decayMap.erase(it);
-	}
+	// Decaying the items while they are in the wheel is unsafe, so the due ones are moved out first
+	wheel.collectDue(OTSYS_TIME(), tempItems);
 
 	for (const auto &item : tempItems) {
 		if (!item->canDecay()) {
@@ -141,10 +103,12 @@ void Decay::checkDecay() {
 		}
 	}
 
-	if (it != end) {
-		eventId = g_dispatcher().scheduleEvent(
-			std::max<int32_t>(SCHEDULER_MINTICKS, static_cast<int32_t>(it->first - timestamp)), [this] { checkDecay(); }, "Decay::checkDecay"
-		);
+	g_metrics().addUpDownCounter("decay_items", static_cast<int>(static_cast<int64_t>(wheel.size()) - reportedCount));
+	reportedCount = static_cast<int64_t>(wheel.size());
+
+	// Decaying items may have started new decays, which already rescheduled us
+	if (!wheel.empty()) {
+		scheduleCheck();
 	}
 }
 
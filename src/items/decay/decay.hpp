@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include "items/decay/decay_wheel.hpp"
+
 class Item;
 
+// Decaying items are kept in a timing wheel, see DecayWheel
 class Decay {
 public:
 	Decay() = default;
@@ -23,13 +26,19 @@ public:
 	void startDecay(std::shared_ptr<Item> item);
 	void stopDecay(std::shared_ptr<Item> item);
 
+	size_t getDecayingCount() const {
+		return wheel.size();
+	}
+
 private:
 	void checkDecay();
 	void internalDecayItem(std::shared_ptr<Item> item);
 
+	void scheduleCheck();
+
 	uint32_t eventId { 0 };
-	// order is important, so we use an std::map
-	std::map<int64_t, std::vector<std::shared_ptr<Item>>> decayMap;
+	int64_t reportedCount { 0 };
+	DecayWheel<Item> wheel;
 };
 
 constexpr auto g_decay = Decay::getInstance;
@@ -0,0 +1,123 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Timing wheel of the decaying items: a fixed ring of buckets, each one
+ * covering BUCKET_DURATION milliseconds. Every item remembers its bucket and
+ * its index inside it (decayBucket/decayBucketIndex), so adding and removing
+ * are O(1). Items that expire more than one revolution ahead stay in their
+ * bucket and are skipped until their timestamp is reached.
+ * Due items come out in timestamp order, and in insertion order for equal
+ * timestamps, like the time sorted map it replaces.
+ */
+template <typename T>
+class DecayWheel {
+public:
+	static constexpr int64_t BUCKET_DURATION = 50;
+	static constexpr uint32_t BUCKETS_COUNT = 4096;
+	static constexpr uint32_t NO_INDEX = std::numeric_limits<uint32_t>::max();
+
+	size_t size() const {
+		return count;
+	}
+	bool empty() const {
+		return count == 0;
+	}
+
+	void add(const std::shared_ptr<T> &item, int64_t timestamp, int64_t now) {
+		if (count == 0) {
+			// The wheel was idle, realign it with the current time
+			currentTick = now / BUCKET_DURATION;
+		}
+
+		const int64_t tick = std::max<int64_t>(timestamp / BUCKET_DURATION, currentTick);
+		const auto bucketId = static_cast<uint32_t>(tick % BUCKETS_COUNT);
+		auto &bucket = buckets[bucketId];
+
+		item->decayBucket = bucketId;
+		item->decayBucketIndex = static_cast<uint32_t>(bucket.size());
+		bucket.push_back({ item, timestamp, nextSequence++ });
+		++count;
+	}
+
+	bool remove(const std::shared_ptr<T> &item) {
+		if (item->decayBucketIndex == NO_INDEX) {
+			return false;
+		}
+
+		auto &bucket = buckets[item->decayBucket];
+		const uint32_t index = item->decayBucketIndex;
+		item->decayBucketIndex = NO_INDEX;
+		if (index >= bucket.size() || bucket[index].item != item) {
+			return false;
+		}
+
+		removeAt(bucket, index);
+		return true;
+	}
+
+	// Moves the items due at the given time to the vector
+	void collectDue(int64_t now, std::vector<std::shared_ptr<T>> &due) {
+		if (count == 0) {
+			return;
+		}
+
+		std::vector<Entry> expired;
+		const int64_t lastTick = now / BUCKET_DURATION;
+		// If we fell behind by more than a revolution, visiting every bucket once is enough
+		const int64_t firstTick = std::max<int64_t>(currentTick, lastTick - BUCKETS_COUNT + 1);
+		for (int64_t tick = firstTick; tick <= lastTick; ++tick) {
+			auto &bucket = buckets[tick % BUCKETS_COUNT];
+			size_t i = 0;
+			while (i < bucket.size()) {
+				if (bucket[i].timestamp > now) {
+					++i;
+					continue;
+				}
+
+				expired.push_back(bucket[i]);
+				expired.back().item->decayBucketIndex = NO_INDEX;
+				removeAt(bucket, static_cast<uint32_t>(i));
+			}
+		}
+		// The current bucket stays open, items may still be due later in its window
+		currentTick = std::max<int64_t>(currentTick, lastTick);
+
+		std::ranges::sort(expired, [](const Entry &lhs, const Entry &rhs) {
+			return lhs.timestamp != rhs.timestamp ? lhs.timestamp < rhs.timestamp : lhs.sequence < rhs.sequence;
+		});
+		due.reserve(due.size() + expired.size());
+		for (auto &entry : expired) {
+			due.push_back(std::move(entry.item));
+		}
+	}
+
+private:
+	struct Entry {
+		std::shared_ptr<T> item;
+		int64_t timestamp;
+		uint64_t sequence;
+	};
+
+	void removeAt(std::vector<Entry> &bucket, uint32_t index) {
+		if (index != bucket.size() - 1) {
+			bucket[index] = std::move(bucket.back());
+			bucket[index].item->decayBucketIndex = index;
+		}
+		bucket.pop_back();
+		--count;
+	}
+
+	int64_t currentTick = 0;
+	uint64_t nextSequence = 0;
+	size_t count = 0;
+	std::array<std::vector<Entry>, BUCKETS_COUNT> buckets;
+};
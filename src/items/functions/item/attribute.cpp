@@ -11,59 +11,115 @@
 
 #include "items/functions/item/attribute.hpp"
 
-/*
-=============================
-* ItemAttribute class (Attributes methods)
-=============================
-*/
-const std::string &ItemAttribute::getAttributeString(ItemAttribute_t type) const {
-	static std::string emptyString;
-	if (!isAttributeString(type)) {
-		return emptyString;
+namespace {
+	// Values arrays are exactly sized, growing or shrinking one only happens when an attribute is added or removed
+	template <typename T>
+	void insertValue(std::unique_ptr<T[]> &values, size_t size, size_t slot, T value) {
+		auto resized = std::make_unique<T[]>(size + 1);
+		std::move(values.get(), values.get() + slot, resized.get());
+		resized[slot] = std::move(value);
+		std::move(values.get() + slot, values.get() + size, resized.get() + slot + 1);
+		values = std::move(resized);
 	}
 
-	auto attribute = getAttribute(type);
-	if (!attribute) {
-		return emptyString;
+	template <typename T>
+	void eraseValue(std::unique_ptr<T[]> &values, size_t size, size_t slot) {
+		if (size == 1) {
+			values.reset();
+			return;
+		}
+
+		auto resized = std::make_unique<T[]>(size - 1);
+		std::move(values.get(), values.get() + slot, resized.get());
+		std::move(values.get() + slot + 1, values.get() + size, resized.get() + slot);
+		values = std::move(resized);
 	}
 
-	return *attribute->getString().get();
-}
+	template <typename T>
+	std::unique_ptr<T[]> copyValues(const std::unique_ptr<T[]> &values, size_t size) {
+		if (size == 0) {
+			return nullptr;
+		}
 
-const int64_t &ItemAttribute::getAttributeValue(ItemAttribute_t type) const {
-	static int64_t emptyInt;
-	if (!isAttributeInteger(type)) {
-		return emptyInt;
+		auto copy = std::make_unique<T[]>(size);
+		std::copy(values.get(), values.get() + size, copy.get());
+		return copy;
 	}
 
-	auto attribute = getAttribute(type);
-	if (!attribute) {
-		return emptyInt;
+	// Interned strings are released by their last owner, so the pool never holds text nobody uses
+	struct InternedStringPool {
+		std::mutex mutex;
+		phmap::flat_hash_map<std::string_view, std::pair<const std::string*, std::weak_ptr<const std::string>>> strings;
+	};
+
+	InternedStringPool &getInternedStringPool() {
+		// Never destroyed, items holding strings can outlive static destruction
+		static auto* pool = new InternedStringPool();
+		return *pool;
 	}
+}
+
+/*
+=============================
+* ItemAttribute class (Attributes methods)
+=============================
+*/
+ItemAttribute::ItemAttribute(const ItemAttribute &other) :
+	attributeBits(other.attributeBits),
+	integerValues(copyValues(other.integerValues, other.getCount(integerMask))),
+	stringValues(copyValues(other.stringValues, other.getCount(stringMask))),
+	customAttributes(other.customAttributes ? std::make_unique<CustomAttributeList>(*other.customAttributes) : nullptr) { }
 
-	return attribute->getInteger();
+ItemAttribute &ItemAttribute::operator=(const ItemAttribute &other) {
+	if (this != &other) {
+		ItemAttribute copy(other);
+		*this = std::move(copy);
+	}
+	return *this;
 }
 
-const Attributes* ItemAttribute::getAttribute(ItemAttribute_t type) const {
-	if (hasAttribute(type)) {
-		for (const Attributes &attribute : attributeVector) {
-			if (attribute.getAttributeType() == type) {
-				return &attribute;
+std::shared_ptr<const std::string> ItemAttribute::internString(const std::string &value) {
+	auto &pool = getInternedStringPool();
+	std::scoped_lock lock(pool.mutex);
+	if (auto it = pool.strings.find(std::string_view(value)); it != pool.strings.end()) {
+		if (auto interned = it->second.second.lock()) {
+			return interned;
+		}
+		// Expired but its deleter is still waiting for the lock, it won't erase the replacement
+		pool.strings.erase(it);
+	}
+
+	const auto* string = new std::string(value);
+	std::shared_ptr<const std::string> interned(string, [](const std::string* released) {
+		auto &pool = getInternedStringPool();
+		{
+			std::scoped_lock lock(pool.mutex);
+			if (auto it = pool.strings.find(std::string_view(*released)); it != pool.strings.end() && it->second.first == released) {
+				pool.strings.erase(it);
 			}
 		}
+		delete released;
+	});
+	pool.strings.emplace(std::string_view(*string), std::make_pair(string, std::weak_ptr<const std::string>(interned)));
+	return interned;
+}
+
+const std::string &ItemAttribute::getAttributeString(ItemAttribute_t type) const {
+	static std::string emptyString;
+	if (!isAttributeString(type) || !hasAttribute(type)) {
+		return emptyString;
 	}
-	return nullptr;
+
+	return *stringValues[getSlot(type, stringMask)];
 }
 
-Attributes &ItemAttribute::getAttributesByType(ItemAttribute_t type) {
-	for (Attributes &attribute : attributeVector) {
-		if (attribute.getAttributeType() == type) {
-			return attribute;
-		}
+const int64_t &ItemAttribute::getAttributeValue(ItemAttribute_t type) const {
+	static int64_t emptyInt;
+	if (!isAttributeInteger(type) || !hasAttribute(type)) {
+		return emptyInt;
 	}
 
-	attributeVector.emplace_back(type);
-	return attributeVector.back();
+	return integerValues[getSlot(type, integerMask)];
 }
 
 void ItemAttribute::setAttribute(ItemAttribute_t type, int64_t value) {
@@ -71,7 +127,14 @@ void ItemAttribute::setAttribute(ItemAttribute_t type, int64_t value) {
 		return;
 	}
 
-	getAttributesByType(type).setValue(value);
+	const size_t slot = getSlot(type, integerMask);
+	if (hasAttribute(type)) {
+		integerValues[slot] = value;
+		return;
+	}
+
+	insertValue(integerValues, getCount(integerMask), slot, value);
+	attributeBits |= getAttributeBit(type);
 }
 
 void ItemAttribute::setAttribute(ItemAttribute_t type, const std::string &value) {
@@ -83,27 +146,45 @@ void ItemAttribute::setAttribute(ItemAttribute_t type, const std::string &value)
 		return;
 	}
 
-	getAttributesByType(type).setValue(value);
+	const size_t slot = getSlot(type, stringMask);
+	if (hasAttribute(type)) {
+		stringValues[slot] = internString(value);
+		return;
+	}
+
+	insertValue(stringValues, getCount(stringMask), slot, internString(value));
+	attributeBits |= getAttributeBit(type);
 }
 
 bool ItemAttribute::removeAttribute(ItemAttribute_t type) {
-	for (auto it = attributeVector.begin(); it != attributeVector.end(); ++it) {
-		if (it->getAttributeType() == type) {
-			*it = std::move(attributeVector.back());
-			attributeVector.pop_back();
-			return true;
-		}
+	if (!hasAttribute(type)) {
+		return false;
 	}
-	return false;
+
+	if (isAttributeInteger(type)) {
+		eraseValue(integerValues, getCount(integerMask), getSlot(type, integerMask));
+	} else if (isAttributeString(type)) {
+		eraseValue(stringValues, getCount(stringMask), getSlot(type, stringMask));
+	}
+	attributeBits &= ~getAttributeBit(type);
+	return true;
 }
 
 /*
 =============================
-* CustomAttribute map methods
+* CustomAttribute list methods
 =============================
 */
-const std::map<std::string, CustomAttribute, std::less<>> &ItemAttribute::getCustomAttributeMap() const {
-	return customAttributeMap;
+const ItemAttribute::CustomAttributeList &ItemAttribute::getCustomAttributeList() const {
+	static const CustomAttributeList emptyList;
+	if (!customAttributes) {
+		return emptyList;
+	}
+	return *customAttributes;
+}
+
+ItemAttribute::CustomAttributeList::iterator ItemAttribute::findCustomAttribute(const std::string &lowerCaseKey) {
+	return std::ranges::lower_bound(*customAttributes, lowerCaseKey, std::less<>(), &CustomAttributeList::value_type::first);
 }
 
 /*
@@ -112,42 +193,66 @@ const std::map<std::string, CustomAttribute, std::less<>> &ItemAttribute::getCus
 =============================
 */
 const CustomAttribute* ItemAttribute::getCustomAttribute(const std::string &attributeName) const {
-	if (customAttributeMap.contains(asLowerCaseString(attributeName))) {
-		return &customAttributeMap.at(asLowerCaseString(attributeName));
+	if (!customAttributes) {
+		return nullptr;
 	}
-	return nullptr;
+
+	const auto key = asLowerCaseString(attributeName);
+	const auto it = std::ranges::lower_bound(std::as_const(*customAttributes), key, std::less<>(), &CustomAttributeList::value_type::first);
+	if (it == customAttributes->end() || it->first != key) {
+		return nullptr;
+	}
+	return &it->second;
+}
+
+void ItemAttribute::storeCustomAttribute(const std::string &key, CustomAttribute &&customAttribute) {
+	if (!customAttributes) {
+		customAttributes = std::make_unique<CustomAttributeList>();
+	}
+
+	auto lowerCaseKey = asLowerCaseString(key);
+	const auto it = findCustomAttribute(lowerCaseKey);
+	if (it != customAttributes->end() && it->first == lowerCaseKey) {
+		it->second = std::move(customAttribute);
+		return;
+	}
+	customAttributes->emplace(it, std::move(lowerCaseKey), std::move(customAttribute));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const int64_t value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	storeCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const std::string &value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	storeCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const double value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	storeCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const bool value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	storeCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::addCustomAttribute(const std::string &key, const CustomAttribute &customAttribute) {
-	customAttributeMap[asLowerCaseString(key)] = customAttribute;
+	storeCustomAttribute(key, CustomAttribute(customAttribute));
 }
 
 bool ItemAttribute::removeCustomAttribute(const std::string &attributeName) {
-	auto it = customAttributeMap.find(asLowerCaseString(attributeName));
-	if (it == customAttributeMap.end()) {
+	if (!customAttributes) {
 		return false;
 	}
 
-	customAttributeMap.erase(it);
+	const auto key = asLowerCaseString(attributeName);
+	const auto it = findCustomAttribute(key);
+	if (it == customAttributes->end() || it->first != key) {
+		return false;
+	}
+
+	customAttributes->erase(it);
+	if (customAttributes->empty()) {
+		customAttributes.reset();
+	}
 	return true;
 }
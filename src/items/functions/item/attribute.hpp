@@ -15,7 +15,7 @@
 
 class ItemAttributeHelper {
 public:
-	bool isAttributeInteger(ItemAttribute_t type) const {
+	static constexpr bool isAttributeInteger(ItemAttribute_t type) {
 		switch (type) {
 			case ItemAttribute_t::STORE:
 			case ItemAttribute_t::ACTIONID:
@@ -48,7 +48,7 @@ public:
 		}
 	}
 
-	bool isAttributeString(ItemAttribute_t type) const {
+	static constexpr bool isAttributeString(ItemAttribute_t type) {
 		switch (type) {
 			case ItemAttribute_t::DESCRIPTION:
 			case ItemAttribute_t::TEXT:
@@ -64,77 +64,38 @@ public:
 				return false;
 		}
 	}
-};
-
-class Attributes : public ItemAttributeHelper {
-public:
-	explicit Attributes(ItemAttribute_t type) :
-		type(type), value(getDefaultValueForType(type)) { }
-	~Attributes() = default;
-
-	Attributes(const Attributes &i) :
-		type(i.type), value(i.value) { }
-	Attributes(Attributes &&attribute) noexcept :
-		type(attribute.type), value(std::move(attribute.value)) { }
-
-	Attributes &operator=(Attributes &&other) noexcept {
-		type = other.type;
-		value = std::move(other.value);
-		return *this;
-	}
-
-	const ItemAttribute_t &getAttributeType() const {
-		return type;
-	}
-
-	std::variant<int64_t, std::shared_ptr<std::string>> getDefaultValueForType(ItemAttribute_t attributeType) const {
-		ItemAttributeHelper helper;
-		if (helper.isAttributeInteger(attributeType)) {
-			return 0;
-		} else if (helper.isAttributeString(attributeType)) {
-			return std::make_shared<std::string>();
-		} else {
-			return {};
-		}
-	}
 
-	void setValue(int64_t newValue) {
-		if (std::holds_alternative<int64_t>(value)) {
-			value = newValue;
-		}
-	}
-	void setValue(const std::string &newValue) {
-		if (std::holds_alternative<std::shared_ptr<std::string>>(value)) {
-			value = std::make_shared<std::string>(newValue);
-		}
-	}
-	const int64_t &getInteger() const {
-		if (std::holds_alternative<int64_t>(value)) {
-			return std::get<int64_t>(value);
-		}
-		static int64_t emptyValue;
-		return emptyValue;
+	static constexpr uint64_t getAttributeBit(ItemAttribute_t type) {
+		return type < 64 ? uint64_t { 1 } << type : 0;
 	}
 
-	const std::shared_ptr<std::string> getString() const {
-		if (std::holds_alternative<std::shared_ptr<std::string>>(value)) {
-			return std::get<std::shared_ptr<std::string>>(value);
+	// Bits of every attribute type isOfKind accepts
+	static constexpr uint64_t getAttributeMask(bool (*isOfKind)(ItemAttribute_t)) {
+		uint64_t mask = 0;
+		for (uint64_t type = 0; type < 64; ++type) {
+			if (isOfKind(static_cast<ItemAttribute_t>(type))) {
+				mask |= getAttributeBit(static_cast<ItemAttribute_t>(type));
+			}
 		}
-		static std::shared_ptr<std::string> emptyPtr;
-		return emptyPtr;
+		return mask;
 	}
-
-private:
-	ItemAttribute_t type;
-	std::variant<int64_t, std::shared_ptr<std::string>> value;
 };
 
+// Attributes present on an item are flagged in a bitset indexed by ItemAttribute_t. Integer and string values are kept
+// in exactly sized arrays ordered by type, so the slot of a value is the number of lower flagged attributes of its kind.
+// Strings are interned and shared between items, custom attributes live in a list sorted by their lower case key.
 class ItemAttribute : public ItemAttributeHelper {
 public:
+	using CustomAttributeList = std::vector<std::pair<std::string, CustomAttribute>>;
+
 	ItemAttribute() = default;
+	ItemAttribute(const ItemAttribute &other);
+	ItemAttribute(ItemAttribute &&other) noexcept = default;
+	ItemAttribute &operator=(const ItemAttribute &other);
+	ItemAttribute &operator=(ItemAttribute &&other) noexcept = default;
 
-	// CustomAttribute map methods
-	const std::map<std::string, CustomAttribute, std::less<>> &getCustomAttributeMap() const;
+	// CustomAttribute list methods
+	const CustomAttributeList &getCustomAttributeList() const;
 	// CustomAttribute object methods
 	const CustomAttribute* getCustomAttribute(const std::string &attributeName) const;
 
@@ -153,24 +114,35 @@ public:
 	const std::string &getAttributeString(ItemAttribute_t type) const;
 	const int64_t &getAttributeValue(ItemAttribute_t type) const;
 
-	const std::vector<Attributes> &getAttributeVector() const {
-		return attributeVector;
+	uint64_t getAttributeBits() const {
+		return attributeBits;
 	}
 
 	bool hasAttribute(ItemAttribute_t type) const {
-		for (const auto &attr : attributeVector) {
-			if (attr.getAttributeType() == type) {
-				return true;
-			}
-		}
-		return false;
+		return (attributeBits & getAttributeBit(type)) != 0;
 	}
 
-	const Attributes* getAttribute(ItemAttribute_t type) const;
+private:
+	static_assert(magic_enum::enum_values<ItemAttribute_t>().back() < 64, "ItemAttribute_t values must fit the attribute bitset");
 
-	Attributes &getAttributesByType(ItemAttribute_t type);
+	static constexpr uint64_t integerMask = getAttributeMask(ItemAttributeHelper::isAttributeInteger);
+	static constexpr uint64_t stringMask = getAttributeMask(ItemAttributeHelper::isAttributeString);
 
-private:
-	std::map<std::string, CustomAttribute, std::less<>> customAttributeMap;
-	std::vector<Attributes> attributeVector;
+	// Slot of type among the flagged attributes of mask
+	size_t getSlot(ItemAttribute_t type, uint64_t mask) const {
+		return static_cast<size_t>(std::popcount(attributeBits & mask & (getAttributeBit(type) - 1)));
+	}
+	size_t getCount(uint64_t mask) const {
+		return static_cast<size_t>(std::popcount(attributeBits & mask));
+	}
+
+	static std::shared_ptr<const std::string> internString(const std::string &value);
+
+	CustomAttributeList::iterator findCustomAttribute(const std::string &lowerCaseKey);
+	void storeCustomAttribute(const std::string &key, CustomAttribute &&customAttribute);
+
+	uint64_t attributeBits = 0;
+	std::unique_ptr<int64_t[]> integerValues;
+	std::unique_ptr<std::shared_ptr<const std::string>[]> stringValues;
+	std::unique_ptr<CustomAttributeList> customAttributes;
 };
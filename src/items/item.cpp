@@ -256,23 +256,16 @@ bool Item::equals(std::shared_ptr<Item> compareItem) const {
 		return false;
 	}
 
-	for (const auto &attribute : getAttributeVector()) {
-		if (attribute.getAttributeType() == ItemAttribute_t::STORE) {
-			continue;
+	// Attributes set on both items, the store flag was compared above
+	const uint64_t sharedBits = getAttributeBits() & compareItem->getAttributeBits() & ~ItemAttribute::getAttributeBit(ItemAttribute_t::STORE);
+	for (uint64_t bits = sharedBits; bits != 0; bits &= bits - 1) {
+		const auto type = static_cast<ItemAttribute_t>(std::countr_zero(bits));
+		if (isAttributeInteger(type) && getInteger(type) != compareItem->getInteger(type)) {
+			return false;
 		}
 
-		for (const auto &compareAttribute : compareItem->getAttributeVector()) {
-			if (attribute.getAttributeType() != compareAttribute.getAttributeType()) {
-				continue;
-			}
-
-			if (isAttributeInteger(attribute.getAttributeType()) && attribute.getInteger() != compareAttribute.getInteger()) {
-				return false;
-			}
-
-			if (isAttributeString(attribute.getAttributeType()) && attribute.getString() != compareAttribute.getString()) {
-				return false;
-			}
+		if (isAttributeString(type) && getString(type) != compareItem->getString(type)) {
+			return false;
 		}
 	}
 
@@ -304,7 +297,18 @@ void Item::onRemoved() {
 
 void Item::setID(uint16_t newid) {
 	const ItemType &prevIt = Item::items[id];
+	const uint16_t oldId = id;
+	if (getContainer()) {
+		if (const auto &parent = getParent()) {
+			if (const auto &parentContainer = parent->getContainer()) {
+				parentContainer->updateContainerHoldingId(id, newid);
+			}
+		}
+	}
 	id = newid;
+	if (oldId != newid && getParent()) {
+		updateInventoryItemIndex(oldId, getTier(), count);
+	}
 
 	const ItemType &it = Item::items[newid];
 	uint32_t newDuration = it.decayTime * 1000;
@@ -392,6 +396,32 @@ std::shared_ptr<Player> Item::getHoldingPlayer() {
 	return nullptr;
 }
 
+void Item::updateInventoryItemIndex(uint16_t oldId, uint8_t oldTier, uint32_t oldCount) {
+	if (const auto &player = getHoldingPlayer()) {
+		player->updateInventoryItemIndex(static_self_cast<Item>(), oldId, oldTier, oldCount);
+	}
+}
+
+void Item::setItemCount(uint8_t n) {
+	const uint8_t oldCount = count;
+	count = n;
+	if (oldCount != n && getParent()) {
+		updateInventoryItemIndex(id, getTier(), oldCount);
+	}
+}
+
+void Item::setTier(uint8_t tier) {
+	auto configTier = g_configManager().getNumber(FORGE_MAX_ITEM_TIER, __FUNCTION__);
+	if (tier > configTier) {
+		g_logger().error("{} - It is not possible to set a tier higher than {}", __FUNCTION__, configTier);
+		return;
+	}
+
+	if (items[id].upgradeClassification) {
+		setAttribute(ItemAttribute_t::TIER, tier);
+	}
+}
+
 bool Item::isItemStorable() const {
 	if (isStoreItem() || hasOwner()) {
 		return false;
@@ -1008,10 +1038,10 @@ void Item::serializeAttr(PropWriteStream &propWriteStream) const {
 
 	// Serialize custom attributes, only serialize if the map not is empty
 	if (hasCustomAttribute()) {
-		auto customAttributeMap = getCustomAttributeMap();
+		const auto &customAttributeList = getCustomAttributeList();
 		propWriteStream.write<uint8_t>(ATTR_CUSTOM);
-		propWriteStream.write<uint64_t>(customAttributeMap.size());
-		for (const auto &[attributeKey, customAttribute] : customAttributeMap) {
+		propWriteStream.write<uint64_t>(customAttributeList.size());
+		for (const auto &[attributeKey, customAttribute] : customAttributeList) {
 			// Serializing custom attribute key type
 			propWriteStream.writeString(attributeKey);
 			// Serializing custom attribute value type
@@ -3245,18 +3275,16 @@ bool Item::hasMarketAttributes() const {
 		return true;
 	}
 
-	for (const auto &attribute : getAttributeVector()) {
-		if (attribute.getAttributeType() == ItemAttribute_t::CHARGES && static_cast<uint16_t>(attribute.getInteger()) != items[id].charges) {
-			return false;
-		}
+	if (hasAttribute(ItemAttribute_t::CHARGES) && static_cast<uint16_t>(getInteger(ItemAttribute_t::CHARGES)) != items[id].charges) {
+		return false;
+	}
 
-		if (attribute.getAttributeType() == ItemAttribute_t::DURATION && static_cast<uint32_t>(attribute.getInteger()) != getDefaultDuration()) {
-			return false;
-		}
+	if (hasAttribute(ItemAttribute_t::DURATION) && static_cast<uint32_t>(getInteger(ItemAttribute_t::DURATION)) != getDefaultDuration()) {
+		return false;
+	}
 
-		if (attribute.getAttributeType() == ItemAttribute_t::TIER && static_cast<uint8_t>(attribute.getInteger()) != getTier()) {
-			return false;
-		}
+	if (hasAttribute(ItemAttribute_t::TIER) && static_cast<uint8_t>(getInteger(ItemAttribute_t::TIER)) != getTier()) {
+		return false;
 	}
 
 	return !hasImbuements() && !isStoreItem() && !hasOwner();
@@ -31,7 +31,7 @@ class BedItem;
 class Imbuement;
 class Item;
 
-// This class ItemProperties that serves as an interface to access and modify attributes of an item. The item's attributes are stored in an instance of ItemAttribute. The class ItemProperties has methods to get and set integer and string attributes, check if an attribute exists, remove an attribute, get the underlying attribute bits, and get a vector of attributes. It also has methods to get and set custom attributes, which are stored in a std::map<std::string, CustomAttribute, std::less<>>. The class has a data member attributePtr of type std::unique_ptr<ItemAttribute> that stores a pointer to the item's attributes methods.
+// This class ItemProperties that serves as an interface to access and modify attributes of an item. The item's attributes are stored in an instance of ItemAttribute. The class ItemProperties has methods to get and set integer and string attributes, check if an attribute exists, remove an attribute, and get the underlying attribute bits. It also has methods to get and set custom attributes, which are stored in a list sorted by key. The class has a data member attributePtr of type std::unique_ptr<ItemAttribute> that stores a pointer to the item's attributes methods.
 class ItemProperties {
 public:
 	template <typename T>
@@ -68,20 +68,20 @@ public:
 	}
 
 	bool isAttributeInteger(ItemAttribute_t type) const {
-		return initAttributePtr()->isAttributeInteger(type);
+		return ItemAttributeHelper::isAttributeInteger(type);
 	}
 
 	bool isAttributeString(ItemAttribute_t type) const {
-		return initAttributePtr()->isAttributeString(type);
+		return ItemAttributeHelper::isAttributeString(type);
 	}
 
 	// Custom Attributes
-	const std::map<std::string, CustomAttribute, std::less<>> &getCustomAttributeMap() const {
-		static std::map<std::string, CustomAttribute, std::less<>> map = {};
+	const ItemAttribute::CustomAttributeList &getCustomAttributeList() const {
+		static const ItemAttribute::CustomAttributeList list = {};
 		if (!attributePtr) {
-			return map;
+			return list;
 		}
-		return attributePtr->getCustomAttributeMap();
+		return attributePtr->getCustomAttributeList();
 	}
 	const CustomAttribute* getCustomAttribute(const std::string &attributeName) const {
 		if (!attributePtr) {
@@ -101,7 +101,7 @@ public:
 	}
 
 	bool hasCustomAttribute() const {
-		return !getCustomAttributeMap().empty();
+		return !getCustomAttributeList().empty();
 	}
 
 	bool removeCustomAttribute(const std::string &attributeName) {
@@ -172,13 +172,12 @@ protected:
 		return attributePtr;
 	}
 
-	const std::vector<Attributes> &getAttributeVector() const {
-		static std::vector<Attributes> emptyVector = {};
+	uint64_t getAttributeBits() const {
 		if (!attributePtr) {
-			return emptyVector;
+			return 0;
 		}
 
-		return attributePtr->getAttributeVector();
+		return attributePtr->getAttributeBits();
 	}
 
 	const int64_t &getInteger(ItemAttribute_t type) const {
@@ -327,6 +326,31 @@ public:
 
 	// Returns the player that is holding this item in his inventory
 	std::shared_ptr<Player> getHoldingPlayer();
+	// Moves the item entry in the holding player inventory item index after an in place id, count or tier change
+	void updateInventoryItemIndex(uint16_t oldId, uint8_t oldTier, uint32_t oldCount);
+
+	// Tier changes are tracked by the inventory item index of the holding player
+	template <typename GenericAttribute>
+	void setAttribute(ItemAttribute_t type, GenericAttribute genericAttribute) {
+		if (type != ItemAttribute_t::TIER || !getParent()) {
+			ItemProperties::setAttribute(type, genericAttribute);
+			return;
+		}
+
+		const uint8_t oldTier = getTier();
+		ItemProperties::setAttribute(type, genericAttribute);
+		updateInventoryItemIndex(id, oldTier, count);
+	}
+	void removeAttribute(ItemAttribute_t type) {
+		if (type != ItemAttribute_t::TIER || !getParent()) {
+			ItemProperties::removeAttribute(type);
+			return;
+		}
+
+		const uint8_t oldTier = getTier();
+		ItemProperties::removeAttribute(type);
+		updateInventoryItemIndex(id, oldTier, count);
+	}
 
 	WeaponType_t getWeaponType() const {
 		return items[id].weaponType;
@@ -564,9 +588,7 @@ public:
 	uint32_t getItemAmount() const {
 		return count;
 	}
-	void setItemCount(uint8_t n) {
-		count = n;
-	}
+	void setItemCount(uint8_t n);
 
 	static uint32_t countByType(std::shared_ptr<Item> item, int32_t subType) {
 		if (subType == -1 || subType == item->getSubType()) {
@@ -742,17 +764,7 @@ public:
 
 		return tier;
 	}
-	void setTier(uint8_t tier) {
-		auto configTier = g_configManager().getNumber(FORGE_MAX_ITEM_TIER, __FUNCTION__);
-		if (tier > configTier) {
-			g_logger().error("{} - It is not possible to set a tier higher than {}", __FUNCTION__, configTier);
-			return;
-		}
-
-		if (items[id].upgradeClassification) {
-			setAttribute(ItemAttribute_t::TIER, tier);
-		}
-	}
+	void setTier(uint8_t tier);
 	uint8_t getClassification() const {
 		return items[id].upgradeClassification;
 	}
@@ -771,12 +783,18 @@ protected:
 	bool isLootTrackeable = false;
 	bool decayDisabled = false;
 
+	// Back-pointer into the decay timing wheel, owned by DecayWheel
+	uint32_t decayBucket = 0;
+	uint32_t decayBucketIndex = std::numeric_limits<uint32_t>::max();
+
 private:
 	void setImbuement(uint8_t slot, uint16_t imbuementId, uint32_t duration);
 	// Don't add variables here, use the ItemAttribute class.
 	std::string getWeightDescription(uint32_t weight) const;
 
 	friend class Decay;
+	template <typename>
+	friend class DecayWheel;
 	friend class MapCache;
 };
 
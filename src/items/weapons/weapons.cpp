@@ -360,7 +360,7 @@ bool Weapon::executeUseWeapon(std::shared_ptr<Player> player, const LuaVariant &
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		std::string playerName = player ? player->getName() : "Player nullptr";
 		g_logger().error("[Weapon::executeUseWeapon - Player {} weaponId {}]"
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 playerName, getID());
 		return false;
 	}
@@ -83,6 +83,7 @@ namespace metrics {
 	DEFINE_LATENCY_CLASS(query, "query", "truncated_query");
 	DEFINE_LATENCY_CLASS(task, "task", "task");
 	DEFINE_LATENCY_CLASS(lock, "lock", "scope");
+	DEFINE_LATENCY_CLASS(gc, "gc", "phase");
 
 	const std::vector<std::string> latencyNames {
 		"method_latency",
@@ -90,6 +91,7 @@ namespace metrics {
 		"query_latency",
 		"task_latency",
 		"lock_latency",
+		"gc_latency",
 	};
 
 	class Metrics final {
@@ -189,6 +191,7 @@ namespace metrics {
 	DEFINE_LATENCY_CLASS(query, "query", "truncated_query");
 	DEFINE_LATENCY_CLASS(task, "task", "task");
 	DEFINE_LATENCY_CLASS(lock, "lock", "scope");
+	DEFINE_LATENCY_CLASS(gc, "gc", "phase");
 
 	const std::vector<std::string> latencyNames {
 		"method_latency",
@@ -196,6 +199,7 @@ namespace metrics {
 		"query_latency",
 		"task_latency",
 		"lock_latency",
+		"gc_latency",
 	};
 
 	class Metrics final {
@@ -17,7 +17,7 @@ bool CreatureCallback::startScriptInterface(int32_t scriptId) {
 	if (!scriptInterface->reserveScriptEnv()) {
 		auto targetCreature = m_targetCreature.lock();
 		g_logger().error(
-			"[CreatureCallback::startScriptInterface] - {} {} Call stack overflow. Too many lua script calls being nested.",
+			"[CreatureCallback::startScriptInterface] - {} {} Could not reserve a script environment.",
 			getCreatureClass(targetCreature),
 			targetCreature->getName()
 		);
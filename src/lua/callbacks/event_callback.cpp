@@ -50,7 +50,7 @@ void EventCallback::setType(EventCallback_t type) {
 bool EventCallback::creatureOnChangeOutfit(std::shared_ptr<Creature> creature, const Outfit_t &outfit) const {
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::creatureOnChangeOutfit - Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName());
 		return false;
 	}
@@ -73,7 +73,7 @@ ReturnValue EventCallback::creatureOnAreaCombat(std::shared_ptr<Creature> creatu
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::creatureOnAreaCombat - "
 						 "Creature {} on tile position {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), tile->getPosition().toString());
 		return RETURNVALUE_NOTPOSSIBLE;
 	}
@@ -92,7 +92,7 @@ ReturnValue EventCallback::creatureOnAreaCombat(std::shared_ptr<Creature> creatu
 	}
 
 	LuaScriptInterface::pushUserdata<Tile>(L, tile);
-	LuaScriptInterface::setMetatable(L, -1, "Tile");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Tile);
 
 	LuaScriptInterface::pushBoolean(L, aggressive);
 
@@ -113,7 +113,7 @@ ReturnValue EventCallback::creatureOnTargetCombat(std::shared_ptr<Creature> crea
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::creatureOnTargetCombat - "
 						 "Creature {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), target->getName());
 		return RETURNVALUE_NOTPOSSIBLE;
 	}
@@ -151,7 +151,7 @@ void EventCallback::creatureOnHear(std::shared_ptr<Creature> creature, std::shar
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::creatureOnHear - "
 						 "Creature {} speaker {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), speaker->getName());
 		return;
 	}
@@ -178,7 +178,7 @@ void EventCallback::creatureOnDrainHealth(std::shared_ptr<Creature> creature, st
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::creatureOnDrainHealth - "
 						 "Creature {} attacker {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), attacker->getName());
 		return;
 	}
@@ -230,7 +230,7 @@ bool EventCallback::partyOnJoin(std::shared_ptr<Party> party, std::shared_ptr<Pl
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::partyOnJoin - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -242,10 +242,10 @@ bool EventCallback::partyOnJoin(std::shared_ptr<Party> party, std::shared_ptr<Pl
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	return getScriptInterface()->callFunction(2);
 }
@@ -254,7 +254,7 @@ bool EventCallback::partyOnLeave(std::shared_ptr<Party> party, std::shared_ptr<P
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::partyOnLeave - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -266,10 +266,10 @@ bool EventCallback::partyOnLeave(std::shared_ptr<Party> party, std::shared_ptr<P
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	return getScriptInterface()->callFunction(2);
 }
@@ -289,14 +289,14 @@ bool EventCallback::partyOnDisband(std::shared_ptr<Party> party) const {
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	return getScriptInterface()->callFunction(1);
 }
 
 void EventCallback::partyOnShareExperience(std::shared_ptr<Party> party, uint64_t &exp) const {
 	if (!getScriptInterface()->reserveScriptEnv()) {
-		g_logger().error("Party leader {}. Call stack overflow. Too many lua script calls being nested.", party->getLeader() ? party->getLeader()->getName() : "unknown");
+		g_logger().error("Party leader {}. Could not reserve a script environment.", party->getLeader() ? party->getLeader()->getName() : "unknown");
 		return;
 	}
 
@@ -307,7 +307,7 @@ void EventCallback::partyOnShareExperience(std::shared_ptr<Party> party, uint64_
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	lua_pushnumber(L, exp);
 
@@ -326,7 +326,7 @@ bool EventCallback::playerOnBrowseField(std::shared_ptr<Player> player, const Po
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnBrowseField - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -338,7 +338,7 @@ bool EventCallback::playerOnBrowseField(std::shared_ptr<Player> player, const Po
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushPosition(L, position);
 
@@ -349,7 +349,7 @@ void EventCallback::playerOnLook(std::shared_ptr<Player> player, const Position
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnLook - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -361,7 +361,7 @@ void EventCallback::playerOnLook(std::shared_ptr<Player> player, const Position
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	if (std::shared_ptr<Creature> creature = thing->getCreature()) {
 		LuaScriptInterface::pushUserdata<Creature>(L, creature);
@@ -383,7 +383,7 @@ void EventCallback::playerOnLookInBattleList(std::shared_ptr<Player> player, std
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnLookInBattleList - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -395,7 +395,7 @@ void EventCallback::playerOnLookInBattleList(std::shared_ptr<Player> player, std
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Creature>(L, creature);
 	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
@@ -409,7 +409,7 @@ void EventCallback::playerOnLookInTrade(std::shared_ptr<Player> player, std::sha
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnLookInTrade - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -421,10 +421,10 @@ void EventCallback::playerOnLookInTrade(std::shared_ptr<Player> player, std::sha
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Player>(L, partner);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -438,7 +438,7 @@ bool EventCallback::playerOnLookInShop(std::shared_ptr<Player> player, const Ite
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnLookInShop - "
 						 "Player {} itemType {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), itemType->getPluralName());
 		return false;
 	}
@@ -450,10 +450,10 @@ bool EventCallback::playerOnLookInShop(std::shared_ptr<Player> player, const Ite
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<const ItemType>(L, itemType);
-	LuaScriptInterface::setMetatable(L, -1, "ItemType");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::ItemType);
 
 	lua_pushnumber(L, count);
 
@@ -464,7 +464,7 @@ void EventCallback::playerOnRemoveCount(std::shared_ptr<Player> player, std::sha
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnMove - "
 						 "Player {} item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return;
 	}
@@ -476,7 +476,7 @@ void EventCallback::playerOnRemoveCount(std::shared_ptr<Player> player, std::sha
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -492,7 +492,7 @@ bool EventCallback::playerOnMoveItem(std::shared_ptr<Player> player, std::shared
 
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[Action::executeUse - Player {}, on item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return false;
 	}
@@ -505,7 +505,7 @@ bool EventCallback::playerOnMoveItem(std::shared_ptr<Player> player, std::shared
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushThing(L, item);
 
@@ -523,7 +523,7 @@ void EventCallback::playerOnItemMoved(std::shared_ptr<Player> player, std::share
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnItemMoved - "
 						 "Player {} item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return;
 	}
@@ -535,7 +535,7 @@ void EventCallback::playerOnItemMoved(std::shared_ptr<Player> player, std::share
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -554,7 +554,7 @@ void EventCallback::playerOnChangeZone(std::shared_ptr<Player> player, ZoneType_
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnChangeZone - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -566,7 +566,7 @@ void EventCallback::playerOnChangeZone(std::shared_ptr<Player> player, ZoneType_
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, zone);
 	getScriptInterface()->callVoidFunction(2);
@@ -576,7 +576,7 @@ bool EventCallback::playerOnMoveCreature(std::shared_ptr<Player> player, std::sh
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnMoveCreature - "
 						 "Player {} creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), creature->getName());
 		return false;
 	}
@@ -588,7 +588,7 @@ bool EventCallback::playerOnMoveCreature(std::shared_ptr<Player> player, std::sh
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Creature>(L, creature);
 	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
@@ -603,7 +603,7 @@ void EventCallback::playerOnReportRuleViolation(std::shared_ptr<Player> player,
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnReportRuleViolation - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -615,7 +615,7 @@ void EventCallback::playerOnReportRuleViolation(std::shared_ptr<Player> player,
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushString(L, targetName);
 
@@ -632,7 +632,7 @@ void EventCallback::playerOnReportBug(std::shared_ptr<Player> player, const std:
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnReportBug - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -644,7 +644,7 @@ void EventCallback::playerOnReportBug(std::shared_ptr<Player> player, const std:
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushString(L, message);
 	LuaScriptInterface::pushPosition(L, position);
@@ -657,7 +657,7 @@ bool EventCallback::playerOnTurn(std::shared_ptr<Player> player, Direction direc
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnTurn - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -669,7 +669,7 @@ bool EventCallback::playerOnTurn(std::shared_ptr<Player> player, Direction direc
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, direction);
 
@@ -680,7 +680,7 @@ bool EventCallback::playerOnTradeRequest(std::shared_ptr<Player> player, std::sh
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnTradeRequest - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return false;
 	}
@@ -692,10 +692,10 @@ bool EventCallback::playerOnTradeRequest(std::shared_ptr<Player> player, std::sh
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -707,7 +707,7 @@ bool EventCallback::playerOnTradeAccept(std::shared_ptr<Player> player, std::sha
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnTradeAccept - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return false;
 	}
@@ -719,10 +719,10 @@ bool EventCallback::playerOnTradeAccept(std::shared_ptr<Player> player, std::sha
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -737,7 +737,7 @@ void EventCallback::playerOnGainExperience(std::shared_ptr<Player> player, std::
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnGainExperience - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return;
 	}
@@ -749,7 +749,7 @@ void EventCallback::playerOnGainExperience(std::shared_ptr<Player> player, std::
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	if (target) {
 		LuaScriptInterface::pushUserdata<Creature>(L, target);
@@ -775,7 +775,7 @@ void EventCallback::playerOnLoseExperience(std::shared_ptr<Player> player, uint6
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnLoseExperience - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -787,7 +787,7 @@ void EventCallback::playerOnLoseExperience(std::shared_ptr<Player> player, uint6
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, exp);
 
@@ -805,7 +805,7 @@ void EventCallback::playerOnGainSkillTries(std::shared_ptr<Player> player, skill
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnGainSkillTries - "
 						 "Player {} skill {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), fmt::underlying(skill));
 		return;
 	}
@@ -817,7 +817,7 @@ void EventCallback::playerOnGainSkillTries(std::shared_ptr<Player> player, skill
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, skill);
 	lua_pushnumber(L, tries);
@@ -836,7 +836,7 @@ void EventCallback::playerOnCombat(std::shared_ptr<Player> player, std::shared_p
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnCombat - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return;
 	}
@@ -848,7 +848,7 @@ void EventCallback::playerOnCombat(std::shared_ptr<Player> player, std::shared_p
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	if (target) {
 		LuaScriptInterface::pushUserdata<Creature>(L, target);
@@ -859,7 +859,7 @@ void EventCallback::playerOnCombat(std::shared_ptr<Player> player, std::shared_p
 
 	if (item) {
 		LuaScriptInterface::pushUserdata<Item>(L, item);
-		LuaScriptInterface::setMetatable(L, -1, "Item");
+		LuaScriptInterface::setMetatable(L, -1, LuaData_t::Item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -898,7 +898,7 @@ void EventCallback::playerOnRequestQuestLog(std::shared_ptr<Player> player) cons
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnRequestQuestLog - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -910,7 +910,7 @@ void EventCallback::playerOnRequestQuestLog(std::shared_ptr<Player> player) cons
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	getScriptInterface()->callVoidFunction(1);
 }
@@ -919,7 +919,7 @@ void EventCallback::playerOnRequestQuestLine(std::shared_ptr<Player> player, uin
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::playerOnRequestQuestLine - "
 						 "Player {} questId {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), questId);
 		return;
 	}
@@ -931,7 +931,7 @@ void EventCallback::playerOnRequestQuestLine(std::shared_ptr<Player> player, uin
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, questId);
 
@@ -940,7 +940,7 @@ void EventCallback::playerOnRequestQuestLine(std::shared_ptr<Player> player, uin
 
 void EventCallback::playerOnInventoryUpdate(std::shared_ptr<Player> player, std::shared_ptr<Item> item, Slots_t slot, bool equip) const {
 	if (!getScriptInterface()->reserveScriptEnv()) {
-		g_logger().error("[{}] Call stack overflow", __FUNCTION__);
+		g_logger().error("[{}] Could not reserve a script environment", __FUNCTION__);
 		return;
 	}
 
@@ -951,7 +951,7 @@ void EventCallback::playerOnInventoryUpdate(std::shared_ptr<Player> player, std:
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -964,7 +964,7 @@ void EventCallback::playerOnInventoryUpdate(std::shared_ptr<Player> player, std:
 
 bool EventCallback::playerOnRotateItem(std::shared_ptr<Player> player, std::shared_ptr<Item> item, const Position &position) const {
 	if (!getScriptInterface()->reserveScriptEnv()) {
-		g_logger().error("[{}] Call stack overflow", __FUNCTION__);
+		g_logger().error("[{}] Could not reserve a script environment", __FUNCTION__);
 		return false;
 	}
 
@@ -975,7 +975,7 @@ bool EventCallback::playerOnRotateItem(std::shared_ptr<Player> player, std::shar
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -989,7 +989,7 @@ void EventCallback::playerOnStorageUpdate(std::shared_ptr<Player> player, const
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::eventOnStorageUpdate - "
 						 "Player {} key {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), key);
 		return;
 	}
@@ -1001,7 +1001,7 @@ void EventCallback::playerOnStorageUpdate(std::shared_ptr<Player> player, const
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, key);
 	lua_pushnumber(L, value);
@@ -1016,7 +1016,7 @@ void EventCallback::monsterOnDropLoot(std::shared_ptr<Monster> monster, std::sha
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::monsterOnDropLoot - "
 						 "Monster corpse {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 corpse->getName());
 		return;
 	}
@@ -1028,10 +1028,10 @@ void EventCallback::monsterOnDropLoot(std::shared_ptr<Monster> monster, std::sha
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Monster);
 
 	LuaScriptInterface::pushUserdata<Container>(L, corpse);
-	LuaScriptInterface::setMetatable(L, -1, "Container");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Container);
 
 	return getScriptInterface()->callVoidFunction(2);
 }
@@ -1040,7 +1040,7 @@ void EventCallback::monsterPostDropLoot(std::shared_ptr<Monster> monster, std::s
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::monsterPostDropLoot - "
 						 "Monster corpse {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 corpse->getName());
 		return;
 	}
@@ -1052,10 +1052,10 @@ void EventCallback::monsterPostDropLoot(std::shared_ptr<Monster> monster, std::s
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Monster);
 
 	LuaScriptInterface::pushUserdata<Container>(L, corpse);
-	LuaScriptInterface::setMetatable(L, -1, "Container");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Container);
 
 	return getScriptInterface()->callVoidFunction(2);
 }
@@ -1064,7 +1064,7 @@ void EventCallback::monsterOnSpawn(std::shared_ptr<Monster> monster, const Posit
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("{} - "
 						 "Position {}"
-						 ". Call stack overflow. Too many lua script calls being nested.",
+						 ". Could not reserve a script environment.",
 						 __FUNCTION__, position.toString());
 		return;
 	}
@@ -1076,7 +1076,7 @@ void EventCallback::monsterOnSpawn(std::shared_ptr<Monster> monster, const Posit
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Monster);
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (getScriptInterface()->protectedCall(L, 2, 1) != 0) {
@@ -1093,7 +1093,7 @@ void EventCallback::npcOnSpawn(std::shared_ptr<Npc> npc, const Position &positio
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("{} - "
 						 "Position {}"
-						 ". Call stack overflow. Too many lua script calls being nested.",
+						 ". Could not reserve a script environment.",
 						 __FUNCTION__, position.toString());
 		return;
 	}
@@ -1105,7 +1105,7 @@ void EventCallback::npcOnSpawn(std::shared_ptr<Npc> npc, const Position &positio
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Npc>(L, npc);
-	LuaScriptInterface::setMetatable(L, -1, "Npc");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Npc);
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (getScriptInterface()->protectedCall(L, 2, 1) != 0) {
@@ -1121,7 +1121,7 @@ bool EventCallback::zoneBeforeCreatureEnter(std::shared_ptr<Zone> zone, std::sha
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::zoneBeforeCreatureEnter - "
 						 "Zone {} Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 zone->getName(), creature->getName());
 		return false;
 	}
@@ -1145,7 +1145,7 @@ bool EventCallback::zoneBeforeCreatureLeave(std::shared_ptr<Zone> zone, std::sha
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::zoneBeforeCreatureLeave - "
 						 "Zone {} Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 zone->getName(), creature->getName());
 		return false;
 	}
@@ -1169,7 +1169,7 @@ void EventCallback::zoneAfterCreatureEnter(std::shared_ptr<Zone> zone, std::shar
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::zoneAfterCreatureEnter - "
 						 "Zone {} Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 zone->getName(), creature->getName());
 		return;
 	}
@@ -1193,7 +1193,7 @@ void EventCallback::zoneAfterCreatureLeave(std::shared_ptr<Zone> zone, std::shar
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[EventCallback::zoneAfterCreatureLeave - "
 						 "Zone {} Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 zone->getName(), creature->getName());
 		return;
 	}
@@ -12,6 +12,7 @@
 #include "lua/callbacks/callbacks_definitions.hpp"
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/scripts/luascript.hpp"
+#include "lib/metrics/metrics.hpp"
 
 class EventCallback;
 
@@ -60,9 +61,18 @@ public:
 	/**
 	 * @brief Gets event callbacks by their type.
 	 * @param type The type of callbacks to retrieve.
-	 * @return Vector of pointers to EventCallback objects of the specified type.
+	 * @return Reference to the prebuilt dispatch list of the specified type.
 	 */
-	std::vector<std::shared_ptr<EventCallback>> getCallbacksByType(EventCallback_t type) const;
+	const std::vector<std::shared_ptr<EventCallback>> &getCallbacksByType(EventCallback_t type) const;
+
+	/**
+	 * @brief Checks if there is any registered callback of the specified type.
+	 * @param type The type of callbacks to check.
+	 * @return True if at least one callback is registered for the type.
+	 */
+	bool hasCallbacks(EventCallback_t type) const {
+		return !m_callbacksByType[static_cast<size_t>(type)].empty();
+	}
 
 	/**
 	 * @brief Clears all registered event callbacks.
@@ -71,21 +81,25 @@ public:
 
 	/**
 	 * @brief Executes the specified event callback.
+	 * @details Arguments are passed by reference to every callback, so callbacks
+	 * taking output parameters (e.g. experience) see the changes of the previous ones.
 	 * @param eventType The type of event to trigger.
 	 * @param callbackFunc Function pointer to the callback method.
 	 * @param args Variadic arguments to pass to the callback function.
 	 */
 	template <typename CallbackFunc, typename... Args>
 	void executeCallback(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
-		for (const auto &callback : getCallbacksByType(eventType)) {
-			auto argsCopy = std::make_tuple(args...);
+		const auto &callbacks = m_callbacksByType[static_cast<size_t>(eventType)];
+		if (callbacks.empty()) {
+			return;
+		}
+
+		metrics::lua_latency measure(magic_enum::enum_name(eventType));
+		// Index based, a callback may register new callbacks while running
+		for (size_t i = 0; i < callbacks.size(); ++i) {
+			const auto &callback = callbacks[i];
 			if (callback && callback->isLoadedCallback()) {
-				std::apply(
-					[&callback, &callbackFunc](auto &&... args) {
-						((*callback).*callbackFunc)(std::forward<decltype(args)>(args)...);
-					},
-					argsCopy
-				);
+				((*callback).*callbackFunc)(args...);
 			}
 		}
 	}
@@ -99,17 +113,17 @@ public:
 	 */
 	template <typename CallbackFunc, typename... Args>
 	bool checkCallback(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
-		bool allCallbacksSucceeded = true;
+		const auto &callbacks = m_callbacksByType[static_cast<size_t>(eventType)];
+		if (callbacks.empty()) {
+			return true;
+		}
 
-		for (const auto &callback : getCallbacksByType(eventType)) {
-			auto argsCopy = std::make_tuple(args...);
+		metrics::lua_latency measure(magic_enum::enum_name(eventType));
+		bool allCallbacksSucceeded = true;
+		for (size_t i = 0; i < callbacks.size(); ++i) {
+			const auto &callback = callbacks[i];
 			if (callback && callback->isLoadedCallback()) {
-				bool callbackResult = std::apply(
-					[&callback, &callbackFunc](auto &&... args) {
-						return ((*callback).*callbackFunc)(std::forward<decltype(args)>(args)...);
-					},
-					argsCopy
-				);
+				bool callbackResult = ((*callback).*callbackFunc)(args...);
 				allCallbacksSucceeded = allCallbacksSucceeded && callbackResult;
 			}
 		}
@@ -119,6 +133,8 @@ public:
 private:
 	// Container for storing registered event callbacks.
 	std::vector<std::shared_ptr<EventCallback>> m_callbacks;
+	// Dispatch lists indexed by event type, rebuilt when callbacks are registered or cleared.
+	std::array<std::vector<std::shared_ptr<EventCallback>>, magic_enum::enum_count<EventCallback_t>()> m_callbacksByType;
 };
 
 constexpr auto g_callbacks = EventsCallbacks::getInstance;
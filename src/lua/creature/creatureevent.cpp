@@ -175,7 +175,7 @@ bool CreatureEvent::executeOnLogin(std::shared_ptr<Player> player) const {
 	// onLogin(player)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeOnLogin - Player {} event {}]"
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return false;
 	}
@@ -187,7 +187,7 @@ bool CreatureEvent::executeOnLogin(std::shared_ptr<Player> player) const {
 
 	getScriptInterface()->pushFunction(getScriptId());
 	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 	return getScriptInterface()->callFunction(1);
 }
 
@@ -195,7 +195,7 @@ bool CreatureEvent::executeOnLogout(std::shared_ptr<Player> player) const {
 	// onLogout(player)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeOnLogout - Player {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return false;
 	}
@@ -207,7 +207,7 @@ bool CreatureEvent::executeOnLogout(std::shared_ptr<Player> player) const {
 
 	getScriptInterface()->pushFunction(getScriptId());
 	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 	return getScriptInterface()->callFunction(1);
 }
 
@@ -215,7 +215,7 @@ bool CreatureEvent::executeOnThink(std::shared_ptr<Creature> creature, uint32_t
 	// onThink(creature, interval)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeOnThink - Creature {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), getName());
 		return false;
 	}
@@ -237,7 +237,7 @@ bool CreatureEvent::executeOnPrepareDeath(std::shared_ptr<Creature> creature, st
 	// onPrepareDeath(creature, killer)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeOnPrepareDeath - Creature {} killer {}"
-						 " event {}] Call stack overflow. Too many lua script calls being nested.",
+						 " event {}] Could not reserve a script environment.",
 						 creature->getName(), killer->getName(), getName());
 		return false;
 	}
@@ -266,7 +266,7 @@ bool CreatureEvent::executeOnDeath(std::shared_ptr<Creature> creature, std::shar
 	// onDeath(creature, corpse, lasthitkiller, mostdamagekiller, lasthitunjustified, mostdamageunjustified)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeOnDeath - Creature {} killer {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), killer->getName(), getName());
 		return false;
 	}
@@ -306,7 +306,7 @@ bool CreatureEvent::executeAdvance(std::shared_ptr<Player> player, skills_t skil
 	// onAdvance(player, skill, oldLevel, newLevel)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeAdvance - Player {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return false;
 	}
@@ -318,7 +318,7 @@ bool CreatureEvent::executeAdvance(std::shared_ptr<Player> player, skills_t skil
 
 	getScriptInterface()->pushFunction(getScriptId());
 	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 	lua_pushnumber(L, static_cast<uint32_t>(skill));
 	lua_pushnumber(L, oldLevel);
 	lua_pushnumber(L, newLevel);
@@ -336,7 +336,7 @@ void CreatureEvent::executeOnKill(std::shared_ptr<Creature> creature, std::share
 					creature->getName(), target->getName(), getName());
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeOnKill - Creature {} target {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), target->getName(), getName());
 		return;
 	}
@@ -360,7 +360,7 @@ void CreatureEvent::executeModalWindow(std::shared_ptr<Player> player, uint32_t
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeModalWindow - "
 						 "Player {} modaw window id {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), modalWindowId, getName());
 		return;
 	}
@@ -372,7 +372,7 @@ void CreatureEvent::executeModalWindow(std::shared_ptr<Player> player, uint32_t
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, modalWindowId);
 	lua_pushnumber(L, buttonId);
@@ -385,7 +385,7 @@ bool CreatureEvent::executeTextEdit(std::shared_ptr<Player> player, std::shared_
 	// onTextEdit(player, item, text)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeTextEdit - Player {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return false;
 	}
@@ -397,7 +397,7 @@ bool CreatureEvent::executeTextEdit(std::shared_ptr<Player> player, std::shared_
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushThing(L, item);
 	LuaScriptInterface::pushString(L, text);
@@ -410,7 +410,7 @@ void CreatureEvent::executeHealthChange(std::shared_ptr<Creature> creature, std:
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeHealthChange - "
 						 "Creature {} attacker {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), attacker->getName(), getName());
 		return;
 	}
@@ -455,7 +455,7 @@ void CreatureEvent::executeManaChange(std::shared_ptr<Creature> creature, std::s
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeManaChange - "
 						 "Creature {} attacker {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), attacker->getName(), getName());
 		return;
 	}
@@ -495,7 +495,7 @@ void CreatureEvent::executeExtendedOpcode(std::shared_ptr<Player> player, uint8_
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[CreatureEvent::executeExtendedOpcode - "
 						 "Player {} event {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), getName());
 		return;
 	}
@@ -508,7 +508,7 @@ void CreatureEvent::executeExtendedOpcode(std::shared_ptr<Player> player, uint8_
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, opcode);
 	LuaScriptInterface::pushString(L, buffer);
@@ -159,7 +159,7 @@ void Events::eventMonsterOnSpawn(std::shared_ptr<Monster> monster, const Positio
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("{} - "
 						 "Position {}"
-						 ". Call stack overflow. Too many lua script calls being nested.",
+						 ". Could not reserve a script environment.",
 						 __FUNCTION__, position.toString());
 		return;
 	}
@@ -171,7 +171,7 @@ void Events::eventMonsterOnSpawn(std::shared_ptr<Monster> monster, const Positio
 	scriptInterface.pushFunction(info.monsterOnSpawn);
 
 	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Monster);
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (scriptInterface.protectedCall(L, 2, 1) != 0) {
@@ -193,7 +193,7 @@ void Events::eventNpcOnSpawn(std::shared_ptr<Npc> npc, const Position &position)
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("{} - "
 						 "Position {}"
-						 ". Call stack overflow. Too many lua script calls being nested.",
+						 ". Could not reserve a script environment.",
 						 __FUNCTION__, position.toString());
 		return;
 	}
@@ -205,7 +205,7 @@ void Events::eventNpcOnSpawn(std::shared_ptr<Npc> npc, const Position &position)
 	scriptInterface.pushFunction(info.npcOnSpawn);
 
 	LuaScriptInterface::pushUserdata<Npc>(L, npc);
-	LuaScriptInterface::setMetatable(L, -1, "Npc");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Npc);
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (scriptInterface.protectedCall(L, 2, 1) != 0) {
@@ -226,7 +226,7 @@ bool Events::eventCreatureOnChangeOutfit(std::shared_ptr<Creature> creature, con
 
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventCreatureOnChangeOutfit - Creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName());
 		return false;
 	}
@@ -254,7 +254,7 @@ ReturnValue Events::eventCreatureOnAreaCombat(std::shared_ptr<Creature> creature
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventCreatureOnAreaCombat - "
 						 "Creature {} on tile position {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), tile->getPosition().toString());
 		return RETURNVALUE_NOTPOSSIBLE;
 	}
@@ -273,7 +273,7 @@ ReturnValue Events::eventCreatureOnAreaCombat(std::shared_ptr<Creature> creature
 	}
 
 	LuaScriptInterface::pushUserdata<Tile>(L, tile);
-	LuaScriptInterface::setMetatable(L, -1, "Tile");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Tile);
 
 	LuaScriptInterface::pushBoolean(L, aggressive);
 
@@ -299,7 +299,7 @@ ReturnValue Events::eventCreatureOnTargetCombat(std::shared_ptr<Creature> creatu
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventCreatureOnTargetCombat - "
 						 "Creature {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), target->getName());
 		return RETURNVALUE_NOTPOSSIBLE;
 	}
@@ -342,7 +342,7 @@ void Events::eventCreatureOnHear(std::shared_ptr<Creature> creature, std::shared
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventCreatureOnHear - "
 						 "Creature {} speaker {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), speaker->getName());
 		return;
 	}
@@ -373,7 +373,7 @@ void Events::eventCreatureOnDrainHealth(std::shared_ptr<Creature> creature, std:
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventCreatureOnDrainHealth - "
 						 "Creature {} attacker {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 creature->getName(), attacker->getName());
 		return;
 	}
@@ -430,7 +430,7 @@ bool Events::eventPartyOnJoin(std::shared_ptr<Party> party, std::shared_ptr<Play
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPartyOnJoin - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -442,10 +442,10 @@ bool Events::eventPartyOnJoin(std::shared_ptr<Party> party, std::shared_ptr<Play
 	scriptInterface.pushFunction(info.partyOnJoin);
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -459,7 +459,7 @@ bool Events::eventPartyOnLeave(std::shared_ptr<Party> party, std::shared_ptr<Pla
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPartyOnLeave - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -471,10 +471,10 @@ bool Events::eventPartyOnLeave(std::shared_ptr<Party> party, std::shared_ptr<Pla
 	scriptInterface.pushFunction(info.partyOnLeave);
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -499,7 +499,7 @@ bool Events::eventPartyOnDisband(std::shared_ptr<Party> party) {
 	scriptInterface.pushFunction(info.partyOnDisband);
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	return scriptInterface.callFunction(1);
 }
@@ -511,7 +511,7 @@ void Events::eventPartyOnShareExperience(std::shared_ptr<Party> party, uint64_t
 	}
 
 	if (!scriptInterface.reserveScriptEnv()) {
-		g_logger().error("Party leader {}. Call stack overflow. Too many lua script calls being nested.", party->getLeader() ? party->getLeader()->getName() : "unknown");
+		g_logger().error("Party leader {}. Could not reserve a script environment.", party->getLeader() ? party->getLeader()->getName() : "unknown");
 		return;
 	}
 
@@ -522,7 +522,7 @@ void Events::eventPartyOnShareExperience(std::shared_ptr<Party> party, uint64_t
 	scriptInterface.pushFunction(info.partyOnShareExperience);
 
 	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Party);
 
 	lua_pushnumber(L, exp);
 
@@ -546,7 +546,7 @@ bool Events::eventPlayerOnBrowseField(std::shared_ptr<Player> player, const Posi
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnBrowseField - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -558,7 +558,7 @@ bool Events::eventPlayerOnBrowseField(std::shared_ptr<Player> player, const Posi
 	scriptInterface.pushFunction(info.playerOnBrowseField);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushPosition(L, position);
 
@@ -574,7 +574,7 @@ void Events::eventPlayerOnLook(std::shared_ptr<Player> player, const Position &p
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnLook - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -586,7 +586,7 @@ void Events::eventPlayerOnLook(std::shared_ptr<Player> player, const Position &p
 	scriptInterface.pushFunction(info.playerOnLook);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	if (std::shared_ptr<Creature> creature = thing->getCreature()) {
 		LuaScriptInterface::pushUserdata<Creature>(L, creature);
@@ -613,7 +613,7 @@ void Events::eventPlayerOnLookInBattleList(std::shared_ptr<Player> player, std::
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnLookInBattleList - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -625,7 +625,7 @@ void Events::eventPlayerOnLookInBattleList(std::shared_ptr<Player> player, std::
 	scriptInterface.pushFunction(info.playerOnLookInBattleList);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Creature>(L, creature);
 	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
@@ -644,7 +644,7 @@ void Events::eventPlayerOnLookInTrade(std::shared_ptr<Player> player, std::share
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnLookInTrade - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -656,10 +656,10 @@ void Events::eventPlayerOnLookInTrade(std::shared_ptr<Player> player, std::share
 	scriptInterface.pushFunction(info.playerOnLookInTrade);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Player>(L, partner);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -678,7 +678,7 @@ bool Events::eventPlayerOnLookInShop(std::shared_ptr<Player> player, const ItemT
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnLookInShop - "
 						 "Player {} itemType {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), itemType->getPluralName());
 		return false;
 	}
@@ -690,10 +690,10 @@ bool Events::eventPlayerOnLookInShop(std::shared_ptr<Player> player, const ItemT
 	scriptInterface.pushFunction(info.playerOnLookInShop);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<const ItemType>(L, itemType);
-	LuaScriptInterface::setMetatable(L, -1, "ItemType");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::ItemType);
 
 	lua_pushnumber(L, count);
 
@@ -709,7 +709,7 @@ bool Events::eventPlayerOnRemoveCount(std::shared_ptr<Player> player, std::share
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnMove - "
 						 "Player {} item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return false;
 	}
@@ -721,7 +721,7 @@ bool Events::eventPlayerOnRemoveCount(std::shared_ptr<Player> player, std::share
 	scriptInterface.pushFunction(info.playerOnRemoveCount);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -738,7 +738,7 @@ bool Events::eventPlayerOnMoveItem(std::shared_ptr<Player> player, std::shared_p
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnMoveItem - "
 						 "Player {} item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return false;
 	}
@@ -750,7 +750,7 @@ bool Events::eventPlayerOnMoveItem(std::shared_ptr<Player> player, std::shared_p
 	scriptInterface.pushFunction(info.playerOnMoveItem);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -774,7 +774,7 @@ void Events::eventPlayerOnItemMoved(std::shared_ptr<Player> player, std::shared_
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnItemMoved - "
 						 "Player {} item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return;
 	}
@@ -786,7 +786,7 @@ void Events::eventPlayerOnItemMoved(std::shared_ptr<Player> player, std::shared_
 	scriptInterface.pushFunction(info.playerOnItemMoved);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -810,7 +810,7 @@ void Events::eventPlayerOnChangeZone(std::shared_ptr<Player> player, ZoneType_t
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnChangeZone - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -822,7 +822,7 @@ void Events::eventPlayerOnChangeZone(std::shared_ptr<Player> player, ZoneType_t
 	scriptInterface.pushFunction(info.playerOnChangeZone);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, zone);
 	scriptInterface.callVoidFunction(2);
@@ -837,7 +837,7 @@ bool Events::eventPlayerOnMoveCreature(std::shared_ptr<Player> player, std::shar
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnMoveCreature - "
 						 "Player {} creature {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), creature->getName());
 		return false;
 	}
@@ -849,7 +849,7 @@ bool Events::eventPlayerOnMoveCreature(std::shared_ptr<Player> player, std::shar
 	scriptInterface.pushFunction(info.playerOnMoveCreature);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Creature>(L, creature);
 	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
@@ -869,7 +869,7 @@ void Events::eventPlayerOnReportRuleViolation(std::shared_ptr<Player> player, co
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnReportRuleViolation - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -881,7 +881,7 @@ void Events::eventPlayerOnReportRuleViolation(std::shared_ptr<Player> player, co
 	scriptInterface.pushFunction(info.playerOnReportRuleViolation);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushString(L, targetName);
 
@@ -903,7 +903,7 @@ bool Events::eventPlayerOnReportBug(std::shared_ptr<Player> player, const std::s
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnReportBug - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -915,7 +915,7 @@ bool Events::eventPlayerOnReportBug(std::shared_ptr<Player> player, const std::s
 	scriptInterface.pushFunction(info.playerOnReportBug);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushString(L, message);
 	LuaScriptInterface::pushPosition(L, position);
@@ -933,7 +933,7 @@ bool Events::eventPlayerOnTurn(std::shared_ptr<Player> player, Direction directi
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnTurn - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return false;
 	}
@@ -945,7 +945,7 @@ bool Events::eventPlayerOnTurn(std::shared_ptr<Player> player, Direction directi
 	scriptInterface.pushFunction(info.playerOnTurn);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, direction);
 
@@ -961,7 +961,7 @@ bool Events::eventPlayerOnTradeRequest(std::shared_ptr<Player> player, std::shar
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnTradeRequest - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return false;
 	}
@@ -973,10 +973,10 @@ bool Events::eventPlayerOnTradeRequest(std::shared_ptr<Player> player, std::shar
 	scriptInterface.pushFunction(info.playerOnTradeRequest);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -993,7 +993,7 @@ bool Events::eventPlayerOnTradeAccept(std::shared_ptr<Player> player, std::share
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnTradeAccept - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return false;
 	}
@@ -1005,10 +1005,10 @@ bool Events::eventPlayerOnTradeAccept(std::shared_ptr<Player> player, std::share
 	scriptInterface.pushFunction(info.playerOnTradeAccept);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -1029,7 +1029,7 @@ void Events::eventPlayerOnGainExperience(std::shared_ptr<Player> player, std::sh
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnGainExperience - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return;
 	}
@@ -1041,7 +1041,7 @@ void Events::eventPlayerOnGainExperience(std::shared_ptr<Player> player, std::sh
 	scriptInterface.pushFunction(info.playerOnGainExperience);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	if (target) {
 		LuaScriptInterface::pushUserdata<Creature>(L, target);
@@ -1072,7 +1072,7 @@ void Events::eventPlayerOnLoseExperience(std::shared_ptr<Player> player, uint64_
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnLoseExperience - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -1084,7 +1084,7 @@ void Events::eventPlayerOnLoseExperience(std::shared_ptr<Player> player, uint64_
 	scriptInterface.pushFunction(info.playerOnLoseExperience);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, exp);
 
@@ -1107,7 +1107,7 @@ void Events::eventPlayerOnGainSkillTries(std::shared_ptr<Player> player, skills_
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnGainSkillTries - "
 						 "Player {} skill {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), fmt::underlying(skill));
 		return;
 	}
@@ -1119,7 +1119,7 @@ void Events::eventPlayerOnGainSkillTries(std::shared_ptr<Player> player, skills_
 	scriptInterface.pushFunction(info.playerOnGainSkillTries);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, skill);
 	lua_pushnumber(L, tries);
@@ -1143,7 +1143,7 @@ void Events::eventPlayerOnCombat(std::shared_ptr<Player> player, std::shared_ptr
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnCombat - "
 						 "Player {} target {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), target->getName());
 		return;
 	}
@@ -1155,7 +1155,7 @@ void Events::eventPlayerOnCombat(std::shared_ptr<Player> player, std::shared_ptr
 	scriptInterface.pushFunction(info.playerOnCombat);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	if (target) {
 		LuaScriptInterface::pushUserdata<Creature>(L, target);
@@ -1166,7 +1166,7 @@ void Events::eventPlayerOnCombat(std::shared_ptr<Player> player, std::shared_ptr
 
 	if (item) {
 		LuaScriptInterface::pushUserdata<Item>(L, item);
-		LuaScriptInterface::setMetatable(L, -1, "Item");
+		LuaScriptInterface::setMetatable(L, -1, LuaData_t::Item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1200,7 +1200,7 @@ void Events::eventPlayerOnRequestQuestLog(std::shared_ptr<Player> player) {
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnRequestQuestLog - "
 						 "Player {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName());
 		return;
 	}
@@ -1212,7 +1212,7 @@ void Events::eventPlayerOnRequestQuestLog(std::shared_ptr<Player> player) {
 	scriptInterface.pushFunction(info.playerOnRequestQuestLog);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	scriptInterface.callVoidFunction(1);
 }
@@ -1226,7 +1226,7 @@ void Events::eventPlayerOnRequestQuestLine(std::shared_ptr<Player> player, uint1
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventPlayerOnRequestQuestLine - "
 						 "Player {} questId {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), questId);
 		return;
 	}
@@ -1238,7 +1238,7 @@ void Events::eventPlayerOnRequestQuestLine(std::shared_ptr<Player> player, uint1
 	scriptInterface.pushFunction(info.playerOnRequestQuestLine);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, questId);
 
@@ -1252,7 +1252,7 @@ void Events::eventPlayerOnInventoryUpdate(std::shared_ptr<Player> player, std::s
 	}
 
 	if (!scriptInterface.reserveScriptEnv()) {
-		g_logger().error("[{}] Call stack overflow", __FUNCTION__);
+		g_logger().error("[{}] Could not reserve a script environment", __FUNCTION__);
 		return;
 	}
 
@@ -1263,7 +1263,7 @@ void Events::eventPlayerOnInventoryUpdate(std::shared_ptr<Player> player, std::s
 	scriptInterface.pushFunction(info.playerOnInventoryUpdate);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<Item>(L, item);
 	LuaScriptInterface::setItemMetatable(L, -1, item);
@@ -1283,7 +1283,7 @@ void Events::eventOnStorageUpdate(std::shared_ptr<Player> player, const uint32_t
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventOnStorageUpdate - "
 						 "Player {} key {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), key);
 		return;
 	}
@@ -1295,7 +1295,7 @@ void Events::eventOnStorageUpdate(std::shared_ptr<Player> player, const uint32_t
 	scriptInterface.pushFunction(info.playerOnStorageUpdate);
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	lua_pushnumber(L, key);
 	lua_pushnumber(L, value);
@@ -1315,7 +1315,7 @@ void Events::eventMonsterOnDropLoot(std::shared_ptr<Monster> monster, std::share
 	if (!scriptInterface.reserveScriptEnv()) {
 		g_logger().error("[Events::eventMonsterOnDropLoot - "
 						 "Monster corpse {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 corpse->getName());
 		return;
 	}
@@ -1327,10 +1327,10 @@ void Events::eventMonsterOnDropLoot(std::shared_ptr<Monster> monster, std::share
 	scriptInterface.pushFunction(info.monsterOnDropLoot);
 
 	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Monster);
 
 	LuaScriptInterface::pushUserdata<Container>(L, corpse);
-	LuaScriptInterface::setMetatable(L, -1, "Container");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Container);
 
 	return scriptInterface.callVoidFunction(2);
 }
@@ -729,11 +729,11 @@ bool MoveEvent::executeStep(const std::shared_ptr<Creature> &creature, std::shar
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		if (item != nullptr) {
 			g_logger().error("[MoveEvent::executeStep - Creature {} item {}, position {}] "
-							 "Call stack overflow. Too many lua script calls being nested.",
+							 "Could not reserve a script environment.",
 							 creature->getName(), item->getName(), pos.toString());
 		} else {
 			g_logger().error("[MoveEvent::executeStep - Creature {}, position {}] "
-							 "Call stack overflow. Too many lua script calls being nested.",
+							 "Could not reserve a script environment.",
 							 creature->getName(), pos.toString());
 		}
 		return false;
@@ -772,7 +772,7 @@ bool MoveEvent::executeEquip(const std::shared_ptr<Player> &player, const std::s
 	// onDeEquip(player, item, slot, isCheck)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[MoveEvent::executeEquip - Player {} item {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 player->getName(), item->getName());
 		return false;
 	}
@@ -784,7 +784,7 @@ bool MoveEvent::executeEquip(const std::shared_ptr<Player> &player, const std::s
 
 	getScriptInterface()->pushFunction(getScriptId());
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 	LuaScriptInterface::pushThing(L, item);
 	lua_pushnumber(L, onSlot);
 	LuaScriptInterface::pushBoolean(L, isCheck);
@@ -806,7 +806,7 @@ bool MoveEvent::executeAddRemItem(const std::shared_ptr<Item> &item, const std::
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[MoveEvent::executeAddRemItem - "
 						 "Item {} item on tile x: {} y: {} z: {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 item->getName(), pos.getX(), pos.getY(), pos.getZ());
 		return false;
 	}
@@ -838,7 +838,7 @@ bool MoveEvent::executeAddRemItem(const std::shared_ptr<Item> &item, const Posit
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[MoveEvent::executeAddRemItem - "
 						 "Item {} item on tile x: {} y: {} z: {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 item->getName(), pos.getX(), pos.getY(), pos.getZ());
 		return false;
 	}
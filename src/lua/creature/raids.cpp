@@ -595,7 +595,7 @@ bool ScriptEvent::executeEvent() {
 	// onRaid()
 	if (!scriptInterface->reserveScriptEnv()) {
 		g_logger().error("{} - Script with name {} "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 __FUNCTION__, getScriptName());
 		return false;
 	}
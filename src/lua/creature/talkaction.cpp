@@ -83,7 +83,7 @@ bool TalkAction::executeSay(std::shared_ptr<Player> player, const std::string &w
 	// onSay(player, words, param, type)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[TalkAction::executeSay - Player {} words {}] "
-						 "Call stack overflow. Too many lua script calls being nested. Script name {}",
+						 "Could not reserve a script environment. Script name {}",
 						 player->getName(), getWords(), getScriptInterface()->getLoadingScriptName());
 		return false;
 	}
@@ -96,7 +96,7 @@ bool TalkAction::executeSay(std::shared_ptr<Player> player, const std::string &w
 	getScriptInterface()->pushFunction(getScriptId());
 
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushString(L, words);
 	LuaScriptInterface::pushString(L, param);
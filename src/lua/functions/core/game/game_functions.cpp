@@ -73,7 +73,7 @@ int GameFunctions::luaGameCreateMonsterType(lua_State* L) {
 		}
 
 		pushUserdata<MonsterType>(L, monsterType);
-		setMetatable(L, -1, "MonsterType");
+		setMetatable(L, -1, LuaData_t::MonsterType);
 	} else {
 		lua_pushnil(L);
 	}
@@ -168,7 +168,7 @@ int GameFunctions::luaGameGetPlayers(lua_State* L) {
 	int index = 0;
 	for (const auto &playerEntry : g_game().getPlayers()) {
 		pushUserdata<Player>(L, playerEntry.second);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -214,7 +214,7 @@ int GameFunctions::luaGameGetMonsterTypes(lua_State* L) {
 
 	for (const auto [typeName, mType] : type) {
 		pushUserdata<MonsterType>(L, mType);
-		setMetatable(L, -1, "MonsterType");
+		setMetatable(L, -1, LuaData_t::MonsterType);
 		lua_setfield(L, -2, typeName.c_str());
 	}
 	return 1;
@@ -228,7 +228,7 @@ int GameFunctions::luaGameGetTowns(lua_State* L) {
 	int index = 0;
 	for (auto townEntry : towns) {
 		pushUserdata<Town>(L, townEntry.second);
-		setMetatable(L, -1, "Town");
+		setMetatable(L, -1, LuaData_t::Town);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -242,7 +242,7 @@ int GameFunctions::luaGameGetHouses(lua_State* L) {
 	int index = 0;
 	for (auto houseEntry : houses) {
 		pushUserdata<House>(L, houseEntry.second);
-		setMetatable(L, -1, "House");
+		setMetatable(L, -1, LuaData_t::House);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -409,7 +409,7 @@ int GameFunctions::luaGameCreateContainer(lua_State* L) {
 	}
 
 	pushUserdata<Container>(L, container);
-	setMetatable(L, -1, "Container");
+	setMetatable(L, -1, LuaData_t::Container);
 	return 1;
 }
 
@@ -445,7 +445,7 @@ int GameFunctions::luaGameCreateMonster(lua_State* L) {
 		}
 
 		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		setMetatable(L, -1, LuaData_t::Monster);
 	} else {
 		if (isSummon) {
 			monster->setMaster(nullptr);
@@ -464,7 +464,7 @@ int GameFunctions::luaGameGenerateNpc(lua_State* L) {
 		return 1;
 	} else {
 		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		setMetatable(L, -1, LuaData_t::Npc);
 	}
 	return 1;
 }
@@ -482,7 +482,7 @@ int GameFunctions::luaGameCreateNpc(lua_State* L) {
 	bool force = getBoolean(L, 4, false);
 	if (g_game().placeCreature(npc, position, extended, force)) {
 		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		setMetatable(L, -1, LuaData_t::Npc);
 	} else {
 		lua_pushnil(L);
 	}
@@ -505,7 +505,7 @@ int GameFunctions::luaGameCreateTile(lua_State* L) {
 	}
 
 	pushUserdata(L, g_game().map.getOrCreateTile(position, isDynamic));
-	setMetatable(L, -1, "Tile");
+	setMetatable(L, -1, LuaData_t::Tile);
 	return 1;
 }
 
@@ -517,7 +517,7 @@ int GameFunctions::luaGameGetBestiaryCharm(lua_State* L) {
 	int index = 0;
 	for (const auto charmPtr : c_list) {
 		pushUserdata<Charm>(L, charmPtr);
-		setMetatable(L, -1, "Charm");
+		setMetatable(L, -1, LuaData_t::Charm);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -527,7 +527,7 @@ int GameFunctions::luaGameCreateBestiaryCharm(lua_State* L) {
 	// Game.createBestiaryCharm(id)
 	if (const std::shared_ptr<Charm> charm = g_iobestiary().getBestiaryCharm(static_cast<charmRune_t>(getNumber<int8_t>(L, 1, 0)), true)) {
 		pushUserdata<Charm>(L, charm);
-		setMetatable(L, -1, "Charm");
+		setMetatable(L, -1, LuaData_t::Charm);
 	} else {
 		lua_pushnil(L);
 	}
@@ -539,7 +539,7 @@ int GameFunctions::luaGameCreateItemClassification(lua_State* L) {
 	const ItemClassification* itemClassification = g_game().getItemsClassification(getNumber<uint8_t>(L, 1), true);
 	if (itemClassification) {
 		pushUserdata<const ItemClassification>(L, itemClassification);
-		setMetatable(L, -1, "ItemClassification");
+		setMetatable(L, -1, LuaData_t::ItemClassification);
 	} else {
 		lua_pushnil(L);
 	}
@@ -629,7 +629,7 @@ int GameFunctions::luaGameGetOfflinePlayer(lua_State* L) {
 		lua_pushnil(L);
 	} else {
 		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 	}
 
 	return 1;
@@ -772,7 +772,7 @@ int GameFunctions::luaGameGetTalkActions(lua_State* L) {
 
 	for (const auto &[talkName, talkactionSharedPtr] : talkactionsMap) {
 		pushUserdata<TalkAction>(L, talkactionSharedPtr);
-		setMetatable(L, -1, "TalkAction");
+		setMetatable(L, -1, LuaData_t::TalkAction);
 		lua_setfield(L, -2, talkName.c_str());
 	}
 	return 1;
@@ -21,7 +21,7 @@ int ModalWindowFunctions::luaModalWindowCreate(lua_State* L) {
 	uint32_t id = getNumber<uint32_t>(L, 2);
 
 	pushUserdata<ModalWindow>(L, std::make_shared<ModalWindow>(id, title, message));
-	setMetatable(L, -1, "ModalWindow");
+	setMetatable(L, -1, LuaData_t::ModalWindow);
 	return 1;
 }
 
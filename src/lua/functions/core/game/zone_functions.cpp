@@ -157,7 +157,7 @@ int ZoneFunctions::luaZoneGetPlayers(lua_State* L) {
 	for (auto player : players) {
 		index++;
 		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -178,7 +178,7 @@ int ZoneFunctions::luaZoneGetMonsters(lua_State* L) {
 	for (auto monster : monsters) {
 		index++;
 		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		setMetatable(L, -1, LuaData_t::Monster);
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -199,7 +199,7 @@ int ZoneFunctions::luaZoneGetNpcs(lua_State* L) {
 	for (auto npc : npcs) {
 		index++;
 		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		setMetatable(L, -1, LuaData_t::Npc);
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -220,7 +220,7 @@ int ZoneFunctions::luaZoneGetItems(lua_State* L) {
 	for (auto item : items) {
 		index++;
 		pushUserdata<Item>(L, item);
-		setMetatable(L, -1, "Item");
+		setMetatable(L, -1, LuaData_t::Item);
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -16,7 +16,7 @@
 int NetworkMessageFunctions::luaNetworkMessageCreate(lua_State* L) {
 	// NetworkMessage()
 	pushUserdata<NetworkMessage>(L, std::make_shared<NetworkMessage>());
-	setMetatable(L, -1, "NetworkMessage");
+	setMetatable(L, -1, LuaData_t::NetworkMessage);
 	return 1;
 }
 
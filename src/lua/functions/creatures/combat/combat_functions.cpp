@@ -18,7 +18,7 @@
 int CombatFunctions::luaCombatCreate(lua_State* L) {
 	// Combat()
 	pushUserdata<Combat>(L, g_luaEnvironment().createCombatObject(getScriptEnv()->getScriptInterface()));
-	setMetatable(L, -1, "Combat");
+	setMetatable(L, -1, LuaData_t::Combat);
 	return 1;
 }
 
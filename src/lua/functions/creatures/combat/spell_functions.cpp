@@ -31,7 +31,7 @@ int SpellFunctions::luaSpellCreate(lua_State* L) {
 
 		if (rune) {
 			pushUserdata<Spell>(L, rune);
-			setMetatable(L, -1, "Spell");
+			setMetatable(L, -1, LuaData_t::Spell);
 			return 1;
 		}
 
@@ -41,19 +41,19 @@ int SpellFunctions::luaSpellCreate(lua_State* L) {
 		std::shared_ptr<InstantSpell> instant = g_spells().getInstantSpellByName(arg);
 		if (instant) {
 			pushUserdata<Spell>(L, instant);
-			setMetatable(L, -1, "Spell");
+			setMetatable(L, -1, LuaData_t::Spell);
 			return 1;
 		}
 		instant = g_spells().getInstantSpell(arg);
 		if (instant) {
 			pushUserdata<Spell>(L, instant);
-			setMetatable(L, -1, "Spell");
+			setMetatable(L, -1, LuaData_t::Spell);
 			return 1;
 		}
 		std::shared_ptr<RuneSpell> rune = g_spells().getRuneSpellByName(arg);
 		if (rune) {
 			pushUserdata<Spell>(L, rune);
-			setMetatable(L, -1, "Spell");
+			setMetatable(L, -1, LuaData_t::Spell);
 			return 1;
 		}
 
@@ -68,13 +68,13 @@ int SpellFunctions::luaSpellCreate(lua_State* L) {
 	if (spellType == SPELL_INSTANT) {
 		auto spell = std::make_shared<InstantSpell>(getScriptEnv()->getScriptInterface());
 		pushUserdata<Spell>(L, spell);
-		setMetatable(L, -1, "Spell");
+		setMetatable(L, -1, LuaData_t::Spell);
 		spell->spellType = SPELL_INSTANT;
 		return 1;
 	} else if (spellType == SPELL_RUNE) {
 		auto runeSpell = std::make_shared<RuneSpell>(getScriptEnv()->getScriptInterface());
 		pushUserdata<Spell>(L, runeSpell);
-		setMetatable(L, -1, "Spell");
+		setMetatable(L, -1, LuaData_t::Spell);
 		runeSpell->spellType = SPELL_RUNE;
 		return 1;
 	}
@@ -606,7 +606,7 @@ int SpellFunctions::luaSpellVocation(lua_State* L) {
 				std::string name = g_vocations().getVocation(voc.first)->getVocName();
 				setField(L, pchar, name);
 			}
-			setMetatable(L, -1, "Spell");
+			setMetatable(L, -1, LuaData_t::Spell);
 		} else {
 			int parameters = lua_gettop(L) - 1; // - 1 because self is a parameter aswell, which we want to skip ofc
 			for (int i = 0; i < parameters; ++i) {
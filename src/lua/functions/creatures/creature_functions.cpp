@@ -423,6 +423,17 @@ int CreatureFunctions::luaCreatureGetPosition(lua_State* L) {
 	return 1;
 }
 
+int CreatureFunctions::luaCreatureGetPackedPosition(lua_State* L) {
+	// creature:getPackedPosition()
+	std::shared_ptr<Creature> creature = getUserdataShared<Creature>(L, 1);
+	if (creature) {
+		pushPackedPosition(L, creature->getPosition());
+	} else {
+		lua_pushnil(L);
+	}
+	return 1;
+}
+
 int CreatureFunctions::luaCreatureGetTile(lua_State* L) {
 	// creature:getTile()
 	std::shared_ptr<Creature> creature = getUserdataShared<Creature>(L, 1);
@@ -434,7 +445,7 @@ int CreatureFunctions::luaCreatureGetTile(lua_State* L) {
 	std::shared_ptr<Tile> tile = creature->getTile();
 	if (tile) {
 		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		setMetatable(L, -1, LuaData_t::Tile);
 	} else {
 		lua_pushnil(L);
 	}
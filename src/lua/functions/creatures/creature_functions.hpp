@@ -50,6 +50,7 @@ public:
 		registerMethod(L, "Creature", "setDropLoot", CreatureFunctions::luaCreatureSetDropLoot);
 		registerMethod(L, "Creature", "setSkillLoss", CreatureFunctions::luaCreatureSetSkillLoss);
 		registerMethod(L, "Creature", "getPosition", CreatureFunctions::luaCreatureGetPosition);
+		registerMethod(L, "Creature", "getPackedPosition", CreatureFunctions::luaCreatureGetPackedPosition);
 		registerMethod(L, "Creature", "getTile", CreatureFunctions::luaCreatureGetTile);
 		registerMethod(L, "Creature", "getDirection", CreatureFunctions::luaCreatureGetDirection);
 		registerMethod(L, "Creature", "setDirection", CreatureFunctions::luaCreatureSetDirection);
@@ -139,6 +140,7 @@ private:
 	static int luaCreatureSetSkillLoss(lua_State* L);
 
 	static int luaCreatureGetPosition(lua_State* L);
+	static int luaCreatureGetPackedPosition(lua_State* L);
 	static int luaCreatureGetTile(lua_State* L);
 	static int luaCreatureGetDirection(lua_State* L);
 	static int luaCreatureSetDirection(lua_State* L);
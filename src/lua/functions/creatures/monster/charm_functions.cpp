@@ -21,7 +21,7 @@ int CharmFunctions::luaCharmCreate(lua_State* L) {
 		for (const auto charm : charmList) {
 			if (charm->id == charmid) {
 				pushUserdata<Charm>(L, charm);
-				setMetatable(L, -1, "Charm");
+				setMetatable(L, -1, LuaData_t::Charm);
 				pushBoolean(L, true);
 			}
 		}
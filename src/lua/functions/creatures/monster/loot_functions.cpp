@@ -16,7 +16,7 @@ int LootFunctions::luaCreateLoot(lua_State* L) {
 	// Loot() will create a new loot item
 	const auto loot = std::make_shared<Loot>();
 	pushUserdata<Loot>(L, loot);
-	setMetatable(L, -1, "Loot");
+	setMetatable(L, -1, LuaData_t::Loot);
 	return 1;
 }
 
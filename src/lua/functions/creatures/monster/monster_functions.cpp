@@ -34,7 +34,7 @@ int MonsterFunctions::luaMonsterCreate(lua_State* L) {
 
 	if (monster) {
 		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		setMetatable(L, -1, LuaData_t::Monster);
 	} else {
 		lua_pushnil(L);
 	}
@@ -52,7 +52,7 @@ int MonsterFunctions::luaMonsterGetType(lua_State* L) {
 	std::shared_ptr<Monster> monster = getUserdataShared<Monster>(L, 1);
 	if (monster) {
 		pushUserdata<MonsterType>(L, monster->mType);
-		setMetatable(L, -1, "MonsterType");
+		setMetatable(L, -1, LuaData_t::MonsterType);
 	} else {
 		lua_pushnil(L);
 	}
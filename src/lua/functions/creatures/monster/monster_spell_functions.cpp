@@ -15,7 +15,7 @@
 int MonsterSpellFunctions::luaCreateMonsterSpell(lua_State* L) {
 	const auto spell = std::make_shared<MonsterSpell>();
 	pushUserdata<MonsterSpell>(L, spell);
-	setMetatable(L, -1, "MonsterSpell");
+	setMetatable(L, -1, LuaData_t::MonsterSpell);
 	return 1;
 }
 
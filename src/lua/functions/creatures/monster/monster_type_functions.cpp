@@ -52,7 +52,7 @@ int MonsterTypeFunctions::luaMonsterTypeCreate(lua_State* L) {
 
 	if (monsterType) {
 		pushUserdata<MonsterType>(L, monsterType);
-		setMetatable(L, -1, "MonsterType");
+		setMetatable(L, -1, LuaData_t::MonsterType);
 	} else {
 		lua_pushnil(L);
 	}
@@ -982,6 +982,22 @@ int MonsterTypeFunctions::luaMonsterTypeAddLoot(lua_State* L) {
 	return 1;
 }
 
+int MonsterTypeFunctions::luaMonsterTypeGenerateLoot(lua_State* L) {
+	// monsterType:generateLoot(container, multiplier[, creatureProductChance = 100])
+	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
+	const auto container = getUserdataShared<Container>(L, 2);
+	if (!monsterType || !container) {
+		lua_pushnil(L);
+		return 1;
+	}
+
+	const auto &lootTable = monsterType->info.lootTable;
+	std::vector<LootTable::Drop> drops;
+	lootTable.roll(getNumber<double>(L, 3), getNumber<uint32_t>(L, 4, 100), drops);
+	lua_pushnumber(L, lootTable.addToContainer(container, drops));
+	return 1;
+}
+
 int MonsterTypeFunctions::luaMonsterTypeGetCreatureEvents(lua_State* L) {
 	// monsterType:getCreatureEvents()
 	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
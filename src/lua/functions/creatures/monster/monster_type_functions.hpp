@@ -86,6 +86,7 @@ public:
 
 		registerMethod(L, "MonsterType", "getLoot", MonsterTypeFunctions::luaMonsterTypeGetLoot);
 		registerMethod(L, "MonsterType", "addLoot", MonsterTypeFunctions::luaMonsterTypeAddLoot);
+		registerMethod(L, "MonsterType", "generateLoot", MonsterTypeFunctions::luaMonsterTypeGenerateLoot);
 
 		registerMethod(L, "MonsterType", "getCreatureEvents", MonsterTypeFunctions::luaMonsterTypeGetCreatureEvents);
 		registerMethod(L, "MonsterType", "registerEvent", MonsterTypeFunctions::luaMonsterTypeRegisterEvent);
@@ -214,6 +215,7 @@ private:
 
 	static int luaMonsterTypeGetLoot(lua_State* L);
 	static int luaMonsterTypeAddLoot(lua_State* L);
+	static int luaMonsterTypeGenerateLoot(lua_State* L);
 
 	static int luaMonsterTypeGetCreatureEvents(lua_State* L);
 	static int luaMonsterTypeRegisterEvent(lua_State* L);
@@ -38,7 +38,7 @@ int NpcFunctions::luaNpcCreate(lua_State* L) {
 
 	if (npc) {
 		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		setMetatable(L, -1, LuaData_t::Npc);
 	} else {
 		lua_pushnil(L);
 	}
@@ -155,7 +155,7 @@ int NpcFunctions::luaNpcPlace(lua_State* L) {
 	bool force = getBoolean(L, 4, true);
 	if (g_game().placeCreature(npc, position, extended, force)) {
 		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		setMetatable(L, -1, LuaData_t::Npc);
 	} else {
 		lua_pushnil(L);
 	}
@@ -39,7 +39,7 @@ int NpcTypeFunctions::luaNpcTypeCreate(lua_State* L) {
 	// NpcType(name)
 	const auto &npcType = g_npcs().getNpcType(getString(L, 1), true);
 	pushUserdata<NpcType>(L, npcType);
-	setMetatable(L, -1, "NpcType");
+	setMetatable(L, -1, LuaData_t::NpcType);
 	return 1;
 }
 
@@ -20,7 +20,7 @@ int GroupFunctions::luaGroupCreate(lua_State* L) {
 	Group* group = g_game().groups.getGroup(id);
 	if (group) {
 		pushUserdata<Group>(L, group);
-		setMetatable(L, -1, "Group");
+		setMetatable(L, -1, LuaData_t::Group);
 	} else {
 		lua_pushnil(L);
 	}
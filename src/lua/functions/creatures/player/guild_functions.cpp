@@ -18,7 +18,7 @@ int GuildFunctions::luaGuildCreate(lua_State* L) {
 	const auto guild = g_game().getGuild(id);
 	if (guild) {
 		pushUserdata<Guild>(L, guild);
-		setMetatable(L, -1, "Guild");
+		setMetatable(L, -1, LuaData_t::Guild);
 	} else {
 		lua_pushnil(L);
 	}
@@ -60,7 +60,7 @@ int GuildFunctions::luaGuildGetMembersOnline(lua_State* L) {
 	int index = 0;
 	for (std::shared_ptr<Player> player : members) {
 		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -27,7 +27,7 @@ int MountFunctions::luaCreateMount(lua_State* L) {
 
 	if (mount) {
 		pushUserdata<Mount>(L, mount);
-		setMetatable(L, -1, "Mount");
+		setMetatable(L, -1, LuaData_t::Mount);
 	} else {
 		lua_pushnil(L);
 	}
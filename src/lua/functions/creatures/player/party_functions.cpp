@@ -28,7 +28,7 @@ int32_t PartyFunctions::luaPartyCreate(lua_State* L) {
 		g_game().updatePlayerShield(player);
 		player->sendCreatureSkull(player);
 		pushUserdata<Party>(L, party);
-		setMetatable(L, -1, "Party");
+		setMetatable(L, -1, LuaData_t::Party);
 	} else {
 		lua_pushnil(L);
 	}
@@ -60,7 +60,7 @@ int PartyFunctions::luaPartyGetLeader(lua_State* L) {
 	std::shared_ptr<Player> leader = party->getLeader();
 	if (leader) {
 		pushUserdata<Player>(L, leader);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 	} else {
 		lua_pushnil(L);
 	}
@@ -96,7 +96,7 @@ int PartyFunctions::luaPartyGetMembers(lua_State* L) {
 	lua_createtable(L, party->getMemberCount(), 0);
 	for (std::shared_ptr<Player> player : party->getMembers()) {
 		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -122,7 +122,7 @@ int PartyFunctions::luaPartyGetInvitees(lua_State* L) {
 		int index = 0;
 		for (std::shared_ptr<Player> player : party->getInvitees()) {
 			pushUserdata<Player>(L, player);
-			setMetatable(L, -1, "Player");
+			setMetatable(L, -1, LuaData_t::Player);
 			lua_rawseti(L, -2, ++index);
 		}
 	} else {
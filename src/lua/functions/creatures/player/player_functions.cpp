@@ -16,7 +16,9 @@
 #include "creatures/players/wheel/player_wheel.hpp"
 #include "creatures/players/achievement/player_achievement.hpp"
 #include "game/game.hpp"
+#include "io/io_name_cache.hpp"
 #include "io/iologindata.hpp"
+#include "io/iomarket.hpp"
 #include "io/ioprey.hpp"
 #include "items/item.hpp"
 #include "lua/functions/creatures/player/player_functions.hpp"
@@ -144,7 +146,7 @@ int PlayerFunctions::luaPlayerCreate(lua_State* L) {
 
 	if (player) {
 		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		setMetatable(L, -1, LuaData_t::Player);
 	} else {
 		lua_pushnil(L);
 	}
@@ -355,7 +357,7 @@ int PlayerFunctions::luaPlayergetCharmMonsterType(lua_State* L) {
 			const auto mtype = g_monsters().getMonsterTypeByRaceId(raceid);
 			if (mtype) {
 				pushUserdata<MonsterType>(L, mtype);
-				setMetatable(L, -1, "MonsterType");
+				setMetatable(L, -1, LuaData_t::MonsterType);
 			} else {
 				lua_pushnil(L);
 			}
@@ -1369,7 +1371,7 @@ int PlayerFunctions::luaPlayerGetVocation(lua_State* L) {
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
 		pushUserdata<Vocation>(L, player->getVocation());
-		setMetatable(L, -1, "Vocation");
+		setMetatable(L, -1, LuaData_t::Vocation);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1474,7 +1476,7 @@ int PlayerFunctions::luaPlayerGetTown(lua_State* L) {
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
 		pushUserdata<Town>(L, player->getTown());
-		setMetatable(L, -1, "Town");
+		setMetatable(L, -1, LuaData_t::Town);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1514,7 +1516,7 @@ int PlayerFunctions::luaPlayerGetGuild(lua_State* L) {
 	}
 
 	pushUserdata<Guild>(L, guild);
-	setMetatable(L, -1, "Guild");
+	setMetatable(L, -1, LuaData_t::Guild);
 	return 1;
 }
 
@@ -1593,7 +1595,7 @@ int PlayerFunctions::luaPlayerGetGroup(lua_State* L) {
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
 		pushUserdata<Group>(L, player->getGroup());
-		setMetatable(L, -1, "Group");
+		setMetatable(L, -1, LuaData_t::Group);
 	} else {
 		lua_pushnil(L);
 	}
@@ -2253,7 +2255,7 @@ int PlayerFunctions::luaPlayerGetParty(lua_State* L) {
 	std::shared_ptr<Party> party = player->getParty();
 	if (party) {
 		pushUserdata<Party>(L, party);
-		setMetatable(L, -1, "Party");
+		setMetatable(L, -1, LuaData_t::Party);
 	} else {
 		lua_pushnil(L);
 	}
@@ -2933,7 +2935,7 @@ int PlayerFunctions::luaPlayerGetHouse(lua_State* L) {
 	const auto &house = g_game().map.houses.getHouseByPlayerId(player->getGUID());
 	if (house) {
 		pushUserdata<House>(L, house);
-		setMetatable(L, -1, "House");
+		setMetatable(L, -1, LuaData_t::House);
 	} else {
 		lua_pushnil(L);
 	}
@@ -3059,7 +3061,7 @@ int PlayerFunctions::luaPlayerGetContainerById(lua_State* L) {
 	std::shared_ptr<Container> container = player->getContainerByID(getNumber<uint8_t>(L, 2));
 	if (container) {
 		pushUserdata<Container>(L, container);
-		setMetatable(L, -1, "Container");
+		setMetatable(L, -1, LuaData_t::Container);
 	} else {
 		lua_pushnil(L);
 	}
@@ -3751,6 +3753,8 @@ int PlayerFunctions::luaPlayerChangeName(lua_State* L) {
 	auto newName = getString(L, 2);
 	player->setName(newName);
 	g_saveManager().savePlayer(player);
+	g_nameCache().setPlayer(player->getGUID(), newName);
+	IOMarket::renamePlayer(player->getGUID(), newName);
 	return 1;
 }
 
@@ -24,7 +24,7 @@ int VocationFunctions::luaVocationCreate(lua_State* L) {
 	Vocation* vocation = g_vocations().getVocation(vocationId);
 	if (vocation) {
 		pushUserdata<Vocation>(L, vocation);
-		setMetatable(L, -1, "Vocation");
+		setMetatable(L, -1, LuaData_t::Vocation);
 	} else {
 		lua_pushnil(L);
 	}
@@ -260,7 +260,7 @@ int VocationFunctions::luaVocationGetDemotion(lua_State* L) {
 	Vocation* demotedVocation = g_vocations().getVocation(fromId);
 	if (demotedVocation && demotedVocation != vocation) {
 		pushUserdata<Vocation>(L, demotedVocation);
-		setMetatable(L, -1, "Vocation");
+		setMetatable(L, -1, LuaData_t::Vocation);
 	} else {
 		lua_pushnil(L);
 	}
@@ -284,7 +284,7 @@ int VocationFunctions::luaVocationGetPromotion(lua_State* L) {
 	Vocation* promotedVocation = g_vocations().getVocation(promotedId);
 	if (promotedVocation && promotedVocation != vocation) {
 		pushUserdata<Vocation>(L, promotedVocation);
-		setMetatable(L, -1, "Vocation");
+		setMetatable(L, -1, LuaData_t::Vocation);
 	} else {
 		lua_pushnil(L);
 	}
@@ -18,7 +18,7 @@ int ActionFunctions::luaCreateAction(lua_State* L) {
 	// Action()
 	auto action = std::make_shared<Action>(getScriptEnv()->getScriptInterface());
 	pushUserdata<Action>(L, action);
-	setMetatable(L, -1, "Action");
+	setMetatable(L, -1, LuaData_t::Action);
 	return 1;
 }
 
@@ -18,7 +18,7 @@ int CreatureEventFunctions::luaCreateCreatureEvent(lua_State* L) {
 	auto creatureEvent = std::make_shared<CreatureEvent>(getScriptEnv()->getScriptInterface());
 	creatureEvent->setName(getString(L, 2));
 	pushUserdata<CreatureEvent>(L, creatureEvent);
-	setMetatable(L, -1, "CreatureEvent");
+	setMetatable(L, -1, LuaData_t::CreatureEvent);
 	return 1;
 }
 
@@ -20,7 +20,7 @@ int GlobalEventFunctions::luaCreateGlobalEvent(lua_State* L) {
 	global->setName(getString(L, 2));
 	global->setEventType(GLOBALEVENT_NONE);
 	pushUserdata<GlobalEvent>(L, global);
-	setMetatable(L, -1, "GlobalEvent");
+	setMetatable(L, -1, LuaData_t::GlobalEvent);
 	return 1;
 }
 
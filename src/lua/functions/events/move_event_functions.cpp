@@ -17,7 +17,7 @@ int MoveEventFunctions::luaCreateMoveEvent(lua_State* L) {
 	// MoveEvent()
 	const auto moveevent = std::make_shared<MoveEvent>(getScriptEnv()->getScriptInterface());
 	pushUserdata<MoveEvent>(L, moveevent);
-	setMetatable(L, -1, "MoveEvent");
+	setMetatable(L, -1, LuaData_t::MoveEvent);
 	return 1;
 }
 
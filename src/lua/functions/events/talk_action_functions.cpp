@@ -26,7 +26,7 @@ int TalkActionFunctions::luaCreateTalkAction(lua_State* L) {
 	auto talkactionSharedPtr = std::make_shared<TalkAction>(getScriptEnv()->getScriptInterface());
 	talkactionSharedPtr->setWords(wordsVector);
 	pushUserdata<TalkAction>(L, talkactionSharedPtr);
-	setMetatable(L, -1, "TalkAction");
+	setMetatable(L, -1, LuaData_t::TalkAction);
 	return 1;
 }
 
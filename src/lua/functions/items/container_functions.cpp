@@ -20,7 +20,7 @@ int ContainerFunctions::luaContainerCreate(lua_State* L) {
 	std::shared_ptr<Container> container = getScriptEnv()->getContainerByUID(id);
 	if (container) {
 		pushUserdata(L, container);
-		setMetatable(L, -1, "Container");
+		setMetatable(L, -1, LuaData_t::Container);
 	} else {
 		lua_pushnil(L);
 	}
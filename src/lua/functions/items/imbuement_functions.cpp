@@ -20,7 +20,7 @@ int ImbuementFunctions::luaCreateImbuement(lua_State* L) {
 
 	if (imbuement) {
 		pushUserdata<Imbuement>(L, imbuement);
-		setMetatable(L, -1, "Imbuement");
+		setMetatable(L, -1, LuaData_t::Imbuement);
 	} else {
 		lua_pushnil(L);
 	}
@@ -18,7 +18,7 @@ int ItemClassificationFunctions::luaItemClassificationCreate(lua_State* L) {
 		const ItemClassification* itemClassification = g_game().getItemsClassification(getNumber<uint8_t>(L, 2), false);
 		if (itemClassification) {
 			pushUserdata<const ItemClassification>(L, itemClassification);
-			setMetatable(L, -1, "ItemClassification");
+			setMetatable(L, -1, LuaData_t::ItemClassification);
 			pushBoolean(L, true);
 		}
 	}
@@ -306,6 +306,17 @@ int ItemFunctions::luaItemGetPosition(lua_State* L) {
 	return 1;
 }
 
+int ItemFunctions::luaItemGetPackedPosition(lua_State* L) {
+	// item:getPackedPosition()
+	std::shared_ptr<Item> item = getUserdataShared<Item>(L, 1);
+	if (item) {
+		pushPackedPosition(L, item->getPosition());
+	} else {
+		lua_pushnil(L);
+	}
+	return 1;
+}
+
 int ItemFunctions::luaItemGetTile(lua_State* L) {
 	// item:getTile()
 	std::shared_ptr<Item> item = getUserdataShared<Item>(L, 1);
@@ -317,7 +328,7 @@ int ItemFunctions::luaItemGetTile(lua_State* L) {
 	std::shared_ptr<Tile> tile = item->getTile();
 	if (tile) {
 		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		setMetatable(L, -1, LuaData_t::Tile);
 	} else {
 		lua_pushnil(L);
 	}
@@ -782,7 +793,7 @@ int ItemFunctions::luaItemGetImbuement(lua_State* L) {
 		}
 
 		pushUserdata<Imbuement>(L, imbuement);
-		setMetatable(L, -1, "Imbuement");
+		setMetatable(L, -1, LuaData_t::Imbuement);
 
 		lua_createtable(L, 0, 3);
 		setField(L, "id", imbuement->getID());
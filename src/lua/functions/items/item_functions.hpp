@@ -48,6 +48,7 @@ public:
 		registerMethod(L, "Item", "getArticle", ItemFunctions::luaItemGetArticle);
 
 		registerMethod(L, "Item", "getPosition", ItemFunctions::luaItemGetPosition);
+		registerMethod(L, "Item", "getPackedPosition", ItemFunctions::luaItemGetPackedPosition);
 		registerMethod(L, "Item", "getTile", ItemFunctions::luaItemGetTile);
 
 		registerMethod(L, "Item", "hasAttribute", ItemFunctions::luaItemHasAttribute);
@@ -126,6 +127,7 @@ private:
 	static int luaItemGetArticle(lua_State* L);
 
 	static int luaItemGetPosition(lua_State* L);
+	static int luaItemGetPackedPosition(lua_State* L);
 	static int luaItemGetTile(lua_State* L);
 
 	static int luaItemHasAttribute(lua_State* L);
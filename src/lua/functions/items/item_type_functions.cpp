@@ -24,7 +24,7 @@ int ItemTypeFunctions::luaItemTypeCreate(lua_State* L) {
 
 	const ItemType &itemType = Item::items[id];
 	pushUserdata<const ItemType>(L, &itemType);
-	setMetatable(L, -1, "ItemType");
+	setMetatable(L, -1, LuaData_t::ItemType);
 	return 1;
 }
 
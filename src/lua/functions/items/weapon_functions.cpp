@@ -26,7 +26,7 @@ int WeaponFunctions::luaCreateWeapon(lua_State* L) {
 		case WEAPON_CLUB: {
 			if (auto weaponPtr = g_luaEnvironment().createWeaponObject<WeaponMelee>(getScriptEnv()->getScriptInterface())) {
 				pushUserdata<WeaponMelee>(L, weaponPtr);
-				setMetatable(L, -1, "Weapon");
+				setMetatable(L, -1, LuaData_t::Weapon);
 				weaponPtr->weaponType = type;
 			} else {
 				lua_pushnil(L);
@@ -38,7 +38,7 @@ int WeaponFunctions::luaCreateWeapon(lua_State* L) {
 		case WEAPON_AMMO: {
 			if (auto weaponPtr = g_luaEnvironment().createWeaponObject<WeaponDistance>(getScriptEnv()->getScriptInterface())) {
 				pushUserdata<WeaponDistance>(L, weaponPtr);
-				setMetatable(L, -1, "Weapon");
+				setMetatable(L, -1, LuaData_t::Weapon);
 				weaponPtr->weaponType = type;
 			} else {
 				lua_pushnil(L);
@@ -48,7 +48,7 @@ int WeaponFunctions::luaCreateWeapon(lua_State* L) {
 		case WEAPON_WAND: {
 			if (auto weaponPtr = g_luaEnvironment().createWeaponObject<WeaponWand>(getScriptEnv()->getScriptInterface())) {
 				pushUserdata<WeaponWand>(L, weaponPtr);
-				setMetatable(L, -1, "Weapon");
+				setMetatable(L, -1, LuaData_t::Weapon);
 				weaponPtr->weaponType = type;
 			} else {
 				lua_pushnil(L);
@@ -159,10 +159,6 @@ int LuaFunctionsLoader::luaErrorHandler(lua_State* L) {
 }
 
 void LuaFunctionsLoader::pushVariant(lua_State* L, const LuaVariant &var) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_createtable(L, 0, 4);
 	setField(L, "type", var.type);
 	switch (var.type) {
@@ -183,14 +179,10 @@ void LuaFunctionsLoader::pushVariant(lua_State* L, const LuaVariant &var) {
 	}
 	setField(L, "instantName", var.instantName);
 	setField(L, "runeName", var.runeName);
-	setMetatable(L, -1, "Variant");
+	setMetatable(L, -1, LuaData_t::Variant);
 }
 
 void LuaFunctionsLoader::pushThing(lua_State* L, std::shared_ptr<Thing> thing) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	if (!thing) {
 		lua_createtable(L, 0, 4);
 		setField(L, "uid", 0);
@@ -212,10 +204,6 @@ void LuaFunctionsLoader::pushThing(lua_State* L, std::shared_ptr<Thing> thing) {
 }
 
 void LuaFunctionsLoader::pushCylinder(lua_State* L, std::shared_ptr<Cylinder> cylinder) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	if (std::shared_ptr<Creature> creature = cylinder->getCreature()) {
 		pushUserdata<Creature>(L, creature);
 		setCreatureMetatable(L, -1, creature);
@@ -224,7 +212,7 @@ void LuaFunctionsLoader::pushCylinder(lua_State* L, std::shared_ptr<Cylinder> cy
 		setItemMetatable(L, -1, parentItem);
 	} else if (std::shared_ptr<Tile> tile = cylinder->getTile()) {
 		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		setMetatable(L, -1, LuaData_t::Tile);
 	} else if (cylinder == VirtualCylinder::virtualCylinder) {
 		pushBoolean(L, true);
 	} else {
@@ -233,18 +221,10 @@ void LuaFunctionsLoader::pushCylinder(lua_State* L, std::shared_ptr<Cylinder> cy
 }
 
 void LuaFunctionsLoader::pushString(lua_State* L, const std::string &value) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_pushlstring(L, value.c_str(), value.length());
 }
 
 void LuaFunctionsLoader::pushCallback(lua_State* L, int32_t callback) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_rawgeti(L, LUA_REGISTRYINDEX, callback);
 }
 
@@ -264,20 +244,42 @@ int32_t LuaFunctionsLoader::popCallback(lua_State* L) {
 
 // Metatables
 void LuaFunctionsLoader::setMetatable(lua_State* L, int32_t index, const std::string &name) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
+	int ref = LUA_NOREF;
+	if (const auto refs = metatableRefs.find(L); refs != metatableRefs.end()) {
+		if (const auto it = refs->second.byName.find(name); it != refs->second.byName.end()) {
+			ref = it->second;
+		}
 	}
 
-	luaL_getmetatable(L, name.c_str());
+	if (ref != LUA_NOREF) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, ref);
+	} else {
+		luaL_getmetatable(L, name.c_str());
+	}
 	lua_setmetatable(L, index - 1);
 }
 
-void LuaFunctionsLoader::setWeakMetatable(lua_State* L, int32_t index, const std::string &name) {
-	static phmap::flat_hash_set<std::string> weakObjectTypes;
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
+void LuaFunctionsLoader::setMetatable(lua_State* L, int32_t index, LuaData_t type) {
+	pushMetatable(L, type);
+	lua_setmetatable(L, index - 1);
+}
+
+void LuaFunctionsLoader::clearMetatableRefs(lua_State* L) {
+	metatableRefs.erase(L);
+}
+
+void LuaFunctionsLoader::pushMetatable(lua_State* L, LuaData_t type) {
+	const auto refs = metatableRefs.find(L);
+	const int ref = refs != metatableRefs.end() ? refs->second.byType[static_cast<size_t>(type)] : LUA_NOREF;
+	if (ref != LUA_NOREF) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, ref);
+	} else {
+		luaL_getmetatable(L, std::string(magic_enum::enum_name(type)).c_str());
 	}
+}
 
+void LuaFunctionsLoader::setWeakMetatable(lua_State* L, int32_t index, const std::string &name) {
+	static phmap::flat_hash_set<std::string> weakObjectTypes;
 	const std::string &weakName = name + "_weak";
 
 	auto result = weakObjectTypes.emplace(name);
@@ -311,31 +313,23 @@ void LuaFunctionsLoader::setWeakMetatable(lua_State* L, int32_t index, const std
 }
 
 void LuaFunctionsLoader::setItemMetatable(lua_State* L, int32_t index, std::shared_ptr<Item> item) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	if (item && item->getContainer()) {
-		luaL_getmetatable(L, "Container");
+		pushMetatable(L, LuaData_t::Container);
 	} else if (item && item->getTeleport()) {
-		luaL_getmetatable(L, "Teleport");
+		pushMetatable(L, LuaData_t::Teleport);
 	} else {
-		luaL_getmetatable(L, "Item");
+		pushMetatable(L, LuaData_t::Item);
 	}
 	lua_setmetatable(L, index - 1);
 }
 
 void LuaFunctionsLoader::setCreatureMetatable(lua_State* L, int32_t index, std::shared_ptr<Creature> creature) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	if (creature && creature->getPlayer()) {
-		luaL_getmetatable(L, "Player");
+		pushMetatable(L, LuaData_t::Player);
 	} else if (creature && creature->getMonster()) {
-		luaL_getmetatable(L, "Monster");
+		pushMetatable(L, LuaData_t::Monster);
 	} else {
-		luaL_getmetatable(L, "Npc");
+		pushMetatable(L, LuaData_t::Npc);
 	}
 	lua_setmetatable(L, index - 1);
 }
@@ -398,6 +392,11 @@ std::string LuaFunctionsLoader::getString(lua_State* L, int32_t arg) {
 }
 
 Position LuaFunctionsLoader::getPosition(lua_State* L, int32_t arg, int32_t &stackpos) {
+	if (lua_type(L, arg) == LUA_TNUMBER) {
+		stackpos = 0;
+		return unpackPosition(lua_tonumber(L, arg));
+	}
+
 	Position position;
 	position.x = getField<uint16_t>(L, arg, "x");
 	position.y = getField<uint16_t>(L, arg, "y");
@@ -415,6 +414,10 @@ Position LuaFunctionsLoader::getPosition(lua_State* L, int32_t arg, int32_t &sta
 }
 
 Position LuaFunctionsLoader::getPosition(lua_State* L, int32_t arg) {
+	if (lua_type(L, arg) == LUA_TNUMBER) {
+		return unpackPosition(lua_tonumber(L, arg));
+	}
+
 	Position position;
 	position.x = getField<uint16_t>(L, arg, "x");
 	position.y = getField<uint16_t>(L, arg, "y");
@@ -568,18 +571,10 @@ std::string LuaFunctionsLoader::getUserdataTypeName(LuaData_t userType) {
 
 // Push
 void LuaFunctionsLoader::pushBoolean(lua_State* L, bool value) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_pushboolean(L, value ? 1 : 0);
 }
 
 void LuaFunctionsLoader::pushCombatDamage(lua_State* L, const CombatDamage &damage) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_pushnumber(L, damage.primary.value);
 	lua_pushnumber(L, damage.primary.type);
 	lua_pushnumber(L, damage.secondary.value);
@@ -588,10 +583,6 @@ void LuaFunctionsLoader::pushCombatDamage(lua_State* L, const CombatDamage &dama
 }
 
 void LuaFunctionsLoader::pushInstantSpell(lua_State* L, const InstantSpell &spell) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_createtable(L, 0, 6);
 
 	setField(L, "name", spell.getName());
@@ -601,14 +592,10 @@ void LuaFunctionsLoader::pushInstantSpell(lua_State* L, const InstantSpell &spel
 	setField(L, "mana", spell.getMana());
 	setField(L, "manapercent", spell.getManaPercent());
 
-	setMetatable(L, -1, "Spell");
+	setMetatable(L, -1, LuaData_t::Spell);
 }
 
 void LuaFunctionsLoader::pushPosition(lua_State* L, const Position &position, int32_t stackpos /* = 0*/) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
-
 	lua_createtable(L, 0, 4);
 
 	setField(L, "x", position.x);
@@ -616,14 +603,14 @@ void LuaFunctionsLoader::pushPosition(lua_State* L, const Position &position, in
 	setField(L, "z", position.z);
 	setField(L, "stackpos", stackpos);
 
-	setMetatable(L, -1, "Position");
+	setMetatable(L, -1, LuaData_t::Position);
 }
 
-void LuaFunctionsLoader::pushOutfit(lua_State* L, const Outfit_t &outfit) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
-	}
+void LuaFunctionsLoader::pushPackedPosition(lua_State* L, const Position &position) {
+	lua_pushnumber(L, packPosition(position));
+}
 
+void LuaFunctionsLoader::pushOutfit(lua_State* L, const Outfit_t &outfit) {
 	lua_createtable(L, 0, 13);
 	setField(L, "lookType", outfit.lookType);
 	setField(L, "lookTypeEx", outfit.lookTypeEx);
@@ -698,6 +685,15 @@ void LuaFunctionsLoader::registerClass(lua_State* L, const std::string &classNam
 	}
 	lua_rawseti(L, metatable, 't');
 
+	// Keep a registry ref so pushes don't have to look the metatable up by name
+	lua_pushvalue(L, metatable);
+	const int metatableRef = luaL_ref(L, LUA_REGISTRYINDEX);
+	auto &refs = metatableRefs[L];
+	refs.byName[className] = metatableRef;
+	if (userTypeEnum.has_value()) {
+		refs.byType[static_cast<size_t>(userTypeEnum.value())] = metatableRef;
+	}
+
 	// pop className, className.metatable
 	lua_pop(L, 2);
 }
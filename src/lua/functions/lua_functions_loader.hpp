@@ -55,6 +55,9 @@ public:
 	}
 
 	static void setMetatable(lua_State* L, int32_t index, const std::string &name);
+	static void setMetatable(lua_State* L, int32_t index, LuaData_t type);
+	// Must be called before a state classes were registered on is closed
+	static void clearMetatableRefs(lua_State* L);
 	static void setWeakMetatable(lua_State* L, int32_t index, const std::string &name);
 	static void setItemMetatable(lua_State* L, int32_t index, std::shared_ptr<Item> item);
 	static void setCreatureMetatable(lua_State* L, int32_t index, std::shared_ptr<Creature> creature);
@@ -166,6 +169,19 @@ public:
 	static void pushCombatDamage(lua_State* L, const CombatDamage &damage);
 	static void pushInstantSpell(lua_State* L, const InstantSpell &spell);
 	static void pushPosition(lua_State* L, const Position &position, int32_t stackpos = 0);
+	/**
+	 * Packed positions are plain Lua numbers (x + y * 2^16 + z * 2^32), an allocation
+	 * free alternative to Position tables for hot scripts. They are accepted anywhere
+	 * getPosition reads a position and can be used as table keys.
+	 */
+	static void pushPackedPosition(lua_State* L, const Position &position);
+	static lua_Number packPosition(const Position &position) {
+		return static_cast<lua_Number>(static_cast<uint64_t>(position.x) | (static_cast<uint64_t>(position.y) << 16) | (static_cast<uint64_t>(position.z) << 32));
+	}
+	static Position unpackPosition(lua_Number packed) {
+		const auto value = static_cast<uint64_t>(packed);
+		return Position(static_cast<uint16_t>(value), static_cast<uint16_t>(value >> 16), static_cast<uint8_t>(value >> 32));
+	}
 	static void pushOutfit(lua_State* L, const Outfit_t &outfit);
 
 	static void setField(lua_State* L, const char* index, lua_Number value) {
@@ -193,7 +209,15 @@ public:
 	}
 
 	static bool reserveScriptEnv() {
-		return ++scriptEnvIndex < 16;
+		// Lua can only be entered from the dispatcher, checked once per script call instead of on every push
+		if (validateDispatcherContext(__FUNCTION__)) {
+			return false;
+		}
+		if (++scriptEnvIndex >= 16) {
+			g_logger().error("[{}] - Call stack overflow, too many lua script calls being nested", __FUNCTION__);
+			return false;
+		}
+		return true;
 	}
 
 	static void resetScriptEnv() {
@@ -247,4 +271,20 @@ protected:
 	static ScriptEnvironment scriptEnv[16];
 	static int32_t scriptEnvIndex;
 	static int validateDispatcherContext(std::string_view fncName);
+
+private:
+	static void pushMetatable(lua_State* L, LuaData_t type);
+
+	// Registry refs of the class metatables taken by registerClass, valid only for the state that registered them
+	struct MetatableRefs {
+		MetatableRefs() {
+			byType.fill(LUA_NOREF);
+		}
+
+		std::array<int, magic_enum::enum_count<LuaData_t>()> byType;
+		phmap::flat_hash_map<std::string, int> byName;
+	};
+
+	// Keyed by the registering state; coroutine threads miss and fall back to the lookup by name
+	inline static phmap::flat_hash_map<lua_State*, MetatableRefs> metatableRefs;
 };
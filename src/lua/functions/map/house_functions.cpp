@@ -20,7 +20,7 @@ int HouseFunctions::luaHouseCreate(lua_State* L) {
 	// House(id)
 	if (const auto &house = g_game().map.houses.getHouse(getNumber<uint32_t>(L, 2))) {
 		pushUserdata<House>(L, house);
-		setMetatable(L, -1, "House");
+		setMetatable(L, -1, LuaData_t::House);
 	} else {
 		lua_pushnil(L);
 	}
@@ -57,7 +57,7 @@ int HouseFunctions::luaHouseGetTown(lua_State* L) {
 
 	if (const auto &town = g_game().map.towns.getTown(house->getTownId())) {
 		pushUserdata<Town>(L, town);
-		setMetatable(L, -1, "Town");
+		setMetatable(L, -1, LuaData_t::Town);
 	} else {
 		lua_pushnil(L);
 	}
@@ -318,7 +318,7 @@ int HouseFunctions::luaHouseGetTiles(lua_State* L) {
 	int index = 0;
 	for (std::shared_ptr<Tile> tile : tiles) {
 		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		setMetatable(L, -1, LuaData_t::Tile);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
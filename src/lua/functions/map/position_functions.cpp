@@ -268,3 +268,20 @@ int PositionFunctions::luaPositionToString(lua_State* L) {
 	pushString(L, position.toString());
 	return 1;
 }
+
+int PositionFunctions::luaPositionPack(lua_State* L) {
+	// position:pack()
+	pushPackedPosition(L, getPosition(L, 1));
+	return 1;
+}
+
+int PositionFunctions::luaPositionUnpack(lua_State* L) {
+	// Position.unpack(packedPosition)
+	if (!isNumber(L, 1)) {
+		lua_pushnil(L);
+		return 1;
+	}
+
+	pushPosition(L, unpackPosition(getNumber<lua_Number>(L, 1)));
+	return 1;
+}
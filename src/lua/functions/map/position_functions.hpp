@@ -34,6 +34,9 @@ public:
 		registerMethod(L, "Position", "sendDoubleSoundEffect", PositionFunctions::luaPositionSendDoubleSoundEffect);
 
 		registerMethod(L, "Position", "toString", PositionFunctions::luaPositionToString);
+
+		registerMethod(L, "Position", "pack", PositionFunctions::luaPositionPack);
+		registerMethod(L, "Position", "unpack", PositionFunctions::luaPositionUnpack);
 	}
 
 private:
@@ -57,4 +60,7 @@ private:
 	static int luaPositionSendDoubleSoundEffect(lua_State* L);
 
 	static int luaPositionToString(lua_State* L);
+
+	static int luaPositionPack(lua_State* L);
+	static int luaPositionUnpack(lua_State* L);
 };
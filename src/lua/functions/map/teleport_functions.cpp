@@ -21,7 +21,7 @@ int TeleportFunctions::luaTeleportCreate(lua_State* L) {
 	std::shared_ptr<Item> item = getScriptEnv()->getItemByUID(id);
 	if (item && item->getTeleport()) {
 		pushUserdata(L, item);
-		setMetatable(L, -1, "Teleport");
+		setMetatable(L, -1, LuaData_t::Teleport);
 	} else {
 		lua_pushnil(L);
 	}
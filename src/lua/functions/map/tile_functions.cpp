@@ -27,7 +27,7 @@ int TileFunctions::luaTileCreate(lua_State* L) {
 
 	if (tile) {
 		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		setMetatable(L, -1, LuaData_t::Tile);
 	} else {
 		lua_pushnil(L);
 	}
@@ -45,6 +45,17 @@ int TileFunctions::luaTileGetPosition(lua_State* L) {
 	return 1;
 }
 
+int TileFunctions::luaTileGetPackedPosition(lua_State* L) {
+	// tile:getPackedPosition()
+	std::shared_ptr<Tile> tile = getUserdataShared<Tile>(L, 1);
+	if (tile) {
+		pushPackedPosition(L, tile->getPosition());
+	} else {
+		lua_pushnil(L);
+	}
+	return 1;
+}
+
 int TileFunctions::luaTileGetGround(lua_State* L) {
 	// tile:getGround()
 	std::shared_ptr<Tile> tile = getUserdataShared<Tile>(L, 1);
@@ -649,7 +660,7 @@ int TileFunctions::luaTileGetHouse(lua_State* L) {
 
 	if (std::shared_ptr<HouseTile> houseTile = std::dynamic_pointer_cast<HouseTile>(tile)) {
 		pushUserdata<House>(L, houseTile->getHouse());
-		setMetatable(L, -1, "House");
+		setMetatable(L, -1, LuaData_t::House);
 	} else {
 		lua_pushnil(L);
 	}
@@ -18,6 +18,7 @@ public:
 		registerMetaMethod(L, "Tile", "__eq", TileFunctions::luaUserdataCompare);
 
 		registerMethod(L, "Tile", "getPosition", TileFunctions::luaTileGetPosition);
+		registerMethod(L, "Tile", "getPackedPosition", TileFunctions::luaTileGetPackedPosition);
 		registerMethod(L, "Tile", "getGround", TileFunctions::luaTileGetGround);
 		registerMethod(L, "Tile", "getThing", TileFunctions::luaTileGetThing);
 		registerMethod(L, "Tile", "getThingCount", TileFunctions::luaTileGetThingCount);
@@ -62,6 +63,7 @@ private:
 	static int luaTileCreate(lua_State* L);
 
 	static int luaTileGetPosition(lua_State* L);
+	static int luaTileGetPackedPosition(lua_State* L);
 	static int luaTileGetGround(lua_State* L);
 	static int luaTileGetThing(lua_State* L);
 	static int luaTileGetThingCount(lua_State* L);
@@ -26,7 +26,7 @@ int TownFunctions::luaTownCreate(lua_State* L) {
 
 	if (town) {
 		pushUserdata<Town>(L, town);
-		setMetatable(L, -1, "Town");
+		setMetatable(L, -1, LuaData_t::Town);
 	} else {
 		lua_pushnil(L);
 	}
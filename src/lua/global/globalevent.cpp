@@ -206,7 +206,7 @@ bool GlobalEvent::executePeriodChange(LightState_t lightState, LightInfo lightIn
 	// onPeriodChange(lightState, lightTime)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[GlobalEvent::executePeriodChange - {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 getName());
 		return false;
 	}
@@ -226,7 +226,7 @@ bool GlobalEvent::executeRecord(uint32_t current, uint32_t old) {
 	// onRecord(current, old)
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[GlobalEvent::executeRecord - {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 getName());
 		return false;
 	}
@@ -245,7 +245,7 @@ bool GlobalEvent::executeRecord(uint32_t current, uint32_t old) {
 bool GlobalEvent::executeEvent() const {
 	if (!getScriptInterface()->reserveScriptEnv()) {
 		g_logger().error("[GlobalEvent::executeEvent - {}] "
-						 "Call stack overflow. Too many lua script calls being nested.",
+						 "Could not reserve a script environment.",
 						 getName());
 		return false;
 	}
@@ -155,7 +155,7 @@ void Module::clearEvent() {
 void Module::executeOnRecvbyte(std::shared_ptr<Player> player, NetworkMessage &msg) {
 	// onRecvbyte(player, msg, recvbyte)
 	if (!scriptInterface->reserveScriptEnv()) {
-		g_logger().error("Call stack overflow. Too many lua script calls being nested {}", player->getName());
+		g_logger().error("Could not reserve a script environment {}", player->getName());
 		return;
 	}
 
@@ -166,7 +166,7 @@ void Module::executeOnRecvbyte(std::shared_ptr<Player> player, NetworkMessage &m
 
 	scriptInterface->pushFunction(scriptId);
 	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::setMetatable(L, -1, LuaData_t::Player);
 
 	LuaScriptInterface::pushUserdata<NetworkMessage>(L, std::shared_ptr<NetworkMessage>(&msg));
 	LuaScriptInterface::setWeakMetatable(L, -1, "NetworkMessage");
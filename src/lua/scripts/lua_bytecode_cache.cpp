@@ -0,0 +1,191 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lua/scripts/lua_bytecode_cache.hpp"
+
+#include "lua/scripts/lua_chunk_compiler.hpp"
+
+namespace {
+	constexpr std::array<char, 4> ENTRY_MAGIC = { 'C', 'L', 'B', 'C' };
+	constexpr uint32_t ENTRY_FORMAT = 2;
+	// Anything larger is a corrupted entry
+	constexpr uint64_t MAX_ENTRY_STRING = 64 * 1024 * 1024;
+	// Coarse file systems keep modification times in steps of up to 2 seconds, a script saved that close to its
+	// entry may have changed without its time changing
+	constexpr int64_t RACY_WINDOW = std::chrono::duration_cast<std::filesystem::file_time_type::duration>(std::chrono::seconds(2)).count();
+
+	struct EntryHeader {
+		std::string engine;
+		std::string key;
+		LuaBytecodeCache::Stamp stamp;
+		int64_t written = 0;
+		uint64_t contentHash = 0;
+		uint64_t bytecodeHash = 0;
+	};
+
+	template <typename T>
+	void writeValue(std::ostream &out, const T &value) {
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	bool readValue(std::istream &in, T &value) {
+		return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+	}
+
+	void writeString(std::ostream &out, std::string_view value) {
+		writeValue<uint64_t>(out, value.size());
+		out.write(value.data(), static_cast<std::streamsize>(value.size()));
+	}
+
+	bool readString(std::istream &in, std::string &value) {
+		uint64_t size = 0;
+		if (!readValue(in, size) || size > MAX_ENTRY_STRING) {
+			return false;
+		}
+		value.resize(size);
+		return static_cast<bool>(in.read(value.data(), static_cast<std::streamsize>(size)));
+	}
+
+	bool readHeader(std::istream &in, EntryHeader &header) {
+		std::array<char, 4> magic {};
+		uint32_t format = 0;
+		return readValue(in, magic) && magic == ENTRY_MAGIC
+			&& readValue(in, format) && format == ENTRY_FORMAT
+			&& readString(in, header.engine)
+			&& readString(in, header.key)
+			&& readValue(in, header.stamp.modified)
+			&& readValue(in, header.stamp.size)
+			&& readValue(in, header.written)
+			&& readValue(in, header.contentHash)
+			&& readValue(in, header.bytecodeHash);
+	}
+}
+
+bool LuaBytecodeCache::load(LuaChunk &chunk) {
+	if (!isEnabled()) {
+		return false;
+	}
+
+	const auto stamp = getStamp(chunk.file);
+	const auto key = getKey(chunk.file);
+	std::ifstream in(getEntryPath(key), std::ios::binary);
+	EntryHeader header;
+	if (!stamp || !in || !readHeader(in, header) || header.engine != getEngineVersion() || header.key != key || header.stamp.size != stamp->size) {
+		++misses;
+		return false;
+	}
+
+	// Touched but maybe not changed, by a checkout or a copy, or saved too close to the entry for its time to tell,
+	// the content decides
+	const bool racy = std::abs(stamp->modified - header.written) <= RACY_WINDOW;
+	std::string source;
+	if ((header.stamp.modified != stamp->modified || racy) && (!LuaChunkCompiler::readSource(chunk.file, source) || hash(source) != header.contentHash)) {
+		++misses;
+		return false;
+	}
+
+	if (!readString(in, chunk.bytecode) || chunk.bytecode.empty() || hash(chunk.bytecode) != header.bytecodeHash) {
+		chunk.bytecode.clear();
+		++misses;
+		return false;
+	}
+	in.close();
+
+	if (!source.empty()) {
+		// Saves hashing it again on the next load, a racy entry is written again far enough from the script
+		store(chunk, source, *stamp);
+	}
+	++hits;
+	return true;
+}
+
+bool LuaBytecodeCache::store(const LuaChunk &chunk, std::string_view source, const Stamp &stamp) const {
+	if (!isEnabled() || chunk.bytecode.empty()) {
+		return false;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(directory, ec);
+	const auto key = getKey(chunk.file);
+	const auto entryPath = getEntryPath(key);
+	// Written aside and renamed, so a reader never sees half an entry
+	auto tempPath = entryPath;
+	tempPath += fmt::format(".{}.tmp", std::hash<std::thread::id> {}(std::this_thread::get_id()));
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		out.write(ENTRY_MAGIC.data(), ENTRY_MAGIC.size());
+		writeValue(out, ENTRY_FORMAT);
+		writeString(out, getEngineVersion());
+		writeString(out, key);
+		writeValue(out, stamp.modified);
+		writeValue(out, stamp.size);
+		writeValue(out, static_cast<int64_t>(std::filesystem::file_time_type::clock::now().time_since_epoch().count()));
+		writeValue(out, hash(source));
+		writeValue(out, hash(chunk.bytecode));
+		writeString(out, chunk.bytecode);
+		if (!out) {
+			out.close();
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(tempPath, entryPath, ec);
+	if (ec) {
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+std::optional<LuaBytecodeCache::Stamp> LuaBytecodeCache::getStamp(const std::string &file) {
+	std::error_code ec;
+	const auto modified = std::filesystem::last_write_time(file, ec);
+	if (ec) {
+		return std::nullopt;
+	}
+
+	const auto size = std::filesystem::file_size(file, ec);
+	if (ec) {
+		return std::nullopt;
+	}
+	return Stamp { static_cast<int64_t>(modified.time_since_epoch().count()), static_cast<uint64_t>(size) };
+}
+
+uint64_t LuaBytecodeCache::hash(std::string_view data) {
+	// FNV-1a, stable across builds and platforms
+	uint64_t value = 14695981039346656037ULL;
+	for (const auto c : data) {
+		value ^= static_cast<uint8_t>(c);
+		value *= 1099511628211ULL;
+	}
+	return value;
+}
+
+const std::string &LuaBytecodeCache::getEngineVersion() {
+#ifdef LUAJIT_VERSION
+	static const std::string version = fmt::format("{} {}-bit", LUAJIT_VERSION, sizeof(void*) * 8);
+#else
+	static const std::string version = fmt::format("{} {}-bit", LUA_RELEASE, sizeof(void*) * 8);
+#endif
+	return version;
+}
+
+std::string LuaBytecodeCache::getKey(const std::string &file) {
+	std::error_code ec;
+	const auto path = std::filesystem::absolute(file, ec);
+	return (ec ? std::filesystem::path(file) : path).lexically_normal().generic_string();
+}
+
+std::filesystem::path LuaBytecodeCache::getEntryPath(const std::string &key) const {
+	return directory / fmt::format("{:016x}.luac", hash(key));
+}
@@ -0,0 +1,78 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/di/container.hpp"
+
+struct LuaChunk;
+
+// Bytecode of the compiled scripts kept on disk, one entry per script, so restarts and reloads skip the parsing.
+// An entry is keyed by the script path and the engine version, and is valid while the script keeps its modification
+// time and size; when only the time changed, or the script was saved within 2 seconds of the entry, the content hash
+// decides. The bytecode is checked against its own hash. Entries are replaced by renaming, so workers may load and
+// store different scripts concurrently.
+class LuaBytecodeCache {
+public:
+	struct Stamp {
+		int64_t modified = 0;
+		uint64_t size = 0;
+	};
+
+	LuaBytecodeCache() = default;
+
+	// Singleton - ensures we don't accidentally copy it
+	LuaBytecodeCache(const LuaBytecodeCache &) = delete;
+	void operator=(const LuaBytecodeCache &) = delete;
+
+	static LuaBytecodeCache &getInstance() {
+		return inject<LuaBytecodeCache>();
+	}
+
+	// An empty directory disables the cache
+	void setDirectory(const std::filesystem::path &newDirectory) {
+		directory = newDirectory;
+	}
+	const std::filesystem::path &getDirectory() const {
+		return directory;
+	}
+	bool isEnabled() const {
+		return !directory.empty();
+	}
+
+	// Fills the bytecode of the chunk from its entry, false if there is no valid one
+	bool load(LuaChunk &chunk);
+	// Stores the bytecode of the chunk, compiled from the source the file had at the stamp
+	bool store(const LuaChunk &chunk, std::string_view source, const Stamp &stamp) const;
+
+	static std::optional<Stamp> getStamp(const std::string &file);
+	static uint64_t hash(std::string_view data);
+	static const std::string &getEngineVersion();
+
+	size_t getHits() const {
+		return hits.load();
+	}
+	size_t getMisses() const {
+		return misses.load();
+	}
+	void resetCounters() {
+		hits = 0;
+		misses = 0;
+	}
+
+private:
+	static std::string getKey(const std::string &file);
+	std::filesystem::path getEntryPath(const std::string &key) const;
+
+	std::filesystem::path directory;
+	std::atomic_size_t hits = 0;
+	std::atomic_size_t misses = 0;
+};
+
+constexpr auto g_luaBytecodeCache = LuaBytecodeCache::getInstance;
@@ -0,0 +1,126 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lua/scripts/lua_chunk_compiler.hpp"
+
+#include "lib/thread/thread_pool.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
+
+namespace {
+	int writeBytecode(lua_State*, const void* data, size_t size, void* bytecode) {
+		static_cast<std::string*>(bytecode)->append(static_cast<const char*>(data), size);
+		return 0;
+	}
+}
+
+bool LuaChunkCompiler::compile(lua_State* L, LuaChunk &chunk, LuaBytecodeCache* cache) {
+	const auto top = lua_gettop(L);
+	chunk.bytecode.clear();
+	chunk.error.clear();
+
+	const auto chunkName = "@" + chunk.file;
+	if (!cache || !cache->isEnabled()) {
+		cache = nullptr;
+	} else if (cache->load(chunk)) {
+		// Checked here, so an entry the engine cannot load is compiled again instead of failing on the main state
+		const auto ret = luaL_loadbuffer(L, chunk.bytecode.data(), chunk.bytecode.size(), chunkName.c_str());
+		lua_settop(L, top);
+		if (ret == 0) {
+			return true;
+		}
+		chunk.bytecode.clear();
+	}
+
+	// The stamp is taken before reading, so a file edited meanwhile does not match its entry
+	std::optional<LuaBytecodeCache::Stamp> stamp;
+	std::string source;
+	int ret;
+	if (cache) {
+		stamp = LuaBytecodeCache::getStamp(chunk.file);
+		if (!readSource(chunk.file, source)) {
+			chunk.error = "cannot open " + chunk.file;
+			return false;
+		}
+		ret = luaL_loadbuffer(L, source.data(), source.size(), chunkName.c_str());
+	} else {
+		ret = luaL_loadfile(L, chunk.file.c_str());
+	}
+
+	if (ret != 0) {
+		const auto error = lua_tostring(L, -1);
+		chunk.error = error ? error : "unknown error loading " + chunk.file;
+		lua_settop(L, top);
+		return false;
+	}
+
+#if LUA_VERSION_NUM >= 503
+	ret = lua_dump(L, writeBytecode, &chunk.bytecode, 0);
+#else
+	ret = lua_dump(L, writeBytecode, &chunk.bytecode);
+#endif
+	lua_settop(L, top);
+	if (ret != 0) {
+		chunk.bytecode.clear();
+		chunk.error = "unable to dump the bytecode of " + chunk.file;
+		return false;
+	}
+
+	if (cache && stamp) {
+		cache->store(chunk, source, *stamp);
+	}
+	return true;
+}
+
+std::vector<LuaChunk> LuaChunkCompiler::compile(ThreadPool &threadPool, const std::vector<std::string> &files, LuaBytecodeCache* cache) {
+	std::vector<LuaChunk> chunks(files.size());
+	for (size_t i = 0; i < files.size(); ++i) {
+		chunks[i].file = files[i];
+	}
+
+	const auto workers = std::min<size_t>(threadPool.getNumberOfThreads(), files.size());
+	if (workers == 0) {
+		return chunks;
+	}
+
+	// Workers take the next file as they finish one, so a few large scripts do not hold back the others
+	std::atomic_size_t nextFile = 0;
+	std::latch pendingWorkers(static_cast<std::ptrdiff_t>(workers));
+	for (size_t worker = 0; worker < workers; ++worker) {
+		threadPool.addLoad([&chunks, &nextFile, &pendingWorkers, cache] {
+			lua_State* L = luaL_newstate();
+			for (auto i = nextFile.fetch_add(1); i < chunks.size(); i = nextFile.fetch_add(1)) {
+				if (!L) {
+					chunks[i].error = "not enough memory to compile " + chunks[i].file;
+					continue;
+				}
+				compile(L, chunks[i], cache);
+			}
+
+			if (L) {
+				lua_close(L);
+			}
+			pendingWorkers.count_down();
+		});
+	}
+
+	pendingWorkers.wait();
+	return chunks;
+}
+
+bool LuaChunkCompiler::readSource(const std::string &file, std::string &source) {
+	std::ifstream in(file, std::ios::binary);
+	if (!in) {
+		return false;
+	}
+
+	source.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	return !in.bad();
+}
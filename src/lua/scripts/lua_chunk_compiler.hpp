@@ -0,0 +1,34 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+class LuaBytecodeCache;
+class ThreadPool;
+
+// A script file compiled to bytecode, which any state of the same engine can load without parsing it again
+struct LuaChunk {
+	std::string file;
+	std::string bytecode;
+	// Syntax or read error, the chunk has no bytecode
+	std::string error;
+};
+
+// Reading and parsing the scripts is independent of the state that runs them, so it is done on the thread pool,
+// each worker in its own state, and only the execution is left to the main state.
+// With an enabled cache, the bytecode comes from it while the file is unchanged and is stored back once compiled.
+class LuaChunkCompiler {
+public:
+	// Compiles the file in the given state, leaving its stack as it was
+	static bool compile(lua_State* L, LuaChunk &chunk, LuaBytecodeCache* cache = nullptr);
+	// Compiles the files on the thread pool and waits for them, the chunks keep the order of the files
+	static std::vector<LuaChunk> compile(ThreadPool &threadPool, const std::vector<std::string> &files, LuaBytecodeCache* cache = nullptr);
+
+	static bool readSource(const std::string &file, std::string &source);
+};
@@ -14,6 +14,9 @@
 #include "lua/functions/lua_functions_loader.hpp"
 #include "lua/scripts/script_environment.hpp"
 #include "lua/global/lua_timer_event_descr.hpp"
+#include "config/configmanager.hpp"
+#include "game/scheduling/dispatcher.hpp"
+#include "lib/metrics/metrics.hpp"
 
 bool LuaEnvironment::shuttingDown = false;
 
@@ -82,6 +85,7 @@ bool LuaEnvironment::closeState() {
 	timerEvents.clear();
 	cacheFiles.clear();
 
+	LuaFunctionsLoader::clearMetatableRefs(luaState);
 	lua_close(luaState);
 	luaState = nullptr;
 	return true;
@@ -174,7 +178,7 @@ void LuaEnvironment::executeTimerEvent(uint32_t eventIndex) {
 		callFunction(timerEventDesc.parameters.size());
 	} else {
 		g_logger().error("[LuaEnvironment::executeTimerEvent - Lua file {}] "
-						 "Call stack overflow. Too many lua script calls being nested",
+						 "Could not reserve a script environment",
 						 getLoadingFile());
 	}
 
@@ -191,6 +195,7 @@ void LuaEnvironment::collectGarbage() const {
 	if (!collecting) {
 		collecting = true;
 
+		metrics::gc_latency measure("full");
 		// we must collect two times because __gc metamethod
 		// is called on uservalues only the second time
 		for (int i = -1; ++i < 2;) {
@@ -200,3 +205,51 @@ void LuaEnvironment::collectGarbage() const {
 		collecting = false;
 	}
 }
+
+void LuaEnvironment::configureGarbageCollector() {
+	if (!luaState) {
+		return;
+	}
+
+	lua_gc(luaState, LUA_GCSETPAUSE, g_configManager().getNumber(LUA_GC_PAUSE, __FUNCTION__));
+	lua_gc(luaState, LUA_GCSETSTEPMUL, g_configManager().getNumber(LUA_GC_STEP_MULTIPLIER, __FUNCTION__));
+
+	if (gcStepEventId != 0) {
+		g_dispatcher().stopEvent(gcStepEventId);
+	}
+	gcStepEventId = g_dispatcher().cycleEvent(
+		g_configManager().getNumber(LUA_GC_STEP_INTERVAL, __FUNCTION__), [this] { stepGarbage(); }, "LuaEnvironment::stepGarbage"
+	);
+}
+
+void LuaEnvironment::stepGarbage() {
+	if (!luaState) {
+		return;
+	}
+
+	// Size (in KB) of allocation "debt" paid by each step, small enough to keep slices fine grained
+	static constexpr int GC_STEP_SIZE_KB = 16;
+
+	int32_t heapKb = lua_gc(luaState, LUA_GCCOUNT, 0);
+	// Like the collector pause, only start a new cycle after the heap has grown enough
+	if (heapKb >= gcCycleThresholdKb) {
+		metrics::gc_latency measure("step");
+		const auto budget = std::chrono::microseconds(g_configManager().getNumber(LUA_GC_STEP_BUDGET, __FUNCTION__));
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			// lua_gc returns 1 when the step finished a collection cycle
+			if (lua_gc(luaState, LUA_GCSTEP, GC_STEP_SIZE_KB) == 1) {
+				heapKb = lua_gc(luaState, LUA_GCCOUNT, 0);
+				gcCycleThresholdKb = static_cast<int32_t>(static_cast<int64_t>(heapKb) * g_configManager().getNumber(LUA_GC_PAUSE, __FUNCTION__) / 100);
+				g_metrics().addCounter("lua_gc_cycles", 1);
+				break;
+			}
+		} while (std::chrono::steady_clock::now() - start < budget);
+		measure.stop();
+
+		heapKb = lua_gc(luaState, LUA_GCCOUNT, 0);
+	}
+
+	g_metrics().addUpDownCounter("lua_heap_kb", heapKb - gcReportedHeapKb);
+	gcReportedHeapKb = heapKb;
+}
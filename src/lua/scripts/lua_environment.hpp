@@ -86,6 +86,17 @@ public:
 
 	void collectGarbage() const;
 
+	/**
+	 * Applies the configured pause and step multiplier to the incremental collector
+	 * and (re)schedules its steps at the configured interval, also on config reloads.
+	 */
+	void configureGarbageCollector();
+	/**
+	 * Runs incremental collection steps until the configured time budget is spent
+	 * or a collection cycle finishes, replacing the periodic full collect.
+	 */
+	void stepGarbage();
+
 private:
 	void executeTimerEvent(uint32_t eventIndex);
 
@@ -106,6 +117,10 @@ private:
 
 	LuaScriptInterface* testInterface = nullptr;
 
+	uint64_t gcStepEventId = 0;
+	int32_t gcCycleThresholdKb = 0;
+	int32_t gcReportedHeapKb = 0;
+
 	friend class LuaScriptInterface;
 	friend class GlobalFunctions;
 	friend class CombatSpell;
@@ -10,6 +10,7 @@
 #include "pch.hpp"
 
 #include "lua/scripts/luascript.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
 #include "lua/scripts/lua_environment.hpp"
 #include "lib/metrics/metrics.hpp"
 
@@ -38,6 +39,12 @@ bool LuaScriptInterface::reInitState() {
 
 /// Same as lua_pcall, but adds stack trace to error strings in called function.
 int32_t LuaScriptInterface::loadFile(const std::string &file, const std::string &scriptName) {
+	if (g_luaBytecodeCache().isEnabled()) {
+		LuaChunk chunk { file };
+		LuaChunkCompiler::compile(luaState, chunk, &g_luaBytecodeCache());
+		return loadChunk(chunk, scriptName);
+	}
+
 	// loads file as a chunk at stack top
 	int ret = luaL_loadfile(luaState, file.c_str());
 	if (ret != 0) {
@@ -45,6 +52,27 @@ int32_t LuaScriptInterface::loadFile(const std::string &file, const std::string
 		return -1;
 	}
 
+	return executeLoadedChunk(file, scriptName);
+}
+
+int32_t LuaScriptInterface::loadChunk(const LuaChunk &chunk, const std::string &scriptName) {
+	if (!chunk.error.empty()) {
+		lastLuaError = chunk.error;
+		return -1;
+	}
+
+	// loads the precompiled bytecode as a chunk at stack top
+	const std::string chunkName = "@" + chunk.file;
+	int ret = luaL_loadbuffer(luaState, chunk.bytecode.data(), chunk.bytecode.size(), chunkName.c_str());
+	if (ret != 0) {
+		lastLuaError = popString(luaState);
+		return -1;
+	}
+
+	return executeLoadedChunk(chunk.file, scriptName);
+}
+
+int32_t LuaScriptInterface::executeLoadedChunk(const std::string &file, const std::string &scriptName) {
 	// check that it is loaded as a function
 	if (!isFunction(luaState, -1)) {
 		return -1;
@@ -62,7 +90,7 @@ int32_t LuaScriptInterface::loadFile(const std::string &file, const std::string
 	// env->setNpc(npc);
 
 	// execute it
-	ret = protectedCall(luaState, 0, 0);
+	const int ret = protectedCall(luaState, 0, 0);
 	if (ret != 0) {
 		reportError(nullptr, popString(luaState));
 		resetScriptEnv();
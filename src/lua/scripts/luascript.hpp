@@ -11,6 +11,7 @@
 
 #include "lib/logging/log_with_spd_log.hpp"
 #include "lua/functions/lua_functions_loader.hpp"
+#include "lua/scripts/lua_chunk_compiler.hpp"
 #include "lua/scripts/script_environment.hpp"
 
 class LuaScriptInterface : public LuaFunctionsLoader {
@@ -26,6 +27,8 @@ public:
 	virtual bool reInitState();
 
 	int32_t loadFile(const std::string &file, const std::string &scriptName);
+	// Executes a chunk compiled by LuaChunkCompiler, same as loadFile without reading and parsing the file
+	int32_t loadChunk(const LuaChunk &chunk, const std::string &scriptName);
 
 	const std::string &getFileById(int32_t scriptId);
 	int32_t getEvent(const std::string &eventName);
@@ -74,6 +77,8 @@ protected:
 
 private:
 	std::string getMetricsScope();
+	// Runs the chunk loaded at stack top as the file
+	int32_t executeLoadedChunk(const std::string &file, const std::string &scriptName);
 
 	std::string lastLuaError;
 	std::string interfaceName;
@@ -16,8 +16,11 @@
 #include "lua/scripts/scripts.hpp"
 #include "creatures/combat/spells.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
 
-Scripts::Scripts() :
+Scripts::Scripts(ThreadPool &threadPool) :
+	threadPool(threadPool),
 	scriptInterface("Scripts Interface") {
 	scriptInterface.initState();
 }
@@ -67,50 +70,70 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 		return false;
 	}
 
-	// Declare a string variable to store the last directory
-	std::string lastDirectory;
+	Benchmark bm_load;
+	const bool consoleLogs = g_configManager().getBoolean(SCRIPTS_CONSOLE_LOGS, __FUNCTION__);
+	// All the scripts found, in the order they are loaded
+	std::vector<std::filesystem::path> scripts;
+	// The ones that are executed, compiled ahead on the thread pool
+	std::vector<std::string> files;
 	// Recursive iterate through all entries in the directory
 	for (const auto &entry : std::filesystem::recursive_directory_iterator(dir)) {
-		// Get the filename of the entry as a string
-		const auto realPath = entry.path();
-		std::string fileFolder = realPath.parent_path().filename().string();
-		// Script folder, example: "actions"
-		std::string scriptFolder = realPath.parent_path().string();
-		// Create a string_view for the fileFolder and scriptFolder strings
-		std::string_view fileFolderView(fileFolder);
-		std::string_view scriptFolderView(scriptFolder);
-		// Filename, example: "demon.lua"
-		std::string file(realPath.filename().string());
+		const auto &realPath = entry.path();
 		if (!std::filesystem::is_regular_file(entry) || realPath.extension() != ".lua") {
 			// Skip this entry if it is not a regular file or does not have a .lua extension
 			continue;
 		}
 
 		// Check if file start with "#"
-		if (std::string disable("#");
-			file.front() == disable.front()) {
+		if (realPath.filename().string().front() == '#') {
 			// Send log of disabled script
-			if (g_configManager().getBoolean(SCRIPTS_CONSOLE_LOGS, __FUNCTION__)) {
+			if (consoleLogs) {
 				g_logger().info("[script]: {} [disabled]", realPath.filename().string());
 			}
 			// Skip for next loop and ignore disabled file
 			continue;
 		}
 
+		scripts.push_back(realPath);
 		// If the file is a library file or if the file's parent directory is not "lib" or "events"
-		if (isLib || (fileFolderView != "lib" && fileFolderView != "events")) {
+		const auto fileFolder = realPath.parent_path().filename().string();
+		if (isLib || (fileFolder != "lib" && fileFolder != "events")) {
+			files.push_back(realPath.string());
+		}
+	}
+
+	Benchmark bm_compile;
+	auto &bytecodeCache = g_luaBytecodeCache();
+	bytecodeCache.resetCounters();
+	const auto chunks = LuaChunkCompiler::compile(threadPool, files, &bytecodeCache);
+	const auto compileDuration = bm_compile.duration();
+
+	// Execution time per top folder, example: "actions"
+	std::map<std::string, std::pair<size_t, double>> folderDurations;
+	// Declare a string variable to store the last directory
+	std::string lastDirectory;
+	auto chunk = chunks.begin();
+	for (const auto &realPath : scripts) {
+		if (chunk != chunks.end() && chunk->file == realPath.string()) {
 			// If console logs are enabled and the file is not a library file
-			if (g_configManager().getBoolean(SCRIPTS_CONSOLE_LOGS, __FUNCTION__)) {
+			if (consoleLogs) {
 				// If the current directory is different from the last directory that was logged
-				if (lastDirectory.empty() || lastDirectory != scriptFolderView) {
+				if (lastDirectory != realPath.parent_path().string()) {
 					// Update the last directory variable and log the directory name
 					g_logger().info("Loading folder: [{}]", realPath.parent_path().filename().string());
 				}
 				lastDirectory = realPath.parent_path().string();
 			}
 
-			// If the function 'loadFile' returns -1, then there was an error loading the file
-			if (scriptInterface.loadFile(realPath.string(), realPath.filename().string()) == -1) {
+			Benchmark bm_script;
+			// If the function 'loadChunk' returns -1, then there was an error loading the file
+			const auto ret = scriptInterface.loadChunk(*chunk, realPath.filename().string());
+			const auto relativePath = realPath.lexically_relative(dir);
+			auto &[count, duration] = folderDurations[std::distance(relativePath.begin(), relativePath.end()) > 1 ? relativePath.begin()->string() : "."];
+			++count;
+			duration += bm_script.duration();
+			++chunk;
+			if (ret == -1) {
 				// Log the error and the file path, and skip to the next iteration of the loop.
 				g_logger().error(realPath.string());
 				g_logger().error(scriptInterface.getLastLuaError());
@@ -118,7 +141,7 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 			}
 		}
 
-		if (g_configManager().getBoolean(SCRIPTS_CONSOLE_LOGS, __FUNCTION__)) {
+		if (consoleLogs) {
 			if (!reload) {
 				g_logger().info("[script loaded]: {}", realPath.filename().string());
 			} else {
@@ -127,5 +150,9 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 		}
 	}
 
+	for (const auto &[folder, timing] : folderDurations) {
+		g_logger().debug("Executed {} scripts of {}/{} in {} milliseconds", timing.first, loadPath, folder, timing.second);
+	}
+	g_logger().info("Loaded {} scripts from {} in {} milliseconds, {} of them compiling on {} threads ({} from the bytecode cache)", files.size(), loadPath, bm_load.duration(), compileDuration, threadPool.getNumberOfThreads(), bytecodeCache.getHits());
 	return true;
 }
@@ -12,9 +12,11 @@
 #include "lib/di/container.hpp"
 #include "lua/scripts/luascript.hpp"
 
+class ThreadPool;
+
 class Scripts {
 public:
-	Scripts();
+	explicit Scripts(ThreadPool &threadPool);
 
 	// non-copyable
 	Scripts(const Scripts &) = delete;
@@ -41,6 +43,7 @@ public:
 	}
 
 private:
+	ThreadPool &threadPool;
 	int32_t scriptId = 0;
 	LuaScriptInterface scriptInterface;
 };
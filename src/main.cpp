@@ -11,6 +11,9 @@
 #include "canary_server.hpp"
 #include "lib/di/container.hpp"
 
-int main() {
+int main(int argc, char* argv[]) {
+	if (argc > 1 && std::string_view(argv[1]) == "--prewarm-lua-cache") {
+		return inject<CanaryServer>().prewarmLuaCache();
+	}
 	return inject<CanaryServer>().run();
 }
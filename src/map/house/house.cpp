@@ -11,7 +11,9 @@
 
 #include "utils/pugicast.hpp"
 #include "map/house/house.hpp"
+#include "map/house/house_rent.hpp"
 #include "io/iologindata.hpp"
+#include "io/io_name_cache.hpp"
 #include "game/game.hpp"
 #include "items/bed.hpp"
 #include "game/scheduling/save_manager.hpp"
@@ -530,20 +532,92 @@ bool House::executeTransfer(std::shared_ptr<HouseTransferItem> item, std::shared
 	return true;
 }
 
-void AccessList::parseList(const std::string &list) {
-	std::regex regexValidChars("[^a-zA-Z' \n*!@#]+");
-	std::string validList = std::regex_replace(list, regexValidChars, "");
+namespace {
+	struct AccessListEntries {
+		std::vector<std::string> players;
+		std::vector<std::string> guilds;
+		// Rank name and guild name
+		std::vector<std::pair<std::string, std::string>> guildRanks;
+		bool allowEveryone = false;
+	};
+
+	std::string getValidList(const std::string &list) {
+		static const std::regex regexValidChars("[^a-zA-Z' \n*!@#]+");
+		std::string validList = std::regex_replace(list, regexValidChars, "");
+
+		// Remove empty lines
+		std::istringstream iss(validList);
+		std::ostringstream oss;
+		std::string line;
+		while (std::getline(iss, line)) {
+			if (!line.empty()) {
+				oss << line << '\n';
+			}
+		}
+		return oss.str();
+	}
+
+	AccessListEntries parseEntries(const std::string &validList) {
+		AccessListEntries entries;
+		auto lines = explodeString(validList, "\n", 100);
+		for (auto &line : lines) {
+			trimString(line);
+			trim_left(line, '\t');
+			trim_right(line, '\t');
+			trimString(line);
+
+			if (line.empty() || line.front() == '#' || line.length() > 100) {
+				continue;
+			}
+
+			toLowerCaseString(line);
 
-	// Remove empty lines
-	std::istringstream iss(validList);
-	std::ostringstream oss;
-	std::string line;
-	while (std::getline(iss, line)) {
-		if (!line.empty()) {
-			oss << line << '\n';
+			std::string::size_type at_pos = line.find("@");
+			if (at_pos != std::string::npos) {
+				if (at_pos == 0) {
+					entries.guilds.push_back(line.substr(1));
+				} else {
+					entries.guildRanks.emplace_back(line.substr(0, at_pos - 1), line.substr(at_pos + 1));
+				}
+			} else if (line == "*") {
+				entries.allowEveryone = true;
+			} else if (line.find_first_of("!*?") != std::string::npos) {
+				// Remove regular expressions since they don't make much sense in houses
+				continue;
+			} else if (line.length() <= NETWORKMESSAGE_PLAYERNAME_MAXLENGTH) {
+				entries.players.push_back(line);
+			}
 		}
+		return entries;
 	}
-	validList = oss.str();
+
+	// Resolves the names of every entry with one query per QUERY_CHUNK_SIZE names, addPlayer and addGuild then hit the name cache
+	void resolveEntryNames(const std::vector<AccessListEntries> &entriesList) {
+		std::vector<std::string> playerNames;
+		std::vector<std::string> guildNames;
+		for (const auto &entries : entriesList) {
+			for (const auto &name : entries.players) {
+				if (!g_game().getPlayerByName(name)) {
+					playerNames.push_back(name);
+				}
+			}
+			guildNames.insert(guildNames.end(), entries.guilds.begin(), entries.guilds.end());
+			for (const auto &[rankName, guildName] : entries.guildRanks) {
+				guildNames.push_back(guildName);
+			}
+		}
+
+		if (!playerNames.empty()) {
+			g_nameCache().resolvePlayers(playerNames);
+		}
+		if (!guildNames.empty()) {
+			g_nameCache().resolveGuilds(guildNames);
+		}
+	}
+}
+
+void AccessList::parseList(const std::string &list) {
+	std::string validList = getValidList(list);
 
 	playerList.clear();
 	guildRankList.clear();
@@ -553,35 +627,28 @@ void AccessList::parseList(const std::string &list) {
 		return;
 	}
 
-	auto lines = explodeString(validList, "\n", 100);
-	for (auto &line : lines) {
-		trimString(line);
-		trim_left(line, '\t');
-		trim_right(line, '\t');
-		trimString(line);
-
-		if (line.empty() || line.front() == '#' || line.length() > 100) {
-			continue;
-		}
+	const auto entries = parseEntries(validList);
+	resolveEntryNames({ entries });
 
-		toLowerCaseString(line);
+	allowEveryone = entries.allowEveryone;
+	for (const auto &name : entries.players) {
+		addPlayer(name);
+	}
+	for (const auto &name : entries.guilds) {
+		addGuild(name);
+	}
+	for (const auto &[rankName, guildName] : entries.guildRanks) {
+		addGuildRank(rankName, guildName);
+	}
+}
 
-		std::string::size_type at_pos = line.find("@");
-		if (at_pos != std::string::npos) {
-			if (at_pos == 0) {
-				addGuild(line.substr(1));
-			} else {
-				addGuildRank(line.substr(0, at_pos - 1), line.substr(at_pos + 1));
-			}
-		} else if (line == "*") {
-			allowEveryone = true;
-		} else if (line.find_first_of("!*?") != std::string::npos) {
-			// Remove regular expressions since they don't make much sense in houses
-			continue;
-		} else if (line.length() <= NETWORKMESSAGE_PLAYERNAME_MAXLENGTH) {
-			addPlayer(line);
-		}
+void AccessList::resolveNames(const std::vector<std::string> &lists) {
+	std::vector<AccessListEntries> entriesList;
+	entriesList.reserve(lists.size());
+	for (const auto &list : lists) {
+		entriesList.push_back(parseEntries(getValidList(list)));
 	}
+	resolveEntryNames(entriesList);
 }
 
 void AccessList::addPlayer(const std::string &name) {
@@ -778,110 +845,125 @@ void Houses::payHouses(RentPeriod_t rentPeriod) const {
 		return;
 	}
 
-	time_t currentTime = time(nullptr);
-	for (const auto &it : houseMap) {
-		std::shared_ptr<House> house = it.second;
-		if (house->getOwner() == 0) {
+	Benchmark bm_payHouses;
+	HouseRent::Settings settings;
+	settings.now = time(nullptr);
+	settings.period = HouseRent::getPeriodSeconds(rentPeriod);
+	settings.daysToReset = g_configManager().getNumber(HOUSE_LOSE_AFTER_INACTIVITY, __FUNCTION__);
+	settings.vipKeepsHouse = g_configManager().getBoolean(VIP_KEEP_HOUSE, __FUNCTION__) && g_configManager().getBoolean(VIP_SYSTEM_ENABLED, __FUNCTION__);
+
+	std::vector<std::shared_ptr<House>> houses;
+	std::vector<HouseRent::Lease> leases;
+	std::unordered_set<uint32_t> ownerIds;
+	std::vector<uint32_t> offlineOwners;
+	HouseRent::Owners owners;
+	for (const auto &[_, house] : houseMap) {
+		if (house->getOwner() == 0 || !g_game().map.towns.getTown(house->getTownId())) {
 			continue;
 		}
 
 		const uint32_t ownerId = house->getOwner();
-		const auto &town = g_game().map.towns.getTown(house->getTownId());
-		if (!town) {
+		houses.push_back(house);
+		leases.push_back({ house->getId(), ownerId, house->getRent(), house->getPaidUntil(), house->getPayRentWarnings() });
+		if (!ownerIds.emplace(ownerId).second) {
 			continue;
 		}
 
-		auto player = g_game().getPlayerByGUID(ownerId, true);
-		if (!player) {
-			// Player doesn't exist, reset house owner
+		if (const auto &player = g_game().getPlayerByGUID(ownerId)) {
+			auto &owner = owners[ownerId];
+			owner.name = player->getName();
+			owner.balance = player->getBankBalance();
+			owner.lastLogin = player->getLastLoginSaved();
+			owner.premiumLastDay = player->getPremiumLastDay();
+			owner.online = true;
+		} else {
+			offlineOwners.push_back(ownerId);
+		}
+	}
+
+	size_t queries = HouseRent::loadOwners(offlineOwners, owners);
+
+	const auto actions = HouseRent::plan(leases, owners, settings);
+	// Charged before any owner gets loaded below, so its save keeps the new balance
+	queries += HouseRent::saveBalances(owners);
+
+	size_t loadedPlayers = 0;
+	for (size_t i = 0; i < actions.size(); ++i) {
+		const auto &house = houses[i];
+		const auto action = actions[i];
+		if (action == HouseRent::Action::None) {
+			continue;
+		}
+
+		if (action == HouseRent::Action::Release) {
 			house->tryTransferOwnership(nullptr, true);
 			continue;
 		}
 
-		// Player hasn't logged in for a while, reset house owner
-		auto daysToReset = g_configManager().getNumber(HOUSE_LOSE_AFTER_INACTIVITY, __FUNCTION__);
-		if (daysToReset > 0) {
-			auto daysSinceLastLogin = (currentTime - player->getLastLoginSaved()) / (60 * 60 * 24);
-			bool vipKeep = g_configManager().getBoolean(VIP_KEEP_HOUSE, __FUNCTION__) && player->isVip();
-			bool activityKeep = daysSinceLastLogin < daysToReset;
-			if (vipKeep && !activityKeep) {
-				g_logger().info("Player {} has not logged in for {} days, but is a VIP, so the house will not be reset.", player->getName(), daysToReset);
-			} else if (!vipKeep && !activityKeep) {
-				g_logger().info("Player {} has not logged in for {} days, so the house will be reset.", player->getName(), daysToReset);
-				house->setOwner(0, true, player);
-				g_saveManager().savePlayer(player);
-				continue;
+		const auto &owner = owners.at(leases[i].ownerGuid);
+		if (action == HouseRent::Action::Pay) {
+			if (owner.online) {
+				if (const auto &player = g_game().getPlayerByGUID(leases[i].ownerGuid)) {
+					player->setBankBalance(player->getBankBalance() - leases[i].rent);
+				}
 			}
+			g_metrics().addCounter("balance_decrease", leases[i].rent, { { "player", owner.name }, { "context", "house_rent" } });
+			house->setPaidUntil(settings.now + settings.period);
+			continue;
 		}
 
-		const uint32_t rent = house->getRent();
-		if (rent == 0 || house->getPaidUntil() > currentTime) {
+		// Warning letters and evictions move items, only these owners are fully loaded
+		auto player = g_game().getPlayerByGUID(leases[i].ownerGuid, true);
+		if (!player) {
+			house->tryTransferOwnership(nullptr, true);
 			continue;
 		}
+		if (!owner.online) {
+			++loadedPlayers;
+		}
 
-		if (player->getBankBalance() >= rent) {
-			g_game().removeMoney(player, rent, 0, true);
-			g_metrics().addCounter("balance_decrease", rent, { { "player", player->getName() }, { "context", "house_rent" } });
+		if (action == HouseRent::Action::EvictInactive) {
+			g_logger().info("Player {} has not logged in for {} days, so the house will be reset.", player->getName(), settings.daysToReset);
+			house->setOwner(0, true, player);
+		} else if (action == HouseRent::Action::Warn) {
+			const int32_t daysLeft = HouseRent::MAX_WARNINGS - house->getPayRentWarnings();
 
-			time_t paidUntil = currentTime;
+			std::string period;
 			switch (rentPeriod) {
 				case RENTPERIOD_DAILY:
-					paidUntil += 24 * 60 * 60;
+					period = "daily";
 					break;
+
 				case RENTPERIOD_WEEKLY:
-					paidUntil += 24 * 60 * 60 * 7;
+					period = "weekly";
 					break;
+
 				case RENTPERIOD_MONTHLY:
-					paidUntil += 24 * 60 * 60 * 30;
+					period = "monthly";
 					break;
+
 				case RENTPERIOD_YEARLY:
-					paidUntil += 24 * 60 * 60 * 365;
+					period = "annual";
 					break;
+
 				default:
 					break;
 			}
 
-			house->setPaidUntil(paidUntil);
+			std::shared_ptr<Item> letter = Item::CreateItem(ITEM_LETTER_STAMPED);
+			std::ostringstream ss;
+			ss << "Warning! \nThe " << period << " rent of " << house->getRent() << " gold for your house \"" << house->getName() << "\" is payable. Have it within " << daysLeft << " days or you will lose this house.";
+			letter->setAttribute(ItemAttribute_t::TEXT, ss.str());
+			g_game().internalAddItem(player->getInbox(), letter, INDEX_WHEREEVER, FLAG_NOLIMIT);
+			house->setPayRentWarnings(house->getPayRentWarnings() + 1);
 		} else {
-			if (house->getPayRentWarnings() < 7) {
-				int32_t daysLeft = 7 - house->getPayRentWarnings();
-
-				std::shared_ptr<Item> letter = Item::CreateItem(ITEM_LETTER_STAMPED);
-				std::string period;
-
-				switch (rentPeriod) {
-					case RENTPERIOD_DAILY:
-						period = "daily";
-						break;
-
-					case RENTPERIOD_WEEKLY:
-						period = "weekly";
-						break;
-
-					case RENTPERIOD_MONTHLY:
-						period = "monthly";
-						break;
-
-					case RENTPERIOD_YEARLY:
-						period = "annual";
-						break;
-
-					default:
-						break;
-				}
-
-				std::ostringstream ss;
-				ss << "Warning! \nThe " << period << " rent of " << house->getRent() << " gold for your house \"" << house->getName() << "\" is payable. Have it within " << daysLeft << " days or you will lose static_self_cast<HouseTransferItem>() house.";
-				letter->setAttribute(ItemAttribute_t::TEXT, ss.str());
-				g_game().internalAddItem(player->getInbox(), letter, INDEX_WHEREEVER, FLAG_NOLIMIT);
-				house->setPayRentWarnings(house->getPayRentWarnings() + 1);
-			} else {
-				house->setOwner(0, true, player);
-			}
+			house->setOwner(0, true, player);
 		}
 
 		g_saveManager().savePlayer(player);
 	}
+
+	g_logger().info("Processed the rent of {} houses in {} milliseconds, {} queries and {} players loaded", leases.size(), bm_payHouses.duration(), queries, loadedPlayers);
 }
 
 uint32_t House::getRent() const {
@@ -21,6 +21,8 @@ class Player;
 class AccessList {
 public:
 	void parseList(const std::string &list);
+	// Looks up the player and guild names of many lists at once, so parsing them afterwards needs no queries
+	static void resolveNames(const std::vector<std::string> &lists);
 	void addPlayer(const std::string &name);
 	void addGuild(const std::string &name);
 	void addGuildRank(const std::string &name, const std::string &rankName);
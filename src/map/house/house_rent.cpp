@@ -0,0 +1,124 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "map/house/house_rent.hpp"
+
+#include "database/database.hpp"
+
+time_t HouseRent::getPeriodSeconds(RentPeriod_t rentPeriod) {
+	switch (rentPeriod) {
+		case RENTPERIOD_DAILY:
+			return 24 * 60 * 60;
+		case RENTPERIOD_WEEKLY:
+			return 24 * 60 * 60 * 7;
+		case RENTPERIOD_MONTHLY:
+			return 24 * 60 * 60 * 30;
+		case RENTPERIOD_YEARLY:
+			return 24 * 60 * 60 * 365;
+		default:
+			return 0;
+	}
+}
+
+std::vector<HouseRent::Action> HouseRent::plan(const std::vector<Lease> &leases, Owners &owners, const Settings &settings) {
+	std::vector<Action> actions;
+	actions.reserve(leases.size());
+	for (const auto &lease : leases) {
+		const auto it = owners.find(lease.ownerGuid);
+		if (it == owners.end()) {
+			actions.push_back(Action::Release);
+			continue;
+		}
+
+		auto &owner = it->second;
+		if (settings.daysToReset > 0) {
+			const auto daysSinceLastLogin = (settings.now - owner.lastLogin) / (60 * 60 * 24);
+			const bool vipKeep = settings.vipKeepsHouse && owner.premiumLastDay > settings.now;
+			if (!vipKeep && daysSinceLastLogin >= settings.daysToReset) {
+				actions.push_back(Action::EvictInactive);
+				continue;
+			}
+		}
+
+		if (lease.rent == 0 || lease.paidUntil > settings.now) {
+			actions.push_back(Action::None);
+		} else if (owner.balance >= lease.rent) {
+			owner.balance -= lease.rent;
+			owner.charged = true;
+			actions.push_back(Action::Pay);
+		} else if (lease.warnings < MAX_WARNINGS) {
+			actions.push_back(Action::Warn);
+		} else {
+			actions.push_back(Action::Evict);
+		}
+	}
+	return actions;
+}
+
+size_t HouseRent::loadOwners(const std::vector<uint32_t> &guids, Owners &owners) {
+	size_t queries = 0;
+	for (size_t first = 0; first < guids.size(); first += QUERY_CHUNK_SIZE) {
+		const auto last = std::min(guids.size(), first + QUERY_CHUNK_SIZE);
+		std::string query = "SELECT `players`.`id`, `players`.`name`, `players`.`balance`, `players`.`lastlogin`, `accounts`.`lastday` FROM `players` INNER JOIN `accounts` ON `accounts`.`id` = `players`.`account_id` WHERE `players`.`id` IN (";
+		for (size_t i = first; i < last; ++i) {
+			if (i != first) {
+				query += ',';
+			}
+			query += std::to_string(guids[i]);
+		}
+		query += ')';
+
+		++queries;
+		const DBResult_ptr result = g_database().storeQuery(query);
+		if (!result) {
+			continue;
+		}
+
+		do {
+			auto &owner = owners[result->getNumber<uint32_t>("id")];
+			owner.name = result->getString("name");
+			owner.balance = result->getNumber<uint64_t>("balance");
+			owner.lastLogin = result->getNumber<time_t>("lastlogin");
+			owner.premiumLastDay = result->getNumber<time_t>("lastday");
+		} while (result->next());
+	}
+	return queries;
+}
+
+size_t HouseRent::saveBalances(const Owners &owners) {
+	std::vector<std::pair<uint32_t, uint64_t>> balances;
+	for (const auto &[guid, owner] : owners) {
+		if (owner.charged && !owner.online) {
+			balances.emplace_back(guid, owner.balance);
+		}
+	}
+
+	size_t queries = 0;
+	for (size_t first = 0; first < balances.size(); first += QUERY_CHUNK_SIZE) {
+		const auto last = std::min(balances.size(), first + QUERY_CHUNK_SIZE);
+		std::string cases;
+		std::string ids;
+		for (size_t i = first; i < last; ++i) {
+			const auto &[guid, balance] = balances[i];
+			cases += fmt::format(" WHEN {} THEN {}", guid, balance);
+			if (i != first) {
+				ids += ',';
+			}
+			ids += std::to_string(guid);
+		}
+
+		++queries;
+		if (!g_database().executeQuery(fmt::format("UPDATE `players` SET `balance` = CASE `id`{} END WHERE `id` IN ({})", cases, ids))) {
+			g_logger().error("[{}] - Failed to charge the house rent of {} players", __FUNCTION__, last - first);
+		}
+	}
+	return queries;
+}
@@ -0,0 +1,69 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "map/map_definitions.hpp"
+
+// Rent of every owned house settled in bulk: the owners are read with a few set based queries, the rent is charged
+// straight on their bank balance and only the owners receiving a warning letter or losing their house are loaded.
+class HouseRent {
+public:
+	static constexpr size_t QUERY_CHUNK_SIZE = 500;
+	static constexpr uint32_t MAX_WARNINGS = 7;
+
+	struct Lease {
+		uint32_t houseId = 0;
+		uint32_t ownerGuid = 0;
+		uint32_t rent = 0;
+		time_t paidUntil = 0;
+		uint32_t warnings = 0;
+	};
+
+	struct Owner {
+		std::string name;
+		uint64_t balance = 0;
+		time_t lastLogin = 0;
+		time_t premiumLastDay = 0;
+		// Online owners are charged on their player, everyone else through saveBalances
+		bool online = false;
+		bool charged = false;
+	};
+
+	enum class Action : uint8_t {
+		// Not due yet or free of charge
+		None,
+		// The owner does not exist anymore
+		Release,
+		// The owner has not logged in for HOUSE_LOSE_AFTER_INACTIVITY days
+		EvictInactive,
+		Pay,
+		Warn,
+		Evict,
+	};
+
+	struct Settings {
+		time_t now = 0;
+		time_t period = 0;
+		int64_t daysToReset = 0;
+		bool vipKeepsHouse = false;
+	};
+
+	using Owners = std::unordered_map<uint32_t, Owner>;
+
+	static time_t getPeriodSeconds(RentPeriod_t rentPeriod);
+
+	// One action per lease, balances of the owners paying are decreased in owners, in the order of the leases
+	static std::vector<Action> plan(const std::vector<Lease> &leases, Owners &owners, const Settings &settings);
+
+	// Owners missing from the result do not exist anymore. Returns the number of queries issued.
+	static size_t loadOwners(const std::vector<uint32_t> &guids, Owners &owners);
+	// Writes the balance of every offline owner charged by plan. Returns the number of queries issued.
+	static size_t saveBalances(const Owners &owners);
+};
@@ -215,11 +215,14 @@ void Map::setTile(uint16_t x, uint16_t y, uint8_t z, std::shared_ptr<Tile> newTi
 		return;
 	}
 
-	if (const auto leaf = getQTNode(x, y)) {
-		leaf->createFloor(z)->setTile(x, y, newTile);
-	} else {
-		root.getBestLeaf(x, y, 15)->createFloor(z)->setTile(x, y, newTile);
+	auto leaf = getQTNode(x, y);
+	if (!leaf) {
+		leaf = root.getBestLeaf(x, y, 15);
 	}
+
+	const auto &floor = leaf->createFloor(z);
+	std::unique_lock l(floor->getMutex());
+	floor->setTile(x, y, std::move(newTile));
 }
 
 bool Map::placeCreature(const Position &centerPos, std::shared_ptr<Creature> creature, bool extendedPos /* = false*/, bool forceLogin /* = false*/) {
@@ -316,9 +319,59 @@ bool Map::placeCreature(const Position &centerPos, std::shared_ptr<Creature> cre
 
 	const Position &dest = toCylinder->getPosition();
 	getQTNode(dest.x, dest.y)->addCreature(creature);
+	if (creature->getPlayer()) {
+		wakeCreaturesInHibernationRange(dest);
+	}
 	return true;
 }
 
+template <typename F>
+void Map::forEachLeafInHibernationRange(const Position &pos, F &&f) {
+	constexpr int32_t maxLeaf = std::numeric_limits<uint16_t>::max() >> FLOOR_BITS;
+	const int32_t leafX = pos.x >> FLOOR_BITS;
+	const int32_t leafY = pos.y >> FLOOR_BITS;
+	const int32_t endX = std::min(leafX + HIBERNATION_RANGE_X, maxLeaf);
+	const int32_t endY = std::min(leafY + HIBERNATION_RANGE_Y, maxLeaf);
+	for (int32_t y = std::max(leafY - HIBERNATION_RANGE_Y, 0); y <= endY; ++y) {
+		for (int32_t x = std::max(leafX - HIBERNATION_RANGE_X, 0); x <= endX; ++x) {
+			if (const auto leaf = getQTNode(static_cast<uint16_t>(x << FLOOR_BITS), static_cast<uint16_t>(y << FLOOR_BITS))) {
+				if (f(*leaf)) {
+					return;
+				}
+			}
+		}
+	}
+}
+
+bool Map::hasPlayersInHibernationRange(const Position &pos) {
+	bool found = false;
+	forEachLeafInHibernationRange(pos, [&found](const QTreeLeafNode &leaf) {
+		found = !leaf.player_list.empty();
+		return found;
+	});
+	return found;
+}
+
+void Map::wakeCreaturesInHibernationRange(const Position &pos) {
+	if (g_game().getHibernatingCreatures() == 0) {
+		return;
+	}
+
+	std::vector<std::shared_ptr<Creature>> sleepers;
+	forEachLeafInHibernationRange(pos, [&sleepers](const QTreeLeafNode &leaf) {
+		for (const auto &creature : leaf.creature_list) {
+			if (creature->hibernating) {
+				sleepers.push_back(creature);
+			}
+		}
+		return false;
+	});
+
+	for (const auto &creature : sleepers) {
+		g_game().wakeCreature(creature);
+	}
+}
+
 void Map::moveCreature(const std::shared_ptr<Creature> &creature, const std::shared_ptr<Tile> &newTile, bool forceTeleport /* = false*/) {
 	auto oldTile = creature->getTile();
 
@@ -358,6 +411,16 @@ void Map::moveCreature(const std::shared_ptr<Creature> &creature, const std::sha
 	if (leaf != new_leaf) {
 		leaf->removeCreature(creature);
 		new_leaf->addCreature(creature);
+
+		if (creature->getPlayer()) {
+			wakeCreaturesInHibernationRange(newPos);
+		} else if (creature->hibernating) {
+			// Moved by someone else, it hibernates again on its next check if still out of range
+			g_game().wakeCreature(creature);
+		}
+	} else if (oldPos.z != newPos.z) {
+		// Floor filtered caches of the leaf content (TargetAcquisition) must see the new floor
+		leaf->bumpCreatureRevision();
 	}
 
 	// add the creature
@@ -135,6 +135,15 @@ public:
 		return QTreeNode::getLeafStatic<QTreeLeafNode*, QTreeNode*>(&root, x, y);
 	}
 
+	// Creatures with no player within these many leaves (of every floor) hibernate, see Game::checkCreatures.
+	// Covers the view port plus a leaf of margin wherever the creature stands in its own leaf.
+	static constexpr int32_t HIBERNATION_RANGE_X = (MAP_MAX_VIEW_PORT_X + FLOOR_SIZE) / FLOOR_SIZE + 1;
+	static constexpr int32_t HIBERNATION_RANGE_Y = (MAP_MAX_VIEW_PORT_Y + FLOOR_SIZE) / FLOOR_SIZE + 1;
+
+	bool hasPlayersInHibernationRange(const Position &pos);
+	// Wakes the hibernating creatures of the leaves in range of pos, called whenever a player enters a leaf
+	void wakeCreaturesInHibernationRange(const Position &pos);
+
 	// Storage made by "loadFromXML" of houses, monsters and npcs for main map
 	SpawnsMonster spawnsMonster;
 	SpawnsNpc spawnsNpc;
@@ -147,6 +156,9 @@ public:
 	Houses housesCustomMaps[50];
 
 private:
+	template <typename F>
+	void forEachLeafInHibernationRange(const Position &pos, F &&f);
+
 	bool getPathMatching(const std::shared_ptr<Creature> &creature, const Position &startPos, stdext::arraylist<Direction> &dirList, const FrozenPathingConditionCall &pathCondition, const FindPathParams &fpp);
 
 	/**
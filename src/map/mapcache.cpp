@@ -102,13 +102,18 @@ std::shared_ptr<Item> MapCache::createItem(const std::shared_ptr<BasicItem> &Bas
 }
 
 std::shared_ptr<Tile> MapCache::getOrCreateTileFromCache(const std::unique_ptr<Floor> &floor, uint16_t x, uint16_t y) {
-	const auto cachedTile = floor->getTileCache(x, y);
-	if (!cachedTile) {
+	if (!floor->hasTileCache(x, y)) {
 		return floor->getTile(x, y);
 	}
 
 	std::unique_lock l(floor->getMutex());
 
+	// Another thread may have materialized this tile while we were waiting for the lock
+	const auto cachedTile = floor->getTileCache(x, y);
+	if (!cachedTile) {
+		return floor->getTile(x, y);
+	}
+
 	const uint8_t z = floor->getZ();
 
 	auto map = static_cast<Map*>(this);
@@ -147,6 +152,19 @@ std::shared_ptr<Tile> MapCache::getOrCreateTileFromCache(const std::unique_ptr<F
 	return tile;
 }
 
+std::shared_ptr<Tile> Floor::getTile(uint16_t x, uint16_t y) const {
+	return slots[x & FLOOR_MASK][y & FLOOR_MASK].tile.load(std::memory_order_acquire);
+}
+
+void Floor::setTile(uint16_t x, uint16_t y, std::shared_ptr<Tile> tile) {
+	auto &slot = slots[x & FLOOR_MASK][y & FLOOR_MASK];
+	// Writers are serialized by the floor mutex, only readers race with the store
+	if (slot.tile.load(std::memory_order_relaxed) == tile) {
+		return;
+	}
+	slot.tile.store(std::move(tile), std::memory_order_release);
+}
+
 void MapCache::setBasicTile(uint16_t x, uint16_t y, uint8_t z, const std::shared_ptr<BasicTile> &newTile) {
 	if (z >= MAP_MAX_LAYERS) {
 		g_logger().error("Attempt to set tile on invalid coordinate: {}", Position(x, y, z).toString());
@@ -154,11 +172,14 @@ void MapCache::setBasicTile(uint16_t x, uint16_t y, uint8_t z, const std::shared
 	}
 
 	const auto tile = static_tryGetTileFromCache(newTile);
-	if (const auto leaf = QTreeNode::getLeafStatic<QTreeLeafNode*, QTreeNode*>(&root, x, y)) {
-		leaf->createFloor(z)->setTileCache(x, y, tile);
-	} else {
-		root.getBestLeaf(x, y, 15)->createFloor(z)->setTileCache(x, y, tile);
+	auto leaf = QTreeNode::getLeafStatic<QTreeLeafNode*, QTreeNode*>(&root, x, y);
+	if (!leaf) {
+		leaf = root.getBestLeaf(x, y, 15);
 	}
+
+	const auto &floor = leaf->createFloor(z);
+	std::unique_lock l(floor->getMutex());
+	floor->setTileCache(x, y, tile);
 }
 
 std::shared_ptr<BasicItem> MapCache::tryReplaceItemFromCache(const std::shared_ptr<BasicItem> &ref) {
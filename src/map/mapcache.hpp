@@ -79,26 +79,41 @@ private:
 
 #pragma pack()
 
+/**
+ * Tiles of a 8x8 block of a single floor.
+ *
+ * Reads take no floor lock: every slot publishes its tile through an
+ * std::atomic<std::shared_ptr>, so a reader always comes away owning a
+ * reference and a replaced tile lives until its last reader drops it.
+ * Writers must hold the floor mutex exclusively, Map::setTile and
+ * MapCache::setBasicTile take it.
+ */
 struct Floor {
 	explicit Floor(uint8_t z) :
 		z(z) { }
 
-	std::shared_ptr<Tile> getTile(uint16_t x, uint16_t y) const {
-		std::shared_lock sl(mutex);
-		return tiles[x & FLOOR_MASK][y & FLOOR_MASK].first;
-	}
+	std::shared_ptr<Tile> getTile(uint16_t x, uint16_t y) const;
 
-	void setTile(uint16_t x, uint16_t y, std::shared_ptr<Tile> tile) {
-		tiles[x & FLOOR_MASK][y & FLOOR_MASK].first = tile;
+	// Must be called with the floor mutex held exclusively
+	void setTile(uint16_t x, uint16_t y, std::shared_ptr<Tile> tile);
+
+	bool hasTileCache(uint16_t x, uint16_t y) const {
+		return slots[x & FLOOR_MASK][y & FLOOR_MASK].hasCache.load(std::memory_order_acquire);
 	}
 
+	/**
+	 * Must be called with the floor mutex held, the cached tile is only
+	 * consumed while materializing a tile (see MapCache::getOrCreateTileFromCache).
+	 */
 	std::shared_ptr<BasicTile> getTileCache(uint16_t x, uint16_t y) const {
-		std::shared_lock sl(mutex);
-		return tiles[x & FLOOR_MASK][y & FLOOR_MASK].second;
+		return slots[x & FLOOR_MASK][y & FLOOR_MASK].cache;
 	}
 
+	// Must be called with the floor mutex held exclusively
 	void setTileCache(uint16_t x, uint16_t y, const std::shared_ptr<BasicTile> &newTile) {
-		tiles[x & FLOOR_MASK][y & FLOOR_MASK].second = newTile;
+		auto &slot = slots[x & FLOOR_MASK][y & FLOOR_MASK];
+		slot.cache = newTile;
+		slot.hasCache.store(newTile != nullptr, std::memory_order_release);
 	}
 
 	uint8_t getZ() const {
@@ -110,7 +125,13 @@ struct Floor {
 	}
 
 private:
-	std::pair<std::shared_ptr<Tile>, std::shared_ptr<BasicTile>> tiles[FLOOR_SIZE][FLOOR_SIZE] = {};
+	struct Slot {
+		std::atomic<std::shared_ptr<Tile>> tile;
+		std::atomic<bool> hasCache { false };
+		std::shared_ptr<BasicTile> cache;
+	};
+
+	Slot slots[FLOOR_SIZE][FLOOR_SIZE] = {};
 	mutable std::shared_mutex mutex;
 	uint8_t z { 0 };
 };
@@ -71,6 +71,7 @@ QTreeLeafNode* QTreeNode::getBestLeaf(uint32_t x, uint32_t y, uint32_t level) {
 }
 
 void QTreeLeafNode::addCreature(const std::shared_ptr<Creature> &c) {
+	bumpCreatureRevision();
 	creature_list.push_back(c);
 
 	if (c->getPlayer()) {
@@ -86,6 +87,7 @@ void QTreeLeafNode::removeCreature(std::shared_ptr<Creature> c) {
 	}
 
 	assert(iter != creature_list.end());
+	bumpCreatureRevision();
 	*iter = creature_list.back();
 	creature_list.pop_back();
 
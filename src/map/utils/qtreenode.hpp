@@ -75,6 +75,14 @@ public:
 	void addCreature(const std::shared_ptr<Creature> &c);
 	void removeCreature(std::shared_ptr<Creature> c);
 
+	// Changes whenever a creature enters or leaves the leaf or changes floor inside it, never goes back
+	uint32_t getCreatureRevision() const {
+		return creatureRevision;
+	}
+	void bumpCreatureRevision() {
+		++creatureRevision;
+	}
+
 private:
 	static bool newLeaf;
 	QTreeLeafNode* leafS = nullptr;
@@ -84,9 +92,11 @@ private:
 
 	std::vector<std::shared_ptr<Creature>> creature_list;
 	std::vector<std::shared_ptr<Creature>> player_list;
+	uint32_t creatureRevision = 0;
 
 	friend class Map;
 	friend class MapCache;
 	friend class QTreeNode;
 	friend class Spectators;
+	friend class TargetAcquisition;
 };
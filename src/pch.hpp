@@ -25,17 +25,20 @@
 // STL Includes
 // --------------------
 
+#include <bit>
 #include <bitset>
 #include <charconv>
 #include <filesystem>
 #include <fstream>
 #include <forward_list>
+#include <latch>
 #include <list>
 #include <map>
 #include <unordered_set>
 #include <queue>
 #include <random>
 #include <ranges>
+#include <span>
 #include <algorithm>
 #include <regex>
 #include <set>
@@ -12,15 +12,50 @@
 #include "lib/di/container.hpp"
 #include "security/rsa.hpp"
 
+namespace {
+	// Integers reused by every RSA::decrypt of the same thread, so decrypting allocates nothing
+	struct DecryptScratch {
+		DecryptScratch() {
+			mpz_init2(c, 1024);
+			mpz_init2(m1, 1024);
+			mpz_init2(m2, 1024);
+			mpz_init2(h, 1024);
+		}
+
+		~DecryptScratch() {
+			mpz_clear(c);
+			mpz_clear(m1);
+			mpz_clear(m2);
+			mpz_clear(h);
+		}
+
+		DecryptScratch(const DecryptScratch &) = delete;
+		DecryptScratch &operator=(const DecryptScratch &) = delete;
+
+		mpz_t c;
+		mpz_t m1;
+		mpz_t m2;
+		mpz_t h;
+	};
+}
+
 RSA::RSA(Logger &logger) :
 	logger(logger) {
 	mpz_init(n);
-	mpz_init2(d, 1024);
+	mpz_init2(p, 512);
+	mpz_init2(q, 512);
+	mpz_init2(dP, 512);
+	mpz_init2(dQ, 512);
+	mpz_init2(qInv, 512);
 }
 
 RSA::~RSA() {
 	mpz_clear(n);
-	mpz_clear(d);
+	mpz_clear(p);
+	mpz_clear(q);
+	mpz_clear(dP);
+	mpz_clear(dQ);
+	mpz_clear(qInv);
 }
 
 RSA &RSA::getInstance() {
@@ -44,12 +79,10 @@ void RSA::start() {
 }
 
 void RSA::setKey(const char* pString, const char* qString, int base /* = 10*/) {
-	mpz_t p;
-	mpz_t q;
 	mpz_t e;
-	mpz_init2(p, 1024);
-	mpz_init2(q, 1024);
+	mpz_t d;
 	mpz_init(e);
+	mpz_init2(d, 1024);
 
 	mpz_set_str(p, pString, base);
 	mpz_set_str(q, qString, base);
@@ -77,32 +110,42 @@ void RSA::setKey(const char* pString, const char* qString, int base /* = 10*/) {
 	// d = e^-1 mod (p - 1)(q - 1)
 	mpz_invert(d, e, pq_1);
 
+	// dP = d mod (p - 1), dQ = d mod (q - 1), qInv = q^-1 mod p
+	mpz_mod(dP, d, p_1);
+	mpz_mod(dQ, d, q_1);
+	mpz_invert(qInv, q, p);
+
 	mpz_clear(p_1);
 	mpz_clear(q_1);
 	mpz_clear(pq_1);
 
-	mpz_clear(p);
-	mpz_clear(q);
 	mpz_clear(e);
+	mpz_clear(d);
 }
 
 void RSA::decrypt(char* msg) const {
-	mpz_t c;
-	mpz_t m;
-	mpz_init2(c, 1024);
-	mpz_init2(m, 1024);
+	thread_local DecryptScratch scratch;
+	auto &[c, m1, m2, h] = scratch;
 
 	mpz_import(c, 128, 1, 1, 0, 0, msg);
 
-	// m = c^d mod n
-	mpz_powm(m, c, d, n);
+	// m = c^d mod n, as two exponentiations of half the size
+	// m1 = c^dP mod p, m2 = c^dQ mod q
+	mpz_powm(m1, c, dP, p);
+	mpz_powm(m2, c, dQ, q);
 
-	size_t count = (mpz_sizeinbase(m, 2) + 7) / 8;
-	memset(msg, 0, 128 - count);
-	mpz_export(msg + (128 - count), nullptr, 1, 1, 0, 0, m);
+	// h = qInv * (m1 - m2) mod p
+	mpz_sub(h, m1, m2);
+	mpz_mul(h, h, qInv);
+	mpz_mod(h, h, p);
 
-	mpz_clear(c);
-	mpz_clear(m);
+	// m = m2 + h * q
+	mpz_mul(h, h, q);
+	mpz_add(m1, m2, h);
+
+	size_t count = (mpz_sizeinbase(m1, 2) + 7) / 8;
+	memset(msg, 0, 128 - count);
+	mpz_export(msg + (128 - count), nullptr, 1, 1, 0, 0, m1);
 }
 
 std::string RSA::base64Decrypt(const std::string &input) const {
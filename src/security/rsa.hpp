@@ -35,7 +35,12 @@ public:
 private:
 	Logger &logger;
 	mpz_t n;
-	mpz_t d;
+	// Private key in its Chinese Remainder Theorem form: dP = d mod (p - 1), dQ = d mod (q - 1), qInv = q^-1 mod p
+	mpz_t p;
+	mpz_t q;
+	mpz_t dP;
+	mpz_t dQ;
+	mpz_t qInv;
 };
 
 constexpr auto g_RSA = RSA::getInstance;
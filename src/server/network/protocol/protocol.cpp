@@ -183,6 +183,14 @@ bool Protocol::RSA_decrypt(NetworkMessage &msg) {
 		return false;
 	}
 
+	// The first message of every connection is decrypted straight from Connection::parsePacket on the network threads,
+	// a private key exponentiation per login must never hold up the game loop. Debug builds stop right there,
+	// release builds log it.
+	if (g_dispatcher().context().isGroup(TaskGroup::Serial)) {
+		g_logger().error("[Protocol::RSA_decrypt] - Decrypting on the dispatcher thread, task: {}", g_dispatcher().context().getName());
+		assert(false && "RSA decryption must not run on the dispatcher thread");
+	}
+
 	auto charData = static_cast<char*>(static_cast<void*>(msg.getBuffer()));
 	// Does not break strict aliasing
 	g_RSA().decrypt(charData + msg.getBufferPosition());
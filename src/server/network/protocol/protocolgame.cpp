@@ -455,6 +455,7 @@ void ProtocolGame::release() {
 	// dispatcher thread
 	if (player && player->client == shared_from_this()) {
 		player->client.reset();
+		g_game().updatePlayerIp(player);
 		player = nullptr;
 	}
 
@@ -655,6 +656,7 @@ void ProtocolGame::connect(const std::string &playerName, OperatingSystem_t oper
 	player->isConnecting = false;
 
 	player->client = getThis();
+	g_game().updatePlayerIp(player);
 	player->openPlayerContainers();
 	sendAddCreature(player, player->getPosition(), 0, true);
 	player->lastIP = player->getIP();
@@ -5632,7 +5634,7 @@ void ProtocolGame::sendMarketDetail(uint16_t itemId, uint8_t tier) {
 		}
 	}
 
-	auto purchase = IOMarket::getInstance().getPurchaseStatistics()[itemId][tier];
+	auto purchase = IOMarket::getInstance().getStatistics(MARKETACTION_BUY, itemId, tier);
 	if (const MarketStatistics* purchaseStatistics = &purchase; purchaseStatistics) {
 		msg.addByte(0x01);
 		msg.add<uint32_t>(purchaseStatistics->numTransactions);
@@ -5649,7 +5651,7 @@ void ProtocolGame::sendMarketDetail(uint16_t itemId, uint8_t tier) {
 		msg.addByte(0x00); // send to old protocol ?
 	}
 
-	auto sale = IOMarket::getInstance().getSaleStatistics()[itemId][tier];
+	auto sale = IOMarket::getInstance().getStatistics(MARKETACTION_SELL, itemId, tier);
 	if (const MarketStatistics* saleStatistics = &sale; saleStatistics) {
 		msg.addByte(0x01);
 		msg.add<uint32_t>(saleStatistics->numTransactions);
@@ -74,11 +74,35 @@ void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 	disconnect();
 }
 
-void ProtocolStatus::sendStatusString() {
-	auto output = OutputMessagePool::getOutputMessage();
+namespace {
+	// Status payloads are rendered at most once per CACHE_TTL milliseconds, polling them in between is a copy
+	constexpr int64_t CACHE_TTL = 1000;
+
+	struct CachedPayload {
+		std::string data;
+		int64_t expiresAt = 0;
+	};
+
+	template <typename F>
+	const std::string &getCachedPayload(CachedPayload &payload, F &&render) {
+		const int64_t now = OTSYS_TIME();
+		if (now >= payload.expiresAt) {
+			payload.data = render();
+			payload.expiresAt = now + CACHE_TTL;
+		}
+		return payload.data;
+	}
 
-	setRawMessages(true);
+	// One sendInfo block, in the bytes it takes on the wire
+	std::string renderInfoBlock(const std::function<void(NetworkMessage &)> &addBlock) {
+		static NetworkMessage msg;
+		msg.reset();
+		addBlock(msg);
+		return std::string(reinterpret_cast<const char*>(msg.getBuffer() + NetworkMessage::INITIAL_BUFFER_POSITION), msg.getLength());
+	}
+}
 
+std::string ProtocolStatus::renderStatusString() {
 	pugi::xml_document doc;
 
 	pugi::xml_node decl = doc.prepend_child(pugi::node_declaration);
@@ -104,23 +128,7 @@ void ProtocolStatus::sendStatusString() {
 	owner.append_attribute("email") = g_configManager().getString(OWNER_EMAIL, __FUNCTION__).c_str();
 
 	pugi::xml_node players = tsqp.append_child("players");
-	uint32_t real = 0;
-	std::map<uint32_t, uint32_t> listIP;
-	for (const auto &[key, player] : g_game().getPlayers()) {
-		if (player->getIP() != 0) {
-			auto ip = listIP.find(player->getIP());
-			if (ip != listIP.end()) {
-				listIP[player->getIP()]++;
-				if (listIP[player->getIP()] < 5) {
-					real++;
-				}
-			} else {
-				listIP[player->getIP()] = 1;
-				real++;
-			}
-		}
-	}
-	players.append_attribute("online") = std::to_string(real).c_str();
+	players.append_attribute("online") = std::to_string(g_game().getRealPlayersOnline()).c_str();
 	players.append_attribute("max") = std::to_string(g_configManager().getNumber(MAX_PLAYERS, __FUNCTION__)).c_str();
 	players.append_attribute("peak") = std::to_string(g_game().getPlayersRecord()).c_str();
 
@@ -151,8 +159,16 @@ void ProtocolStatus::sendStatusString() {
 
 	std::ostringstream ss;
 	doc.save(ss, "", pugi::format_raw);
+	return ss.str();
+}
 
-	std::string data = ss.str();
+void ProtocolStatus::sendStatusString() {
+	auto output = OutputMessagePool::getOutputMessage();
+
+	setRawMessages(true);
+
+	static CachedPayload statusString;
+	const auto &data = getCachedPayload(statusString, renderStatusString);
 	output->addBytes(data.c_str(), data.size());
 	send(output);
 	disconnect();
@@ -160,54 +176,76 @@ void ProtocolStatus::sendStatusString() {
 
 void ProtocolStatus::sendInfo(uint16_t requestedInfo, const std::string &characterName) {
 	auto output = OutputMessagePool::getOutputMessage();
+	const auto addCachedBlock = [&output](CachedPayload &block, const std::function<void(NetworkMessage &)> &addBlock) {
+		const auto &data = getCachedPayload(block, [&addBlock] { return renderInfoBlock(addBlock); });
+		output->addBytes(data.c_str(), data.size());
+	};
 
 	if (requestedInfo & REQUEST_BASIC_SERVER_INFO) {
-		output->addByte(0x10);
-		output->addString(g_configManager().getString(ConfigKey_t::SERVER_NAME, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(stringConfig_t::SERVER_NAME)");
-		output->addString(g_configManager().getString(IP, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(IP)");
-		output->addString(std::to_string(g_configManager().getNumber(LOGIN_PORT, __FUNCTION__)), "ProtocolStatus::sendInfo - std::to_string(g_configManager().getNumber(LOGIN_PORT))");
+		static CachedPayload basicInfo;
+		addCachedBlock(basicInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x10);
+			msg.addString(g_configManager().getString(ConfigKey_t::SERVER_NAME, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(stringConfig_t::SERVER_NAME)");
+			msg.addString(g_configManager().getString(IP, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(IP)");
+			msg.addString(std::to_string(g_configManager().getNumber(LOGIN_PORT, __FUNCTION__)), "ProtocolStatus::sendInfo - std::to_string(g_configManager().getNumber(LOGIN_PORT))");
+		});
 	}
 
 	if (requestedInfo & REQUEST_OWNER_SERVER_INFO) {
-		output->addByte(0x11);
-		output->addString(g_configManager().getString(OWNER_NAME, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(OWNER_NAME)");
-		output->addString(g_configManager().getString(OWNER_EMAIL, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(OWNER_EMAIL)");
+		static CachedPayload ownerInfo;
+		addCachedBlock(ownerInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x11);
+			msg.addString(g_configManager().getString(OWNER_NAME, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(OWNER_NAME)");
+			msg.addString(g_configManager().getString(OWNER_EMAIL, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(OWNER_EMAIL)");
+		});
 	}
 
 	if (requestedInfo & REQUEST_MISC_SERVER_INFO) {
-		output->addByte(0x12);
-		output->addString(g_configManager().getString(SERVER_MOTD, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(SERVER_MOTD)");
-		output->addString(g_configManager().getString(LOCATION, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(LOCATION)");
-		output->addString(g_configManager().getString(URL, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(URL)");
-		output->add<uint64_t>((OTSYS_TIME() - ProtocolStatus::start) / 1000);
+		static CachedPayload miscInfo;
+		addCachedBlock(miscInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x12);
+			msg.addString(g_configManager().getString(SERVER_MOTD, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(SERVER_MOTD)");
+			msg.addString(g_configManager().getString(LOCATION, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(LOCATION)");
+			msg.addString(g_configManager().getString(URL, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(URL)");
+			msg.add<uint64_t>((OTSYS_TIME() - ProtocolStatus::start) / 1000);
+		});
 	}
 
 	if (requestedInfo & REQUEST_PLAYERS_INFO) {
-		output->addByte(0x20);
-		output->add<uint32_t>(static_cast<uint32_t>(g_game().getPlayersOnline()));
-		output->add<uint32_t>(g_configManager().getNumber(MAX_PLAYERS, __FUNCTION__));
-		output->add<uint32_t>(g_game().getPlayersRecord());
+		static CachedPayload playersInfo;
+		addCachedBlock(playersInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x20);
+			msg.add<uint32_t>(static_cast<uint32_t>(g_game().getPlayersOnline()));
+			msg.add<uint32_t>(g_configManager().getNumber(MAX_PLAYERS, __FUNCTION__));
+			msg.add<uint32_t>(g_game().getPlayersRecord());
+		});
 	}
 
 	if (requestedInfo & REQUEST_MAP_INFO) {
-		output->addByte(0x30);
-		output->addString(g_configManager().getString(MAP_NAME, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(MAP_NAME)");
-		output->addString(g_configManager().getString(MAP_AUTHOR, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(MAP_AUTHOR)");
-		uint32_t mapWidth, mapHeight;
-		g_game().getMapDimensions(mapWidth, mapHeight);
-		output->add<uint16_t>(mapWidth);
-		output->add<uint16_t>(mapHeight);
+		static CachedPayload mapInfo;
+		addCachedBlock(mapInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x30);
+			msg.addString(g_configManager().getString(MAP_NAME, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(MAP_NAME)");
+			msg.addString(g_configManager().getString(MAP_AUTHOR, __FUNCTION__), "ProtocolStatus::sendInfo - g_configManager().getString(MAP_AUTHOR)");
+			uint32_t mapWidth, mapHeight;
+			g_game().getMapDimensions(mapWidth, mapHeight);
+			msg.add<uint16_t>(mapWidth);
+			msg.add<uint16_t>(mapHeight);
+		});
 	}
 
 	if (requestedInfo & REQUEST_EXT_PLAYERS_INFO) {
-		output->addByte(0x21); // players info - online players list
-
-		const auto players = g_game().getPlayers();
-		output->add<uint32_t>(players.size());
-		for (const auto &it : players) {
-			output->addString(it.second->getName(), "ProtocolStatus::sendInfo - it.second->getName()");
-			output->add<uint32_t>(it.second->getLevel());
-		}
+		static CachedPayload extPlayersInfo;
+		addCachedBlock(extPlayersInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x21); // players info - online players list
+
+			const auto &players = g_game().getPlayers();
+			msg.add<uint32_t>(players.size());
+			for (const auto &it : players) {
+				msg.addString(it.second->getName(), "ProtocolStatus::sendInfo - it.second->getName()");
+				msg.add<uint32_t>(it.second->getLevel());
+			}
+		});
 	}
 
 	if (requestedInfo & REQUEST_PLAYER_STATUS_INFO) {
@@ -220,10 +258,13 @@ void ProtocolStatus::sendInfo(uint16_t requestedInfo, const std::string &charact
 	}
 
 	if (requestedInfo & REQUEST_SERVER_SOFTWARE_INFO) {
-		output->addByte(0x23); // server software info
-		output->addString(ProtocolStatus::SERVER_NAME, "ProtocolStatus::sendInfo - ProtocolStatus::SERVER_NAME");
-		output->addString(ProtocolStatus::SERVER_VERSION, "ProtocolStatus::sendInfo - ProtocolStatus::SERVER_VERSION)");
-		output->addString(fmt::format("{}.{}", CLIENT_VERSION_UPPER, CLIENT_VERSION_LOWER), "ProtocolStatus::sendInfo - fmt::format(CLIENT_VERSION_UPPER, CLIENT_VERSION_LOWER)");
+		static CachedPayload softwareInfo;
+		addCachedBlock(softwareInfo, [](NetworkMessage &msg) {
+			msg.addByte(0x23); // server software info
+			msg.addString(ProtocolStatus::SERVER_NAME, "ProtocolStatus::sendInfo - ProtocolStatus::SERVER_NAME");
+			msg.addString(ProtocolStatus::SERVER_VERSION, "ProtocolStatus::sendInfo - ProtocolStatus::SERVER_VERSION)");
+			msg.addString(fmt::format("{}.{}", CLIENT_VERSION_UPPER, CLIENT_VERSION_LOWER), "ProtocolStatus::sendInfo - fmt::format(CLIENT_VERSION_UPPER, CLIENT_VERSION_LOWER)");
+		});
 	}
 	send(output);
 	disconnect();
@@ -37,5 +37,7 @@ public:
 	static std::string SERVER_DEVELOPERS;
 
 private:
+	static std::string renderStatusString();
+
 	static std::map<uint32_t, int64_t> ipConnectMap;
 };
@@ -0,0 +1,49 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+/**
+ * Lends a T kept between uses, so a hot path does not allocate its working buffers every time.
+ * A use started while another one is still running on the same thread (a script reacting to a
+ * cast, for instance) gets the next T of a per-thread stack. The lent T is cleared on release.
+ */
+template <typename T>
+class ScratchBuffer {
+public:
+	ScratchBuffer() {
+		if (depth == pool.size()) {
+			pool.emplace_back(std::make_unique<T>());
+		}
+		buffer = pool[depth++].get();
+	}
+	~ScratchBuffer() {
+		buffer->clear();
+		--depth;
+	}
+
+	ScratchBuffer(const ScratchBuffer &) = delete;
+	ScratchBuffer &operator=(const ScratchBuffer &) = delete;
+
+	T &operator*() const {
+		return *buffer;
+	}
+	T* operator->() const {
+		return buffer;
+	}
+
+private:
+	inline static thread_local std::vector<std::unique_ptr<T>> pool;
+	inline static thread_local size_t depth = 0;
+
+	T* buffer;
+};
@@ -0,0 +1,58 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "config/configmanager.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	std::string writeConfig(std::string_view content) {
+		// Unique per run, so concurrent runs do not overwrite each other's config
+		static const auto path = (std::filesystem::temp_directory_path() / fmt::format("canary_config_test_{}.lua", std::random_device {}())).string();
+		std::ofstream(path, std::ios::trunc) << content;
+		return path;
+	}
+}
+
+suite<"config"> configManagerBenchmark = [] {
+	test("ConfigManager snapshot read vs hash map read") = [] {
+		constexpr size_t reads = 10000000;
+		ConfigManager config;
+		config.setConfigFileLua(writeConfig(R"(kickIdlePlayerAfterMinutes = 15)"));
+		expect(config.load());
+
+		phmap::flat_hash_map<ConfigKey_t, ConfigValue> configs;
+		for (auto key : magic_enum::enum_values<ConfigKey_t>()) {
+			configs[key] = static_cast<int32_t>(key);
+		}
+
+		int64_t hashedSum = 0;
+		Benchmark hashedBench;
+		for (size_t i = 0; i < reads; ++i) {
+			const auto key = static_cast<ConfigKey_t>(i % configs.size());
+			if (configs.contains(key) && std::holds_alternative<int32_t>(configs.at(key))) {
+				hashedSum += std::get<int32_t>(configs.at(key));
+			}
+		}
+		const auto hashedDuration = hashedBench.duration();
+
+		int64_t snapshotSum = 0;
+		Benchmark snapshotBench;
+		for (size_t i = 0; i < reads; ++i) {
+			snapshotSum += config.getNumber(KICK_AFTER_MINUTES, __FUNCTION__);
+		}
+		const auto snapshotDuration = snapshotBench.duration();
+
+		expect(hashedSum > 0 && snapshotSum > 0);
+		log << fmt::format("{} config reads: hash map {} ms, snapshot {} ms\n", reads, hashedDuration, snapshotDuration);
+	};
+};
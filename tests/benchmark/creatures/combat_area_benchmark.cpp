@@ -0,0 +1,62 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/combat/combat.hpp"
+
+using namespace boost::ut;
+
+suite<"creatures"> combatAreaBenchmark = [] {
+	test("Area cells of 1M radius 7 casts, matrix walk vs compiled offsets") = [] {
+		constexpr size_t casts = 1000000;
+		AreaCombat area;
+		area.setupArea(7);
+
+		// The rotated areas are stored in a square twice the size of the spell matrix
+		const auto &offsets = area.getOffsets(DIRECTION_SOUTH);
+		MatrixArea matrix(26, 26);
+		matrix.setCenter(13, 13);
+		for (const auto &offset : offsets) {
+			matrix.setValue(13 + offset.y, 13 + offset.x, true);
+		}
+
+		const Position target(1000, 1000, 7);
+		uint64_t walked = 0;
+		Benchmark walkBench;
+		for (size_t cast = 0; cast < casts; ++cast) {
+			Position tilePos(target.x - 13, target.y - 13, target.z);
+			for (uint32_t y = 0; y < matrix.getRows(); ++y) {
+				for (uint32_t x = 0; x < matrix.getCols(); ++x) {
+					if (matrix.getValue(y, x)) {
+						walked += tilePos.x + tilePos.y;
+					}
+					tilePos.x++;
+				}
+				tilePos.x -= matrix.getCols();
+				tilePos.y++;
+			}
+		}
+		const auto walkDuration = walkBench.duration();
+
+		uint64_t compiled = 0;
+		Benchmark compiledBench;
+		for (size_t cast = 0; cast < casts; ++cast) {
+			for (const auto &offset : offsets) {
+				const Position tilePos(target.x + offset.x, target.y + offset.y, target.z);
+				compiled += tilePos.x + tilePos.y;
+			}
+		}
+		const auto compiledDuration = compiledBench.duration();
+
+		expect(eq(walked, compiled));
+		log << fmt::format("{} radius 7 casts ({} cells): matrix walk {} ms, compiled offsets {} ms\n", casts, offsets.size(), walkDuration, compiledDuration);
+	};
+};
@@ -0,0 +1,65 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/combat/condition_list.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	std::shared_ptr<Condition> createGenericCondition(ConditionType_t type, int32_t ticks, uint32_t subId = 0) {
+		auto condition = std::make_shared<ConditionGeneric>(CONDITIONID_COMBAT, type, ticks, false, subId);
+		condition->setTicks(ticks);
+		return condition;
+	}
+}
+
+suite<"creatures"> conditionListBenchmark = [] {
+	test("ConditionList due scan with 10k creatures") = [] {
+		constexpr size_t creatureCount = 10000;
+		constexpr ConditionType_t types[] = { CONDITION_HASTE, CONDITION_ATTRIBUTES, CONDITION_OUTFIT, CONDITION_MUTED, CONDITION_SPELLCOOLDOWN, CONDITION_SPELLGROUPCOOLDOWN, CONDITION_INFIGHT, CONDITION_LIGHT, CONDITION_MANASHIELD, CONDITION_DRUNK };
+
+		std::vector<ConditionList> creatures(creatureCount);
+		for (size_t i = 0; i < creatureCount; ++i) {
+			const size_t conditionCount = 5 + (i % 6);
+			for (size_t n = 0; n < conditionCount; ++n) {
+				creatures[i].push_back(createGenericCondition(types[n], 60000 + static_cast<int32_t>(i % 1000) * 60, static_cast<uint32_t>(n)));
+			}
+		}
+
+		constexpr int thinkTicks = 60;
+		constexpr int64_t thinkInterval = 1000;
+		const int64_t timeNow = OTSYS_TIME();
+		std::vector<std::shared_ptr<Condition>> due;
+		size_t dueCount = 0;
+		size_t hasTypeCount = 0;
+
+		Benchmark bm;
+		for (int tick = 0; tick < thinkTicks; ++tick) {
+			const int64_t thinkTime = timeNow + tick * thinkInterval;
+			for (const auto &conditions : creatures) {
+				hasTypeCount += conditions.hasType(CONDITION_POISON) ? 1 : 0;
+				if (!conditions.isDue(thinkTime)) {
+					continue;
+				}
+
+				due.clear();
+				conditions.collectDue(thinkTime, due);
+				dueCount += due.size();
+			}
+		}
+		const double ms = bm.duration();
+
+		expect(eq(dueCount, 0u));
+		expect(eq(hasTypeCount, 0u));
+		log << fmt::format("{} creatures, {} think ticks in {:.2f} ms ({:.3f} us per creature think)", creatureCount, thinkTicks, ms, (ms * 1000.0) / (creatureCount * thinkTicks));
+	};
+};
@@ -0,0 +1,97 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/players/inventory/inventory_item_index.hpp"
+#include "items/containers/container.hpp"
+#include "items/item_type_fixture.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr uint16_t backpackId = 1;
+	constexpr uint16_t coinId = 2;
+	constexpr uint16_t swordId = 4;
+	constexpr size_t slotCount = CONST_SLOT_LAST - CONST_SLOT_FIRST + 1;
+
+	using Inventory = std::array<std::shared_ptr<Item>, slotCount>;
+
+	// Backpack with itemsPerLevel coins and swords per level, nested depth times
+	std::shared_ptr<Container> createBackpackTree(size_t depth, size_t itemsPerLevel) {
+		auto root = Container::create(backpackId, static_cast<uint16_t>(itemsPerLevel * 2 + 1));
+		auto current = root;
+		for (size_t level = 0; level < depth; ++level) {
+			for (size_t i = 0; i < itemsPerLevel; ++i) {
+				current->internalAddThing(Item::CreateItem(coinId, 100));
+				current->internalAddThing(Item::CreateItem(swordId));
+			}
+
+			auto next = Container::create(backpackId, static_cast<uint16_t>(itemsPerLevel * 2 + 1));
+			current->internalAddThing(next);
+			current = next;
+		}
+		return root;
+	}
+
+	uint32_t countByWalking(const Inventory &inventory, uint16_t itemId) {
+		uint32_t count = 0;
+		for (const auto &item : inventory) {
+			if (!item) {
+				continue;
+			}
+
+			if (item->getID() == itemId) {
+				count += Item::countByType(item, -1);
+			}
+
+			if (const auto &container = item->getContainer()) {
+				for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
+					if ((*it)->getID() == itemId) {
+						count += Item::countByType(*it, -1);
+					}
+				}
+			}
+		}
+		return count;
+	}
+}
+
+suite<"creatures"> inventoryItemIndexBenchmark = [] {
+	registerItemType(backpackId);
+	registerItemType(swordId);
+	registerItemType(coinId).stackable = true;
+
+	test("InventoryItemIndex query vs walk with deep backpack trees") = [] {
+		constexpr size_t queries = 10000;
+		Inventory inventory;
+		inventory[CONST_SLOT_BACKPACK - CONST_SLOT_FIRST] = createBackpackTree(20, 6);
+		inventory[CONST_SLOT_AMMO - CONST_SLOT_FIRST] = createBackpackTree(10, 6);
+
+		uint64_t walked = 0;
+		Benchmark walkBench;
+		for (size_t i = 0; i < queries; ++i) {
+			walked += countByWalking(inventory, coinId);
+		}
+		const auto walkDuration = walkBench.duration();
+
+		uint64_t indexed = 0;
+		InventoryItemIndex index;
+		Benchmark indexBench;
+		index.rebuild(inventory);
+		for (size_t i = 0; i < queries; ++i) {
+			indexed += index.getItemCount(coinId);
+		}
+		const auto indexDuration = indexBench.duration();
+
+		expect(eq(walked, indexed));
+		log << fmt::format("{} item count queries over 30 nested backpacks: walk {} ms, index {} ms\n", queries, walkDuration, indexDuration);
+	};
+};
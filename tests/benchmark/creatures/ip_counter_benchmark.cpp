@@ -0,0 +1,56 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/players/management/ip_counter.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	// The count the status document used to build by walking every online player
+	uint32_t countRealPlayers(const std::map<uint32_t, uint32_t> &ipByPlayer) {
+		uint32_t real = 0;
+		std::map<uint32_t, uint32_t> listIP;
+		for (const auto &[playerId, ip] : ipByPlayer) {
+			if (ip != 0 && ++listIP[ip] <= PlayerIpCounter::MAX_PLAYERS_PER_IP) {
+				++real;
+			}
+		}
+		return real;
+	}
+}
+
+suite<"creatures"> ipCounterBenchmark = [] {
+	test("PlayerIpCounter status requests vs walking every online player") = [] {
+		std::mt19937 rng(45);
+		std::uniform_int_distribution<uint32_t> playerId(1, 3000);
+		std::uniform_int_distribution<uint32_t> ip(0, 800);
+
+		PlayerIpCounter counter;
+		std::map<uint32_t, uint32_t> ipByPlayer;
+		for (int i = 0; i < 20000; ++i) {
+			const auto id = playerId(rng);
+			const auto newIp = i % 3 == 0 ? 0 : ip(rng);
+			counter.setPlayerIp(id, newIp);
+			ipByPlayer[id] = newIp;
+		}
+
+		Benchmark bm;
+		uint32_t walked = 0;
+		for (int i = 0; i < 100; ++i) {
+			walked = countRealPlayers(ipByPlayer);
+		}
+		const auto walkDuration = bm.duration();
+		expect(eq(counter.getRealPlayers(), walked));
+
+		log << fmt::format("{} online players: 100 status requests took {} ms walking every player, the counter answers each in O(1)\n", ipByPlayer.size(), walkDuration);
+	};
+};
@@ -0,0 +1,57 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/monsters/loot_table.hpp"
+#include "items/item.hpp"
+#include "items/item_type_fixture.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr uint16_t goldId = 21;
+	constexpr uint16_t swordId = 22;
+
+	LootBlock lootBlock(uint16_t id, uint32_t chance, uint32_t countMin, uint32_t countMax) {
+		LootBlock block;
+		block.id = id;
+		block.chance = chance;
+		block.countmin = countMin;
+		block.countmax = countMax;
+		return block;
+	}
+}
+
+suite<"creatures"> lootTableBenchmark = [] {
+	registerItemType(swordId);
+	registerItemType(goldId).stackable = true;
+
+	test("LootTable rolls for 100k kills of a 30 item monster") = [] {
+		constexpr size_t kills = 100000;
+		LootTable table;
+		for (uint32_t i = 0; i < 30; ++i) {
+			table.add(lootBlock(i % 2 == 0 ? goldId : swordId, 100 + i * 1000, 1, 10));
+		}
+
+		size_t dropped = 0;
+		std::vector<LootTable::Drop> drops;
+		Benchmark rollBench;
+		for (size_t kill = 0; kill < kills; ++kill) {
+			drops.clear();
+			table.roll(100, 100, drops);
+			dropped += drops.size();
+		}
+		const auto rollDuration = rollBench.duration();
+
+		expect(dropped > 0u);
+		log << fmt::format("{} loot rolls of 30 items: {} ms, {} drops\n", kills, rollDuration, dropped);
+	};
+};
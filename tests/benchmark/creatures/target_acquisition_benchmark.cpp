@@ -0,0 +1,209 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/creature.hpp"
+#include "creatures/monsters/target_acquisition.hpp"
+#include "game/game.hpp"
+#include "items/tile.hpp"
+#include "map/map.hpp"
+#include "map/spectators.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	// Range test of Spectators::find, shifted by the floor difference like the leaf scan does
+	bool inRange(const Position &center, const Position &pos, int32_t rangeX, int32_t rangeY) {
+		const int32_t offsetZ = Position::getOffsetZ(center, pos);
+		return pos.x >= center.x - rangeX + offsetZ && pos.x <= center.x + rangeX + offsetZ
+			&& pos.y >= center.y - rangeY + offsetZ && pos.y <= center.y + rangeY + offsetZ;
+	}
+
+	class WalkerCreature final : public Creature {
+	public:
+		const std::string &getName() const override {
+			return name;
+		}
+		const std::string &getTypeName() const override {
+			return name;
+		}
+		const std::string &getNameDescription() const override {
+			return name;
+		}
+		std::string getDescription(int32_t) override {
+			return name;
+		}
+		CreatureType_t getType() const override {
+			return CREATURETYPE_MONSTER;
+		}
+		void setID() override { }
+		void addList() override { }
+		void removeList() override { }
+
+	private:
+		std::string name = "walker";
+	};
+
+	// Same leaf and tile bookkeeping as Map::placeCreature and Map::moveCreature, without the client updates
+	void place(const std::shared_ptr<Creature> &creature, const Position &pos) {
+		auto &map = g_game().map;
+		auto tile = map.getTile(pos);
+		if (!tile) {
+			tile = std::make_shared<DynamicTile>(pos.x, pos.y, pos.z);
+			map.setTile(pos, tile);
+		}
+		creature->setParent(tile);
+		map.getQTNode(pos.x, pos.y)->addCreature(creature);
+	}
+
+	void unplace(const std::shared_ptr<Creature> &creature) {
+		const auto &pos = creature->getPosition();
+		g_game().map.getQTNode(pos.x, pos.y)->removeCreature(creature);
+	}
+
+	void step(const std::shared_ptr<Creature> &creature, std::mt19937 &rng, const Position &origin, int32_t size) {
+		std::uniform_int_distribution<int32_t> offset(-1, 1);
+		const auto &pos = creature->getPosition();
+		const Position next(
+			static_cast<uint16_t>(std::clamp<int32_t>(pos.x + offset(rng), origin.x, origin.x + size - 1)),
+			static_cast<uint16_t>(std::clamp<int32_t>(pos.y + offset(rng), origin.y, origin.y + size - 1)),
+			pos.z
+		);
+		unplace(creature);
+		place(creature, next);
+		// Every tile creature change drops the spectators cache
+		Spectators::clearCache();
+	}
+
+	std::vector<Position> spreadPositions(std::mt19937 &rng, const Position &origin, size_t count, int32_t size) {
+		std::uniform_int_distribution<int32_t> offset(0, size - 1);
+		std::vector<Position> positions;
+		positions.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			positions.emplace_back(origin.x + offset(rng), origin.y + offset(rng), origin.z);
+		}
+		return positions;
+	}
+}
+
+suite<"creatures"> targetAcquisitionBenchmark = [] {
+	test("TargetAcquisition per monster vs per sector queries with 300 monsters and 50 players") = [] {
+		constexpr size_t ticks = 100;
+		std::mt19937 rng(39);
+		const Position spawn(1000, 1000, 7);
+		const auto monsters = spreadPositions(rng, spawn, 300, 48);
+		const auto players = spreadPositions(rng, spawn, 50, 48);
+
+		std::vector<Position> creatures = monsters;
+		creatures.insert(creatures.end(), players.begin(), players.end());
+
+		// Each monster scans the creatures of its own view, then keeps the ones it can see
+		uint64_t perMonster = 0;
+		Benchmark monsterBench;
+		for (size_t tick = 0; tick < ticks; ++tick) {
+			for (const auto &monsterPos : monsters) {
+				for (const auto &pos : creatures) {
+					if (inRange(monsterPos, pos, MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y) && Creature::canSee(monsterPos, pos, MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y)) {
+						++perMonster;
+					}
+				}
+			}
+		}
+		const auto monsterDuration = monsterBench.duration();
+
+		// One scan per sector each tick, every monster only filters the candidates of its sector
+		uint64_t perSector = 0;
+		std::unordered_map<uint64_t, std::vector<Position>> sectors;
+		Benchmark sectorBench;
+		for (size_t tick = 0; tick < ticks; ++tick) {
+			for (auto &[key, candidates] : sectors) {
+				candidates.clear();
+			}
+			for (const auto &monsterPos : monsters) {
+				auto &candidates = sectors[TargetAcquisition::getSectorKey(monsterPos)];
+				if (candidates.empty()) {
+					const auto center = TargetAcquisition::getSectorCenter(monsterPos);
+					for (const auto &pos : creatures) {
+						if (inRange(center, pos, TargetAcquisition::SECTOR_RANGE_X, TargetAcquisition::SECTOR_RANGE_Y)) {
+							candidates.push_back(pos);
+						}
+					}
+				}
+				for (const auto &pos : candidates) {
+					if (Creature::canSee(monsterPos, pos, MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y)) {
+						++perSector;
+					}
+				}
+			}
+		}
+		const auto sectorDuration = sectorBench.duration();
+
+		expect(eq(perMonster, perSector));
+		log << fmt::format("{} ticks of 300 monsters and 50 players: per monster queries {} ms, per sector queries {} ms ({} sectors)\n", ticks, monsterDuration, sectorDuration, sectors.size());
+	};
+
+	test("TargetAcquisition per monster vs per sector queries on the map with a quarter of 350 creatures stepping each tick") = [] {
+		constexpr size_t ticks = 100;
+		constexpr int32_t size = 48;
+		std::mt19937 rng(39);
+		const Position spawn(3000, 3000, 7);
+
+		std::vector<std::shared_ptr<Creature>> creatures;
+		for (const auto &pos : spreadPositions(rng, spawn, 350, size)) {
+			const auto creature = std::make_shared<WalkerCreature>();
+			place(creature, pos);
+			creatures.push_back(creature);
+		}
+		// The first 300 look for targets, the others only walk around like players would
+		const std::span<const std::shared_ptr<Creature>> monsters(creatures.data(), 300);
+
+		uint64_t perMonster = 0;
+		uint64_t perSector = 0;
+		Benchmark monsterBench;
+		Benchmark sectorBench;
+		monsterBench.reset();
+		sectorBench.reset();
+		for (size_t tick = 0; tick < ticks; ++tick) {
+			for (size_t i = tick % 4; i < creatures.size(); i += 4) {
+				step(creatures[i], rng, spawn, size);
+			}
+
+			monsterBench.start();
+			for (const auto &monster : monsters) {
+				const auto &monsterPos = monster->getPosition();
+				for (const auto &creature : Spectators().find<Creature>(monsterPos, true)) {
+					if (creature != monster && Creature::canSee(monsterPos, creature->getPosition(), MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y)) {
+						++perMonster;
+					}
+				}
+			}
+			monsterBench.end();
+
+			sectorBench.start();
+			for (const auto &monster : monsters) {
+				const auto &monsterPos = monster->getPosition();
+				for (const auto candidate : TargetAcquisition::getCandidates(monsterPos)) {
+					if (candidate != monster.get() && Creature::canSee(monsterPos, candidate->getPosition(), MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y)) {
+						++perSector;
+					}
+				}
+			}
+			sectorBench.end();
+		}
+
+		for (const auto &creature : creatures) {
+			unplace(creature);
+		}
+
+		expect(eq(perMonster, perSector));
+		log << fmt::format("{} ticks of 300 monsters among 350 stepping creatures: per monster queries {:.2f} ms, per sector queries {:.2f} ms\n", ticks, monsterBench.avg() * ticks, sectorBench.avg() * ticks);
+	};
+};
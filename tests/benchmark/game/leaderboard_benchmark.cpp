@@ -0,0 +1,67 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "game/highscores/leaderboard.hpp"
+
+using namespace boost::ut;
+
+suite<"game"> leaderboardBenchmark = [] {
+	test("Leaderboard answers our rank and a page over 500k characters without a full scan") = [] {
+		constexpr uint32_t characterCount = 500000;
+		constexpr size_t updateCount = 100000;
+		constexpr uint8_t entriesPerPage = 20;
+		std::mt19937 rng(48);
+		std::uniform_int_distribution<uint64_t> points(0, 1000000000);
+		std::uniform_int_distribution<uint32_t> guids(1, characterCount);
+
+		std::vector<Leaderboard::Entry> entries;
+		entries.reserve(characterCount);
+		for (uint32_t guid = 1; guid <= characterCount; ++guid) {
+			entries.push_back({ points(rng), guid, static_cast<uint8_t>(guid % 5) });
+		}
+
+		Leaderboard board;
+		Benchmark bm_assign;
+		board.assign(entries);
+		const auto assignDuration = bm_assign.duration();
+
+		Benchmark bm_update;
+		for (size_t i = 0; i < updateCount; ++i) {
+			auto &entry = entries[guids(rng) - 1];
+			expect(board.erase(entry));
+			entry.points += points(rng) % 1000;
+			board.insert(entry);
+		}
+		const auto updateDuration = bm_update.duration();
+
+		Benchmark bm_query;
+		size_t served = 0;
+		for (size_t i = 0; i < updateCount; ++i) {
+			const auto &entry = entries[guids(rng) - 1];
+			const auto position = board.getPosition(entry, entry.group);
+			const auto page = board.getRange(*position / entriesPerPage * entriesPerPage, entriesPerPage, entry.group);
+			served += page.size();
+		}
+		const auto queryDuration = bm_query.duration();
+
+		expect(eq(board.size(), static_cast<size_t>(characterCount)));
+		expect(eq(served, updateCount * entriesPerPage));
+
+		std::sort(entries.begin(), entries.end());
+		const auto top = board.getRange(0, entriesPerPage);
+		for (size_t i = 0; i < top.size(); ++i) {
+			expect(eq(top[i].guid, entries[i].guid));
+		}
+
+		log << fmt::format("{} characters in {} blocks: assign {} ms, {} updates {} ms, {} our rank pages {} ms\n", characterCount, board.getBlockCount(), assignDuration, updateCount, updateDuration, updateCount, queryDuration);
+	};
+};
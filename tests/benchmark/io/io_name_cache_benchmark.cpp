@@ -0,0 +1,55 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "io/io_name_cache.hpp"
+
+using namespace boost::ut;
+
+suite<"io"> ioNameCacheBenchmark = [] {
+	test("NameIdMap serving the access lists of 5000 houses") = [] {
+		constexpr size_t houseCount = 5000;
+		constexpr size_t namesPerHouse = 6;
+		constexpr uint32_t playerCount = 12000;
+		std::mt19937 rng(42);
+		std::uniform_int_distribution<uint32_t> guid(1, playerCount);
+
+		std::vector<std::vector<std::string>> accessLists(houseCount);
+		for (auto &accessList : accessLists) {
+			for (size_t i = 0; i < namesPerHouse; ++i) {
+				accessList.push_back(fmt::format("player {}", guid(rng)));
+			}
+		}
+
+		// Every name is queried once, the first time it is seen, then served from the map
+		NameIdMap map(IONameCache::CAPACITY);
+		Benchmark bm;
+		size_t missing = 0;
+		for (const auto &accessList : accessLists) {
+			for (const auto &name : accessList) {
+				if (!map.getId(name, 0)) {
+					++missing;
+					map.set(static_cast<uint32_t>(std::stoul(name.substr(7))), name, 0);
+				}
+			}
+		}
+		const auto duration = bm.duration();
+
+		const size_t lookups = houseCount * namesPerHouse;
+		const size_t queries = (missing + IONameCache::QUERY_CHUNK_SIZE - 1) / IONameCache::QUERY_CHUNK_SIZE;
+		expect(eq(map.size(), missing));
+		expect(missing < lookups);
+		expect(map.getHitRate() > 0.5);
+
+		log << fmt::format("{} access list names looked up in {} ms, hit rate {:.1f}%\n", lookups, duration, map.getHitRate() * 100);
+		log << fmt::format("{} distinct names resolved with about {} bulk queries, instead of {} single name queries\n", missing, queries, lookups);
+	};
+};
@@ -0,0 +1,62 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "io/market_order_book.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	MarketOrderBook::Offer offer(uint32_t id, uint32_t playerId, MarketAction_t type, uint16_t itemId, uint64_t price, uint32_t created = 1000) {
+		MarketOrderBook::Offer result;
+		result.id = id;
+		result.playerId = playerId;
+		result.type = type;
+		result.itemId = itemId;
+		result.price = price;
+		result.amount = 10;
+		result.created = created;
+		result.playerName = fmt::format("Player {}", playerId);
+		return result;
+	}
+}
+
+suite<"io"> marketOrderBookBenchmark = [] {
+	test("MarketOrderBook browsing 100000 offers") = [] {
+		constexpr uint32_t offerCount = 100000;
+		constexpr uint16_t itemCount = 2000;
+		std::mt19937 rng(46);
+		std::uniform_int_distribution<uint16_t> itemId(1, itemCount);
+		std::uniform_int_distribution<uint64_t> price(1, 1000000);
+		std::uniform_int_distribution<uint32_t> playerId(1, 20000);
+
+		MarketOrderBook book;
+		Benchmark loadBench;
+		for (uint32_t id = 1; id <= offerCount; ++id) {
+			book.add(offer(id, playerId(rng), id % 2 == 0 ? MARKETACTION_BUY : MARKETACTION_SELL, itemId(rng), price(rng), id));
+		}
+		const auto loadDuration = loadBench.duration();
+
+		Benchmark browseBench;
+		size_t browsed = 0;
+		for (uint16_t id = 1; id <= itemCount; ++id) {
+			const auto sellOffers = book.getOffers(MARKETACTION_SELL, id, 0);
+			expect(std::ranges::is_sorted(sellOffers, {}, &MarketOrderBook::Offer::price));
+			browsed += sellOffers.size() + book.getOffers(MARKETACTION_BUY, id, 0).size();
+		}
+		const auto browseDuration = browseBench.duration();
+
+		expect(eq(browsed, static_cast<size_t>(offerCount)));
+		expect(eq(book.takeExpired(offerCount / 2).size(), static_cast<size_t>(offerCount / 2)));
+
+		log << fmt::format("{} offers loaded in {} ms, every item browsed in {} ms without a query\n", offerCount, loadDuration, browseDuration);
+	};
+};
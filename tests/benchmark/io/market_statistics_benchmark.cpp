@@ -0,0 +1,47 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "io/market_statistics.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr time_t day = MarketStatisticsLedger::DAY_SECONDS;
+	constexpr time_t now = 1700000000;
+}
+
+suite<"io"> marketStatisticsBenchmark = [] {
+	test("MarketStatisticsLedger summing 200000 transactions over 30 days") = [] {
+		constexpr size_t transactionCount = 200000;
+		std::mt19937 rng(47);
+		std::uniform_int_distribution<uint16_t> itemId(1, 3000);
+		std::uniform_int_distribution<uint64_t> price(1, 1000000);
+		std::uniform_int_distribution<time_t> age(0, 30 * day);
+
+		MarketStatisticsLedger ledger;
+		Benchmark bm;
+		for (size_t i = 0; i < transactionCount; ++i) {
+			ledger.addTransaction(now - age(rng), MARKETACTION_BUY, itemId(rng), 0, price(rng));
+		}
+		const auto duration = bm.duration();
+
+		uint64_t summed = 0;
+		for (const auto &[id, tiers] : ledger.getPurchaseStatistics()) {
+			for (const auto &[tier, statistics] : tiers) {
+				summed += statistics.numTransactions;
+			}
+		}
+		expect(eq(summed, static_cast<uint64_t>(transactionCount)));
+
+		log << fmt::format("{} transactions summed in {} ms over {} days, no history scan\n", transactionCount, duration, ledger.getDayCount());
+	};
+};
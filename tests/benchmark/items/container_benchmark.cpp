@@ -0,0 +1,77 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/containers/container.hpp"
+#include "items/item_type_fixture.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr uint16_t bagId = 11;
+	constexpr uint16_t arrowId = 12;
+	constexpr uint16_t ropeId = 13;
+
+	// Returns the deepest container of a chain of depth nested bags
+	std::shared_ptr<Container> createNestedBags(const std::shared_ptr<Container> &root, size_t depth) {
+		auto current = root;
+		for (size_t level = 0; level < depth; ++level) {
+			auto next = Container::create(bagId, 20);
+			current->internalAddThing(Item::CreateItem(ropeId));
+			current->internalAddThing(next);
+			current = next;
+		}
+		return current;
+	}
+
+	uint32_t countByWalking(const std::shared_ptr<Container> &container) {
+		uint32_t counter = 0;
+		for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
+			++counter;
+		}
+		return counter;
+	}
+}
+
+suite<"items"> containerBenchmark = [] {
+	registerItemType(ropeId);
+	registerItemType(arrowId).stackable = true;
+	registerItemType(bagId).group = ITEM_GROUP_CONTAINER;
+
+	test("Container item move throughput with 20 level nesting") = [] {
+		constexpr size_t moves = 20000;
+		auto root = Container::create(bagId, 20);
+		auto deepest = createNestedBags(root, 20);
+		auto arrows = Item::CreateItem(arrowId, 100);
+
+		uint64_t walked = 0;
+		Benchmark walkBench;
+		for (size_t i = 0; i < moves; ++i) {
+			deepest->internalAddThing(arrows);
+			walked += countByWalking(root);
+			deepest->removeItem(arrows);
+		}
+		const auto walkDuration = walkBench.duration();
+
+		uint64_t cached = 0;
+		Benchmark cachedBench;
+		for (size_t i = 0; i < moves; ++i) {
+			deepest->internalAddThing(arrows);
+			cached += root->getItemHoldingCount();
+			deepest->removeItem(arrows);
+		}
+		const auto cachedDuration = cachedBench.duration();
+
+		expect(eq(walked, cached));
+		expect(root->validateCachedAggregates());
+		log << fmt::format("{} item moves into a 20 level deep bag: walked count {} ms, cached count {} ms\n", moves, walkDuration, cachedDuration);
+	};
+};
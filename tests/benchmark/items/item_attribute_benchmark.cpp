@@ -0,0 +1,48 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/functions/item/attribute.hpp"
+
+using namespace boost::ut;
+
+suite<"items"> itemAttributeBenchmark = [] {
+	test("ItemAttribute memory and get/set throughput") = [] {
+		constexpr size_t itemCount = 100000;
+		constexpr size_t rounds = 20;
+		std::vector<ItemAttribute> attributes(itemCount);
+
+		Benchmark setBench;
+		for (size_t i = 0; i < itemCount; ++i) {
+			attributes[i].setAttribute(ItemAttribute_t::DECAYSTATE, 1);
+			attributes[i].setAttribute(ItemAttribute_t::DURATION, static_cast<int64_t>(i));
+			attributes[i].setAttribute(ItemAttribute_t::TIER, 2);
+			attributes[i].setAttribute(ItemAttribute_t::DESCRIPTION, "a shared description");
+		}
+		const auto setDuration = setBench.duration();
+
+		int64_t sum = 0;
+		Benchmark getBench;
+		for (size_t round = 0; round < rounds; ++round) {
+			for (const auto &attribute : attributes) {
+				if (attribute.hasAttribute(ItemAttribute_t::DURATION)) {
+					sum += attribute.getAttributeValue(ItemAttribute_t::DURATION) + attribute.getAttributeValue(ItemAttribute_t::TIER);
+				}
+			}
+		}
+		const auto getDuration = getBench.duration();
+		expect(sum > 0);
+
+		// Three integers and one interned string, the string itself is shared by every item
+		const size_t bytesPerItem = sizeof(ItemAttribute) + 3 * sizeof(int64_t) + sizeof(std::shared_ptr<const std::string>);
+		log << fmt::format("ItemAttribute: ~{} bytes per item, {} sets in {} ms, {} gets in {} ms\n", bytesPerItem, itemCount * 4, setDuration, itemCount * rounds * 2, getDuration);
+	};
+};
@@ -0,0 +1,103 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/logging/in_memory_logger.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
+#include "lua/scripts/lua_chunk_compiler.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct CacheFolders {
+		std::filesystem::path root = std::filesystem::temp_directory_path() / fmt::format("canary_lua_bytecode_cache_benchmark_{}", std::random_device {}());
+		std::filesystem::path scripts = root / "scripts";
+		std::filesystem::path cache = root / "cache";
+
+		CacheFolders() {
+			std::filesystem::create_directories(scripts);
+		}
+
+		~CacheFolders() {
+			std::filesystem::remove_all(root);
+		}
+
+		std::string write(const std::string &name, const std::string &source) const {
+			const auto path = (scripts / name).string();
+			std::ofstream(path, std::ios::trunc) << source;
+			return path;
+		}
+	};
+
+	std::string generateScript(size_t index) {
+		std::string source = fmt::format("local script = {{ id = {} }}\n", index);
+		for (size_t handler = 0; handler < 40; ++handler) {
+			source += fmt::format(
+				"function script.onUse{}(player, item, target)\n"
+				"\tlocal total = 0\n"
+				"\tfor i = 1, {} do total = total + i * {} end\n"
+				"\tif total > 100 then return {{ value = total, name = \"handler {}\" }} end\n"
+				"\treturn nil\nend\n",
+				handler, handler + 1, index, handler
+			);
+		}
+		return source;
+	}
+}
+
+suite<"lua"> luaBytecodeCacheBenchmark = [] {
+	test("LuaBytecodeCache cold versus warm compile of a datapack") = [] {
+		constexpr size_t scriptCount = 2000;
+		InMemoryLogger logger;
+		ThreadPool threadPool(logger);
+		CacheFolders folders;
+		std::vector<std::string> files;
+		files.reserve(scriptCount);
+		for (size_t i = 0; i < scriptCount; ++i) {
+			files.push_back(folders.write(fmt::format("script_{}.lua", i), generateScript(i)));
+			// Saved long before the cache, or every entry would be checked as racy
+			std::filesystem::last_write_time(files.back(), std::filesystem::last_write_time(files.back()) - std::chrono::hours(1));
+		}
+
+		LuaBytecodeCache cache;
+		Benchmark bm_uncached;
+		LuaChunkCompiler::compile(threadPool, files, &cache);
+		const auto uncachedDuration = bm_uncached.duration();
+
+		cache.setDirectory(folders.cache);
+		Benchmark bm_cold;
+		LuaChunkCompiler::compile(threadPool, files, &cache);
+		const auto coldDuration = bm_cold.duration();
+		expect(eq(cache.getMisses(), scriptCount));
+
+		// Startup and /reload scripts both compile through Scripts::loadScripts, on the thread pool
+		cache.resetCounters();
+		Benchmark bm_warm;
+		const auto chunks = LuaChunkCompiler::compile(threadPool, files, &cache);
+		const auto warmDuration = bm_warm.duration();
+		expect(eq(cache.getHits(), scriptCount));
+		expect(std::ranges::all_of(chunks, [](const LuaChunk &chunk) { return chunk.error.empty() && !chunk.bytecode.empty(); }));
+
+		// After a checkout every script has a new time, the content hashes decide
+		for (const auto &file : files) {
+			std::filesystem::last_write_time(file, std::filesystem::last_write_time(file) + std::chrono::hours(1));
+		}
+		cache.resetCounters();
+		Benchmark bm_touched;
+		LuaChunkCompiler::compile(threadPool, files, &cache);
+		const auto touchedDuration = bm_touched.duration();
+		threadPool.shutdown();
+		expect(eq(cache.getHits(), scriptCount));
+
+		log << fmt::format("{} scripts on {} threads: no cache {} ms, cold cache {} ms, warm cache {} ms, touched scripts {} ms\n", scriptCount, threadPool.getNumberOfThreads(), uncachedDuration, coldDuration, warmDuration, touchedDuration);
+	};
+};
@@ -0,0 +1,87 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lua/functions/map/position_functions.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr Position testPosition(100, 200, 7);
+	constexpr int calls = 1000000;
+
+	int getPositionByName(lua_State* L) {
+		lua_createtable(L, 0, 4);
+		LuaFunctionsLoader::setField(L, "x", testPosition.x);
+		LuaFunctionsLoader::setField(L, "y", testPosition.y);
+		LuaFunctionsLoader::setField(L, "z", testPosition.z);
+		LuaFunctionsLoader::setField(L, "stackpos", 0);
+		luaL_getmetatable(L, "Position");
+		lua_setmetatable(L, -2);
+		return 1;
+	}
+
+	int getPosition(lua_State* L) {
+		LuaFunctionsLoader::pushPosition(L, testPosition);
+		return 1;
+	}
+
+	struct LuaState {
+		lua_State* L = luaL_newstate();
+
+		LuaState() {
+			luaL_openlibs(L);
+			PositionFunctions::init(L);
+			lua_register(L, "getPositionByName", getPositionByName);
+			lua_register(L, "getPosition", getPosition);
+		}
+
+		~LuaState() {
+			LuaFunctionsLoader::clearMetatableRefs(L);
+			lua_close(L);
+		}
+
+		bool run(const std::string &script) const {
+			if (luaL_dostring(L, script.c_str()) != 0) {
+				log << fmt::format("lua error: {}\n", lua_tostring(L, -1));
+				lua_pop(L, 1);
+				return false;
+			}
+			return true;
+		}
+	};
+
+	std::string callLoop(std::string_view function) {
+		return fmt::format(R"(
+			local sum = 0
+			for i = 1, {} do
+				sum = sum + {}().z
+			end
+			assert(sum == {})
+		)",
+		                   calls, function, calls * testPosition.z);
+	}
+}
+
+suite<"lua"> luaCallBenchmark = [] {
+	test("ns per bound call, metatable by name vs cached ref") = [] {
+		LuaState lua;
+		Benchmark byNameBench;
+		expect(lua.run(callLoop("getPositionByName")));
+		const auto byNameDuration = byNameBench.duration();
+
+		Benchmark cachedBench;
+		expect(lua.run(callLoop("getPosition")));
+		const auto cachedDuration = cachedBench.duration();
+
+		log << fmt::format("bound call pushing a Position: by name {:.1f} ns, cached ref {:.1f} ns\n", byNameDuration * 1e6 / calls, cachedDuration * 1e6 / calls);
+	};
+};
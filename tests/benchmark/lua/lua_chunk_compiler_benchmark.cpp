@@ -0,0 +1,110 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/logging/in_memory_logger.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lua/scripts/lua_chunk_compiler.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct ScriptFolder {
+		std::filesystem::path dir = std::filesystem::temp_directory_path() / fmt::format("canary_lua_chunk_compiler_benchmark_{}", std::random_device {}());
+
+		ScriptFolder() {
+			std::filesystem::create_directories(dir);
+		}
+
+		~ScriptFolder() {
+			std::filesystem::remove_all(dir);
+		}
+
+		std::string write(const std::string &name, const std::string &source) const {
+			const auto path = (dir / name).string();
+			std::ofstream(path) << source;
+			return path;
+		}
+	};
+
+	// A revscript sized chunk, a table of handlers registered in a global
+	std::string generateScript(size_t index) {
+		std::string source = fmt::format("local script = {{ id = {} }}\n", index);
+		for (size_t handler = 0; handler < 40; ++handler) {
+			source += fmt::format(
+				"function script.onUse{}(player, item, target)\n"
+				"\tlocal total = 0\n"
+				"\tfor i = 1, {} do total = total + i * {} end\n"
+				"\tif total > 100 then return {{ value = total, name = \"handler {}\" }} end\n"
+				"\treturn nil\nend\n",
+				handler, handler + 1, index, handler
+			);
+		}
+		source += "loadedScripts = (loadedScripts or 0) + 1\n";
+		return source;
+	}
+
+	bool execute(lua_State* L, const LuaChunk &chunk) {
+		const auto chunkName = "@" + chunk.file;
+		if (luaL_loadbuffer(L, chunk.bytecode.data(), chunk.bytecode.size(), chunkName.c_str()) != 0 || lua_pcall(L, 0, 0, 0) != 0) {
+			lua_pop(L, 1);
+			return false;
+		}
+		return true;
+	}
+
+	lua_Integer getLoadedScripts(lua_State* L) {
+		lua_getglobal(L, "loadedScripts");
+		const auto loaded = lua_tointeger(L, -1);
+		lua_pop(L, 1);
+		return loaded;
+	}
+}
+
+suite<"lua"> luaChunkCompilerBenchmark = [] {
+	test("LuaChunkCompiler leaves only the execution of a datapack to the main state") = [] {
+		constexpr size_t scriptCount = 2000;
+		InMemoryLogger logger;
+		ThreadPool threadPool(logger);
+		ScriptFolder folder;
+		std::vector<std::string> files;
+		files.reserve(scriptCount);
+		for (size_t i = 0; i < scriptCount; ++i) {
+			files.push_back(folder.write(fmt::format("script_{}.lua", i), generateScript(i)));
+		}
+
+		lua_State* serialState = luaL_newstate();
+		Benchmark bm_serial;
+		for (const auto &file : files) {
+			if (luaL_loadfile(serialState, file.c_str()) != 0 || lua_pcall(serialState, 0, 0, 0) != 0) {
+				lua_pop(serialState, 1);
+			}
+		}
+		const auto serialDuration = bm_serial.duration();
+		expect(eq(getLoadedScripts(serialState), static_cast<lua_Integer>(scriptCount)));
+		lua_close(serialState);
+
+		lua_State* mainState = luaL_newstate();
+		Benchmark bm_parallel;
+		const auto chunks = LuaChunkCompiler::compile(threadPool, files);
+		const auto compileDuration = bm_parallel.duration();
+		Benchmark bm_execute;
+		for (const auto &chunk : chunks) {
+			execute(mainState, chunk);
+		}
+		const auto executeDuration = bm_execute.duration();
+		expect(eq(getLoadedScripts(mainState), static_cast<lua_Integer>(scriptCount)));
+		lua_close(mainState);
+		threadPool.shutdown();
+
+		log << fmt::format("{} scripts: serial load {} ms, parallel compile {} ms on {} threads + main state execution {} ms\n", scriptCount, serialDuration, compileDuration, threadPool.getNumberOfThreads(), executeDuration);
+	};
+};
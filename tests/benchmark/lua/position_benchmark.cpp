@@ -0,0 +1,82 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lua/functions/map/position_functions.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr Position testPosition(32369, 32241, 7);
+
+	int getPosition(lua_State* L) {
+		LuaFunctionsLoader::pushPosition(L, testPosition);
+		return 1;
+	}
+
+	int getPackedPosition(lua_State* L) {
+		LuaFunctionsLoader::pushPackedPosition(L, testPosition);
+		return 1;
+	}
+
+	struct LuaState {
+		lua_State* L = luaL_newstate();
+
+		LuaState() {
+			luaL_openlibs(L);
+			PositionFunctions::init(L);
+			lua_register(L, "getPosition", getPosition);
+			lua_register(L, "getPackedPosition", getPackedPosition);
+		}
+
+		~LuaState() {
+			LuaFunctionsLoader::clearMetatableRefs(L);
+			lua_close(L);
+		}
+
+		bool run(const std::string &script) const {
+			if (luaL_dostring(L, script.c_str()) != 0) {
+				log << fmt::format("lua error: {}\n", lua_tostring(L, -1));
+				lua_pop(L, 1);
+				return false;
+			}
+			return true;
+		}
+	};
+}
+
+suite<"lua"> positionBenchmark = [] {
+	test("Position table vs packed position with 1M getPosition calls") = [] {
+		LuaState lua;
+		Benchmark tableBench;
+		expect(lua.run(R"(
+			local sum = 0
+			for i = 1, 1000000 do
+				local position = getPosition()
+				sum = sum + position.x + position.y + position.z
+			end
+			assert(sum > 0)
+		)"));
+		const auto tableDuration = tableBench.duration();
+
+		Benchmark packedBench;
+		expect(lua.run(R"(
+			local sum = 0
+			for i = 1, 1000000 do
+				sum = sum + getPackedPosition()
+			end
+			assert(sum > 0)
+		)"));
+		const auto packedDuration = packedBench.duration();
+
+		log << fmt::format("1M getPosition calls: table {} ms, packed {} ms\n", tableDuration, packedDuration);
+	};
+};
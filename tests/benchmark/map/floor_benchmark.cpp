@@ -0,0 +1,58 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/tile.hpp"
+#include "map/mapcache.hpp"
+
+using namespace boost::ut;
+
+suite<"map"> floorBenchmark = [] {
+	test("Floor::getTile multi-threaded throughput") = [] {
+		Floor floor(7);
+		for (uint16_t x = 0; x < FLOOR_SIZE; ++x) {
+			for (uint16_t y = 0; y < FLOOR_SIZE; ++y) {
+				floor.setTile(x, y, std::make_shared<StaticTile>(x, y, 7));
+			}
+		}
+
+		constexpr uint32_t lookupsPerThread = 1000000;
+		const uint32_t threadCount = std::max<uint32_t>(2, std::thread::hardware_concurrency());
+
+		std::atomic<uint32_t> misses = 0;
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+
+		Benchmark bm;
+		for (uint32_t i = 0; i < threadCount; ++i) {
+			threads.emplace_back([&floor, &misses, i] {
+				uint32_t localMisses = 0;
+				for (uint32_t n = 0; n < lookupsPerThread; ++n) {
+					const uint16_t x = (n + i) & FLOOR_MASK;
+					const uint16_t y = (n >> FLOOR_BITS) & FLOOR_MASK;
+					const auto &tile = floor.getTile(x, y);
+					if (!tile || tile->getPosition().x != x) {
+						++localMisses;
+					}
+				}
+				misses += localMisses;
+			});
+		}
+
+		for (auto &thread : threads) {
+			thread.join();
+		}
+
+		const double ms = bm.duration();
+		expect(eq(misses.load(), 0u));
+		log << fmt::format("{} threads, {} lookups in {:.2f} ms ({:.1f} M lookups/s)", threadCount, threadCount * lookupsPerThread, ms, (threadCount * lookupsPerThread) / (ms * 1000.0));
+	};
+};
@@ -0,0 +1,84 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "map/house/house_rent.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr time_t day = 24 * 60 * 60;
+	constexpr time_t now = 1700000000;
+
+	HouseRent::Settings weeklySettings(int64_t daysToReset = 0, bool vipKeepsHouse = false) {
+		HouseRent::Settings settings;
+		settings.now = now;
+		settings.period = HouseRent::getPeriodSeconds(RENTPERIOD_WEEKLY);
+		settings.daysToReset = daysToReset;
+		settings.vipKeepsHouse = vipKeepsHouse;
+		return settings;
+	}
+
+	HouseRent::Owner owner(uint64_t balance, time_t lastLogin = now, time_t premiumLastDay = 0) {
+		HouseRent::Owner result;
+		result.name = "Owner";
+		result.balance = balance;
+		result.lastLogin = lastLogin;
+		result.premiumLastDay = premiumLastDay;
+		return result;
+	}
+}
+
+suite<"map"> houseRentBenchmark = [] {
+	test("HouseRent::plan of 5000 houses and the queries it takes") = [] {
+		constexpr size_t houseCount = 5000;
+		std::mt19937 rng(41);
+		std::uniform_int_distribution<uint32_t> ownerGuid(1, 4000);
+		std::uniform_int_distribution<uint64_t> balance(0, 200000);
+		std::uniform_int_distribution<uint32_t> rent(1000, 50000);
+		std::uniform_int_distribution<uint32_t> warnings(0, 8);
+		std::uniform_int_distribution<int32_t> daysAgo(0, 60);
+
+		std::vector<HouseRent::Lease> leases;
+		HouseRent::Owners owners;
+		for (uint32_t houseId = 1; houseId <= houseCount; ++houseId) {
+			const auto guid = ownerGuid(rng);
+			leases.push_back({ houseId, guid, rent(rng), now - daysAgo(rng) * day, warnings(rng) });
+			if (guid % 50 != 0) {
+				owners.try_emplace(guid, owner(balance(rng), now - daysAgo(rng) * day));
+			}
+		}
+
+		Benchmark planBench;
+		const auto actions = HouseRent::plan(leases, owners, weeklySettings(45));
+		const auto planDuration = planBench.duration();
+
+		std::map<HouseRent::Action, size_t> counts;
+		for (const auto action : actions) {
+			++counts[action];
+		}
+
+		size_t charged = 0;
+		for (const auto &[_, owner] : owners) {
+			charged += owner.charged ? 1 : 0;
+		}
+
+		using enum HouseRent::Action;
+		const size_t playerLoads = counts[Warn] + counts[Evict] + counts[EvictInactive];
+		const size_t queries = (owners.size() + counts[Release] + HouseRent::QUERY_CHUNK_SIZE - 1) / HouseRent::QUERY_CHUNK_SIZE + (charged + HouseRent::QUERY_CHUNK_SIZE - 1) / HouseRent::QUERY_CHUNK_SIZE;
+		expect(eq(actions.size(), houseCount));
+		expect(counts[Pay] > 0 && counts[Warn] > 0 && counts[Evict] > 0 && counts[EvictInactive] > 0 && counts[Release] > 0);
+		expect(playerLoads < houseCount);
+
+		log << fmt::format("{} houses planned in {} ms: {} paid, {} warned, {} evicted, {} inactive, {} released\n", houseCount, planDuration, counts[Pay], counts[Warn], counts[Evict], counts[EvictInactive], counts[Release]);
+		log << fmt::format("about {} bulk queries and {} full player loads, instead of a full player load per house\n", queries, playerLoads);
+	};
+};
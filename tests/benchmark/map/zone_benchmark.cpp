@@ -0,0 +1,101 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "game/zones/zone.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	void addTiles(const std::shared_ptr<Zone> &zone, const Area &area) {
+		for (const auto &position : area) {
+			zone->addPosition(position);
+		}
+	}
+
+	bool containsZone(const std::vector<std::shared_ptr<Zone>> &zones, const std::shared_ptr<Zone> &zone) {
+		return std::ranges::find(zones, zone) != zones.end();
+	}
+}
+
+suite<"map"> zoneBenchmark = [] {
+	test("Zone index lookups vs linear scan of position sets with 300 zones") = [] {
+		constexpr size_t zoneCount = 300;
+		constexpr size_t lookups = 200000;
+		std::mt19937 rng(40);
+		std::uniform_int_distribution<int32_t> coordinate(1000, 3000);
+		std::uniform_int_distribution<int32_t> extent(0, 40);
+		std::uniform_int_distribution<int32_t> floor(6, 8);
+
+		std::vector<std::shared_ptr<Zone>> testZones;
+		std::vector<std::unordered_set<Position>> positionSets;
+		size_t tiles = 0;
+		size_t areas = 0;
+		for (size_t i = 0; i < zoneCount; ++i) {
+			const auto zone = Zone::addZone(fmt::format("zone_test_index_{}", i));
+			const Position from(coordinate(rng), coordinate(rng), floor(rng));
+			Area area(from, Position(from.x + extent(rng), from.y + extent(rng), from.z));
+			// One zone spanning a good part of the test region, beyond what gets indexed by sector
+			if (i == 0) {
+				area = Area(Position(1000, 1000, 7), Position(1543, 1543, 7));
+			}
+			addTiles(zone, area);
+			testZones.push_back(zone);
+			auto &positions = positionSets.emplace_back();
+			for (const auto &position : area) {
+				positions.insert(position);
+			}
+			tiles += positions.size();
+			areas += zone->getAreas().size();
+		}
+
+		std::vector<Position> probes;
+		probes.reserve(lookups);
+		for (size_t i = 0; i < lookups; ++i) {
+			probes.emplace_back(coordinate(rng), coordinate(rng), floor(rng));
+		}
+
+		// Same linear walk getZones did over every registered zone
+		size_t linearFound = 0;
+		Benchmark linearBench;
+		for (const auto &position : probes) {
+			for (const auto &positions : positionSets) {
+				if (positions.contains(position)) {
+					++linearFound;
+				}
+			}
+		}
+		const auto linearDuration = linearBench.duration();
+
+		// Only the zones of this test are in the probed region. The first lookup pays for building the index
+		size_t indexFound = 0;
+		Benchmark indexBench;
+		for (const auto &position : probes) {
+			indexFound += Zone::getZones(position).size();
+		}
+		const auto indexDuration = indexBench.duration();
+		expect(eq(linearFound, indexFound));
+
+		for (size_t i = 0; i < 1000; ++i) {
+			const auto &position = probes[i];
+			const auto zones = Zone::getZones(position);
+			for (size_t zone = 0; zone < zoneCount; ++zone) {
+				expect(eq(containsZone(zones, testZones[zone]), positionSets[zone].contains(position)));
+			}
+		}
+
+		// Node based set: the position and the next pointer per node, a bucket pointer per position
+		const size_t setBytes = tiles * (sizeof(Position) + 2 * sizeof(void*));
+		const size_t areaBytes = areas * sizeof(Area);
+		log << fmt::format("{} lookups over {} zones: linear {} ms, index {} ms\n", lookups, zoneCount, linearDuration, indexDuration);
+		log << fmt::format("{} tiles: ~{} KB as position sets, {} KB as {} areas\n", tiles, setBytes / 1024, areaBytes / 1024, areas);
+	};
+};
@@ -0,0 +1,45 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/logging/in_memory_logger.hpp"
+#include "security/rsa.hpp"
+#include "security/rsa_fixture.hpp"
+
+using namespace boost::ut;
+using namespace rsa_fixture;
+
+suite<"security"> rsaBenchmark = [] {
+	test("RSA::decrypt handshakes per second") = [] {
+		di::extension::injector<> injector {};
+		DI::setTestContainer(&InMemoryLogger::install(injector));
+		auto &rsa = DI::create<RSA &>();
+		rsa.setKey(p, q);
+
+		constexpr int handshakes = 2000;
+		std::array<char, 128> plain {};
+		plain.fill(0x2a);
+		plain[0] = 0;
+		const auto cipher = encrypt(plain);
+
+		Benchmark bm;
+		bool valid = true;
+		for (int i = 0; i < handshakes; ++i) {
+			auto block = cipher;
+			rsa.decrypt(block.data());
+			valid = valid && block == plain;
+		}
+		const auto duration = std::max(bm.duration(), 0.001);
+
+		expect(valid);
+		log << fmt::format("{} handshakes decrypted in {:.0f} ms, {:.0f} handshakes per second per thread\n", handshakes, duration, handshakes * 1000 / duration);
+	};
+};
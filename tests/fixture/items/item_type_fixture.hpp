@@ -0,0 +1,24 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#pragma once
+
+#include "items/item.hpp"
+
+/**
+ * Registers a bare item type the first time it is asked for and returns it,
+ * so the test can set the few properties it needs (stackable, group, ...).
+ * Ids below 100 are accepted without appearances, enough for unit tests.
+ */
+inline ItemType &registerItemType(uint16_t id) {
+	if (id >= Item::items.size() || Item::items.getItemType(id).id != id) {
+		pugi::xml_document doc;
+		Item::items.parseItemNode(doc.append_child("item"), id);
+	}
+	return Item::items.getItemType(id);
+}
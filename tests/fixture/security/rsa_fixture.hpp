@@ -0,0 +1,40 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#pragma once
+
+namespace rsa_fixture {
+	inline const char* const p = "14299623962416399520070177382898895550795403345466153217470516082934737582776038882967213386204600674145392845853859217990626450972452084065728686565928113";
+	inline const char* const q = "7630979195970404721891201847792002125535401292779123937207447574596692788513647179235335529307251350570728407373705564708871762033017096809910315212884101";
+
+	/**
+	 * What the client sends: a 128 bytes block starting with a zero byte,
+	 * encrypted with the public key of p and q.
+	 */
+	inline std::array<char, 128> encrypt(const std::array<char, 128> &plain) {
+		mpz_t n;
+		mpz_t qn;
+		mpz_t m;
+		mpz_init_set_str(n, p, 10);
+		mpz_init_set_str(qn, q, 10);
+		mpz_init(m);
+		mpz_mul(n, n, qn);
+
+		mpz_import(m, plain.size(), 1, 1, 0, 0, plain.data());
+		mpz_powm_ui(m, m, 65537, n);
+
+		std::array<char, 128> cipher {};
+		const size_t count = (mpz_sizeinbase(m, 2) + 7) / 8;
+		mpz_export(cipher.data() + (cipher.size() - count), nullptr, 1, 1, 0, 0, m);
+
+		mpz_clear(n);
+		mpz_clear(qn);
+		mpz_clear(m);
+		return cipher;
+	}
+}
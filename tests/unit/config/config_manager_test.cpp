@@ -0,0 +1,62 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "config/configmanager.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	std::string writeConfig(std::string_view content) {
+		// Unique per run, so concurrent runs do not overwrite each other's config
+		static const auto path = (std::filesystem::temp_directory_path() / fmt::format("canary_config_test_{}.lua", std::random_device {}())).string();
+		std::ofstream(path, std::ios::trunc) << content;
+		return path;
+	}
+}
+
+suite<"config"> configManagerTest = [] {
+	test("ConfigManager reads typed values from the loaded snapshot") = [] {
+		ConfigManager config;
+		config.setConfigFileLua(writeConfig(R"(
+			serverName = "Test"
+			kickIdlePlayerAfterMinutes = 30
+			autoLoot = true
+			houseRentRate = 2.5
+		)"));
+		expect(config.load());
+
+		expect(eq(config.getString(SERVER_NAME, __FUNCTION__), std::string("Test")));
+		expect(eq(config.getNumber(KICK_AFTER_MINUTES, __FUNCTION__), 30));
+		expect(config.getBoolean(AUTOLOOT, __FUNCTION__));
+		expect(eq(config.getFloat(HOUSE_RENT_RATE, __FUNCTION__), 2.5f));
+
+		// Wrong type reads keep returning the defaults
+		expect(eq(config.getNumber(SERVER_NAME, __FUNCTION__), 0));
+		expect(!config.getBoolean(KICK_AFTER_MINUTES, __FUNCTION__));
+	};
+
+	test("ConfigManager reload publishes a new snapshot without invalidating strings") = [] {
+		ConfigManager config;
+		config.setConfigFileLua(writeConfig(R"(serverName = "Before")"));
+		expect(config.load());
+		const std::string &before = config.getString(SERVER_NAME, __FUNCTION__);
+
+		// More reloads than retained snapshots, the old ones are freed but pooled strings stay
+		for (int reload = 0; reload < 8; ++reload) {
+			config.setConfigFileLua(writeConfig(fmt::format("serverName = \"After\"\nkickIdlePlayerAfterMinutes = {}\n", reload + 1)));
+			expect(config.load());
+		}
+		expect(eq(before, std::string("Before")));
+		expect(eq(config.getString(SERVER_NAME, __FUNCTION__), std::string("After")));
+		expect(eq(config.getNumber(KICK_AFTER_MINUTES, __FUNCTION__), 8));
+	};
+};
@@ -0,0 +1,66 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/combat/combat.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	using Offsets = std::vector<std::pair<int32_t, int32_t>>;
+
+	Offsets sortedOffsets(const AreaCombat &area, Direction dir) {
+		Offsets offsets;
+		for (const auto &offset : area.getOffsets(dir)) {
+			offsets.emplace_back(offset.x, offset.y);
+		}
+		std::ranges::sort(offsets);
+		return offsets;
+	}
+
+	Offsets line(int32_t dx, int32_t dy, int32_t length) {
+		Offsets offsets;
+		for (int32_t i = 0; i < length; ++i) {
+			offsets.emplace_back(dx * i, dy * i);
+		}
+		std::ranges::sort(offsets);
+		return offsets;
+	}
+}
+
+suite<"creatures"> combatAreaTest = [] {
+	test("AreaCombat compiles a beam into offsets for every direction") = [] {
+		AreaCombat area;
+		area.setupArea(5, 0);
+
+		expect(sortedOffsets(area, DIRECTION_NORTH) == line(0, -1, 5));
+		expect(sortedOffsets(area, DIRECTION_SOUTH) == line(0, 1, 5));
+		expect(sortedOffsets(area, DIRECTION_EAST) == line(1, 0, 5));
+		expect(sortedOffsets(area, DIRECTION_WEST) == line(-1, 0, 5));
+		expect(area.getOffsets(DIRECTION_NORTHEAST).empty());
+	};
+
+	test("AreaCombat radius offsets survive copies and are dropped on clear") = [] {
+		AreaCombat area;
+		area.setupArea(3);
+		expect(eq(area.getOffsets(DIRECTION_NORTH).size(), 9u));
+		for (const Direction dir : { DIRECTION_SOUTH, DIRECTION_EAST, DIRECTION_WEST }) {
+			expect(eq(area.getOffsets(dir).size(), 9u));
+		}
+
+		const auto copy = area.clone();
+		expect(sortedOffsets(*copy, DIRECTION_WEST) == sortedOffsets(area, DIRECTION_WEST));
+
+		area.clear();
+		expect(area.getOffsets(DIRECTION_NORTH).empty());
+		expect(eq(copy->getOffsets(DIRECTION_NORTH).size(), 9u));
+	};
+};
@@ -0,0 +1,86 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/combat/condition_list.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	std::shared_ptr<Condition> createGenericCondition(ConditionType_t type, int32_t ticks, uint32_t subId = 0) {
+		auto condition = std::make_shared<ConditionGeneric>(CONDITIONID_COMBAT, type, ticks, false, subId);
+		condition->setTicks(ticks);
+		return condition;
+	}
+}
+
+suite<"creatures"> conditionListTest = [] {
+	test("ConditionList::hasType tracks added and removed conditions") = [] {
+		ConditionList conditions;
+		const auto first = createGenericCondition(CONDITION_HASTE, 10000);
+		const auto second = createGenericCondition(CONDITION_HASTE, 10000, 1);
+
+		conditions.push_back(first);
+		conditions.push_back(second);
+		expect(conditions.hasType(CONDITION_HASTE));
+		expect(!conditions.hasType(CONDITION_POISON));
+
+		expect(conditions.erase(first));
+		expect(conditions.hasType(CONDITION_HASTE));
+		expect(conditions.erase(second));
+		expect(!conditions.hasType(CONDITION_HASTE));
+		expect(!conditions.erase(second));
+	};
+
+	test("ConditionList skips passive conditions until they expire") = [] {
+		ConditionList conditions;
+		conditions.push_back(createGenericCondition(CONDITION_MUTED, 60000));
+
+		const int64_t timeNow = OTSYS_TIME();
+		std::vector<std::shared_ptr<Condition>> due;
+		conditions.collectDue(timeNow, due);
+		expect(due.empty());
+		expect(!conditions.isDue(timeNow + 1000));
+		expect(conditions.isDue(timeNow + 61000));
+
+		conditions.collectDue(timeNow + 61000, due);
+		expect(eq(due.size(), 1u));
+	};
+
+
+	test("ConditionList::find returns the conditions of a type and sub id in the order they were added") = [] {
+		ConditionList conditions;
+		const auto fireball = createGenericCondition(CONDITION_SPELLCOOLDOWN, 2000, 42);
+		const auto otherSpell = createGenericCondition(CONDITION_SPELLCOOLDOWN, 2000, 7);
+		const auto group = createGenericCondition(CONDITION_SPELLGROUPCOOLDOWN, 2000, 42);
+		const auto secondFireball = createGenericCondition(CONDITION_SPELLCOOLDOWN, 4000, 42);
+		conditions.push_back(fireball);
+		conditions.push_back(otherSpell);
+		conditions.push_back(group);
+		conditions.push_back(secondFireball);
+
+		const auto found = conditions.find(CONDITION_SPELLCOOLDOWN, 42);
+		expect(eq(found.size(), 2u) >> fatal);
+		expect(found[0] == fireball && found[1] == secondFireball);
+		expect(eq(conditions.find(CONDITION_SPELLCOOLDOWN, 7).size(), 1u));
+		expect(eq(conditions.find(CONDITION_SPELLGROUPCOOLDOWN, 42).size(), 1u));
+		expect(conditions.find(CONDITION_SPELLCOOLDOWN, 8).empty());
+		expect(conditions.find(CONDITION_HASTE, 42).empty());
+
+		expect(conditions.erase(fireball));
+		const auto remaining = conditions.find(CONDITION_SPELLCOOLDOWN, 42);
+		expect(eq(remaining.size(), 1u) >> fatal);
+		expect(remaining[0] == secondFireball);
+		expect(conditions.erase(secondFireball));
+		expect(conditions.find(CONDITION_SPELLCOOLDOWN, 42).empty());
+		expect(conditions.hasType(CONDITION_SPELLCOOLDOWN));
+	};
+};
@@ -0,0 +1,151 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/players/inventory/inventory_item_index.hpp"
+#include "items/containers/container.hpp"
+#include "items/item_type_fixture.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr uint16_t backpackId = 1;
+	constexpr uint16_t coinId = 2;
+	constexpr uint16_t potionId = 3;
+	constexpr uint16_t swordId = 4;
+	constexpr size_t slotCount = CONST_SLOT_LAST - CONST_SLOT_FIRST + 1;
+
+	using Inventory = std::array<std::shared_ptr<Item>, slotCount>;
+
+	void registerItemTypes() {
+		registerItemType(backpackId);
+		registerItemType(swordId);
+		registerItemType(coinId).stackable = true;
+		registerItemType(potionId).stackable = true;
+	}
+
+	// Backpack with itemsPerLevel coins, potions and swords per level, nested depth times
+	std::shared_ptr<Container> createBackpackTree(size_t depth, size_t itemsPerLevel) {
+		auto root = Container::create(backpackId, static_cast<uint16_t>(itemsPerLevel * 3 + 1));
+		auto current = root;
+		for (size_t level = 0; level < depth; ++level) {
+			for (size_t i = 0; i < itemsPerLevel; ++i) {
+				current->internalAddThing(Item::CreateItem(coinId, 100));
+				current->internalAddThing(Item::CreateItem(potionId, 5));
+				current->internalAddThing(Item::CreateItem(swordId));
+			}
+
+			auto next = Container::create(backpackId, static_cast<uint16_t>(itemsPerLevel * 3 + 1));
+			current->internalAddThing(next);
+			current = next;
+		}
+		return root;
+	}
+
+	uint32_t countByWalking(const Inventory &inventory, uint16_t itemId) {
+		uint32_t count = 0;
+		for (const auto &item : inventory) {
+			if (!item) {
+				continue;
+			}
+
+			if (item->getID() == itemId) {
+				count += Item::countByType(item, -1);
+			}
+
+			if (const auto &container = item->getContainer()) {
+				for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
+					if ((*it)->getID() == itemId) {
+						count += Item::countByType(*it, -1);
+					}
+				}
+			}
+		}
+		return count;
+	}
+}
+
+suite<"creatures"> inventoryItemIndexTest = [] {
+	registerItemTypes();
+
+	test("InventoryItemIndex matches a walk of nested containers") = [] {
+		Inventory inventory;
+		inventory[CONST_SLOT_BACKPACK - CONST_SLOT_FIRST] = createBackpackTree(5, 4);
+		inventory[CONST_SLOT_RIGHT - CONST_SLOT_FIRST] = Item::CreateItem(swordId);
+
+		InventoryItemIndex index;
+		index.rebuild(inventory);
+
+		expect(eq(index.getItemCount(coinId), countByWalking(inventory, coinId)));
+		expect(eq(index.getItemCount(coinId), 5u * 4u * 100u));
+		expect(eq(index.getItemCount(potionId), 5u * 4u * 5u));
+		expect(eq(index.getItemCount(swordId), 5u * 4u + 1u));
+		expect(eq(index.getItemCount(backpackId), 6u));
+		expect(eq(index.getTierCounts().at(swordId).at(0), 5u * 4u + 1u));
+
+		// Equipped items are for sale too, the backpack itself included
+		expect(eq(index.getSaleCounts().at(swordId), 5u * 4u + 1u));
+		expect(eq(index.getSaleCounts().at(backpackId), 6u));
+		expect(eq(index.getSaleCounts().at(coinId), 5u * 4u * 100u));
+		expect(index.verify(inventory));
+	};
+
+	test("InventoryItemIndex::verify detects changes the index was not told about") = [] {
+		Inventory inventory;
+		auto backpack = createBackpackTree(2, 1);
+		inventory[CONST_SLOT_BACKPACK - CONST_SLOT_FIRST] = backpack;
+
+		InventoryItemIndex index;
+		index.rebuild(inventory);
+		const auto coins = Item::CreateItem(coinId, 7);
+		backpack->internalAddThing(coins);
+		expect(!index.verify(inventory));
+
+		index.add(coins, false);
+		expect(index.verify(inventory));
+		expect(eq(index.getItemCount(coinId), 207u));
+	};
+
+	test("InventoryItemIndex incremental updates match a rebuild") = [] {
+		Inventory inventory;
+		auto backpack = createBackpackTree(3, 2);
+		inventory[CONST_SLOT_BACKPACK - CONST_SLOT_FIRST] = backpack;
+
+		InventoryItemIndex index;
+		index.add(backpack, true);
+		expect(index.verify(inventory));
+
+		// A filled container brings its whole content along
+		const auto pouch = createBackpackTree(2, 1);
+		backpack->internalAddThing(pouch);
+		index.add(pouch, false);
+		expect(index.verify(inventory));
+
+		const auto coins = Item::CreateItem(coinId, 100);
+		backpack->internalAddThing(coins);
+		index.add(coins, false);
+		coins->setItemCount(40);
+		index.replace(coinId, 0, 100, coins, false);
+		expect(index.verify(inventory));
+		expect(eq(index.getItemCount(coinId), 3u * 2u * 100u + 2u * 100u + 40u));
+
+		coins->setID(potionId);
+		index.replace(coinId, 0, 40, coins, false);
+		expect(index.verify(inventory));
+
+		// Emptied entries are dropped, as a rebuild would never create them
+		index.remove(backpack, true);
+		inventory[CONST_SLOT_BACKPACK - CONST_SLOT_FIRST] = nullptr;
+		expect(index.getItemCounts().empty());
+		expect(index.getTierCounts().empty());
+		expect(index.getSaleCounts().empty());
+	};
+};
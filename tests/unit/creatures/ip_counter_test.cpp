@@ -0,0 +1,77 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/players/management/ip_counter.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	// The count the status document used to build by walking every online player
+	uint32_t countRealPlayers(const std::map<uint32_t, uint32_t> &ipByPlayer) {
+		uint32_t real = 0;
+		std::map<uint32_t, uint32_t> listIP;
+		for (const auto &[playerId, ip] : ipByPlayer) {
+			if (ip != 0 && ++listIP[ip] <= PlayerIpCounter::MAX_PLAYERS_PER_IP) {
+				++real;
+			}
+		}
+		return real;
+	}
+}
+
+suite<"creatures"> ipCounterTest = [] {
+	test("PlayerIpCounter counts at most MAX_PLAYERS_PER_IP players per ip") = [] {
+		PlayerIpCounter counter;
+		for (uint32_t playerId = 1; playerId <= 6; ++playerId) {
+			counter.setPlayerIp(playerId, 0x0100000A);
+		}
+		counter.setPlayerIp(7, 0x0200000A);
+		counter.setPlayerIp(8, 0);
+
+		expect(eq(counter.getRealPlayers(), 5u));
+		expect(eq(counter.getPlayersByIp(0x0100000A), 6u));
+
+		counter.removePlayer(1);
+		counter.removePlayer(2);
+		expect(eq(counter.getRealPlayers(), 5u));
+		counter.removePlayer(3);
+		expect(eq(counter.getRealPlayers(), 4u));
+
+		// Lost connection, then reconnected from another ip
+		counter.setPlayerIp(7, 0);
+		expect(eq(counter.getRealPlayers(), 3u));
+		counter.setPlayerIp(7, 0x0300000A);
+		expect(eq(counter.getRealPlayers(), 4u));
+		expect(eq(counter.getPlayersByIp(0x0200000A), 0u));
+	};
+
+	test("PlayerIpCounter matches a full walk over random logins and logouts") = [] {
+		std::mt19937 rng(45);
+		std::uniform_int_distribution<uint32_t> playerId(1, 3000);
+		std::uniform_int_distribution<uint32_t> ip(0, 800);
+
+		PlayerIpCounter counter;
+		std::map<uint32_t, uint32_t> ipByPlayer;
+		bool matches = true;
+		for (int i = 0; i < 20000; ++i) {
+			const auto id = playerId(rng);
+			const auto newIp = i % 3 == 0 ? 0 : ip(rng);
+			counter.setPlayerIp(id, newIp);
+			ipByPlayer[id] = newIp;
+			if (i % 100 == 0) {
+				matches = matches && counter.getRealPlayers() == countRealPlayers(ipByPlayer);
+			}
+		}
+		expect(matches);
+		expect(eq(counter.getRealPlayers(), countRealPlayers(ipByPlayer)));
+	};
+};
@@ -0,0 +1,109 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/monsters/loot_table.hpp"
+#include "items/item.hpp"
+#include "items/item_type_fixture.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr uint16_t goldId = 21;
+	constexpr uint16_t swordId = 22;
+	constexpr uint16_t hornId = 23;
+	constexpr uint16_t wandId = 24;
+
+	void registerItemTypes() {
+		registerItemType(swordId);
+		registerItemType(goldId).stackable = true;
+		registerItemType(hornId).type = ITEM_TYPE_CREATUREPRODUCT;
+		registerItemType(wandId).charges = 50;
+	}
+
+	LootBlock lootBlock(uint16_t id, uint32_t chance, uint32_t countMin = 1, uint32_t countMax = 1, bool unique = false) {
+		LootBlock block;
+		block.id = id;
+		block.chance = chance;
+		block.countmin = countMin;
+		block.countmax = countMax;
+		block.unique = unique;
+		return block;
+	}
+
+	// Drop rate of MonsterType:generateLootRoll: math.random(0, MAX_LOOTCHANCE) * 100 / multiplier < chance
+	double expectedRate(uint32_t chance, double multiplier) {
+		const auto threshold = std::ceil(chance * multiplier / 100.0);
+		return std::min(1.0, threshold / (MAX_LOOTCHANCE + 1));
+	}
+}
+
+suite<"creatures"> lootTableTest = [] {
+	registerItemTypes();
+
+	test("LootTable counts follow charges, stack ranges and merged entries") = [] {
+		LootTable table;
+		table.add(lootBlock(goldId, MAX_LOOTCHANCE, 10, 20));
+		table.add(lootBlock(goldId, MAX_LOOTCHANCE, 5, 5));
+		table.add(lootBlock(wandId, MAX_LOOTCHANCE));
+		table.add(lootBlock(swordId, MAX_LOOTCHANCE, 1, 1, true));
+		table.add(lootBlock(swordId, MAX_LOOTCHANCE, 1, 1, true));
+
+		// The rate multiplier pushes every roll under the chance
+		std::vector<LootTable::Drop> drops;
+		table.roll(1000, 100, drops);
+		expect(eq(drops.size(), 3u));
+		for (const auto &drop : drops) {
+			const auto &entry = table.getEntries()[drop.entry];
+			if (entry.itemId == goldId) {
+				expect(drop.count >= 15u && drop.count <= 25u);
+			} else if (entry.itemId == wandId) {
+				expect(eq(drop.count, 50u));
+			} else {
+				expect(eq(drop.count, 1u)) << "unique items drop once";
+			}
+		}
+	};
+
+	test("LootTable drop rates match the scripted loot rolls") = [] {
+		// Enough kills to tell a 10% rate from a 12% one within the tolerance below
+		constexpr size_t kills = 20000;
+		LootTable table;
+		table.add(lootBlock(swordId, 25000));
+		table.add(lootBlock(goldId, 2500, 1, 50));
+		table.add(lootBlock(hornId, 10000));
+
+		for (const auto &[multiplier, creatureProductChance] : { std::pair { 100.0, 100u }, std::pair { 250.0, 100u }, std::pair { 100.0, 120u } }) {
+			std::array<size_t, 3> dropped {};
+			std::vector<LootTable::Drop> drops;
+			for (size_t kill = 0; kill < kills; ++kill) {
+				drops.clear();
+				table.roll(multiplier, creatureProductChance, drops);
+				for (const auto &drop : drops) {
+					++dropped[drop.entry];
+				}
+			}
+
+			for (uint32_t index = 0; index < table.getEntries().size(); ++index) {
+				const auto &entry = table.getEntries()[index];
+				uint32_t chance = entry.chance;
+				if (entry.creatureProduct) {
+					chance = static_cast<uint32_t>(std::ceil(chance * creatureProductChance / 100.0));
+				}
+				const double expected = expectedRate(chance, multiplier);
+				const double observed = static_cast<double>(dropped[index]) / kills;
+				// Five standard deviations of a binomial proportion
+				const double tolerance = 5 * std::sqrt(expected * (1 - expected) / kills);
+				expect(std::abs(observed - expected) <= tolerance) << fmt::format("item {} at {}%: observed {:.5f}, expected {:.5f}", entry.itemId, multiplier, observed, expected);
+			}
+		}
+	};
+};
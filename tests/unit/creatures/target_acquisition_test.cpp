@@ -0,0 +1,54 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/creature.hpp"
+#include "creatures/monsters/target_acquisition.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	// Range test of Spectators::find, shifted by the floor difference like the leaf scan does
+	bool inRange(const Position &center, const Position &pos, int32_t rangeX, int32_t rangeY) {
+		const int32_t offsetZ = Position::getOffsetZ(center, pos);
+		return pos.x >= center.x - rangeX + offsetZ && pos.x <= center.x + rangeX + offsetZ
+			&& pos.y >= center.y - rangeY + offsetZ && pos.y <= center.y + rangeY + offsetZ;
+	}
+}
+
+suite<"creatures"> targetAcquisitionTest = [] {
+	test("TargetAcquisition sector query covers the view of every position of the sector") = [] {
+		for (const uint8_t z : { 5, 7, 8, 12 }) {
+			const Position corner(1008, 2000, z);
+			const auto center = TargetAcquisition::getSectorCenter(corner);
+			for (int32_t dx = 0; dx < TargetAcquisition::SECTOR_SIZE; ++dx) {
+				for (int32_t dy = 0; dy < TargetAcquisition::SECTOR_SIZE; ++dy) {
+					const Position monsterPos(corner.x + dx, corner.y + dy, z);
+					expect(eq(TargetAcquisition::getSectorKey(monsterPos), TargetAcquisition::getSectorKey(corner)));
+					expect(TargetAcquisition::getSectorCenter(monsterPos) == center);
+
+					// Corners of the view of the monster on every floor it may see
+					for (uint8_t targetZ = 0; targetZ < MAP_MAX_LAYERS; ++targetZ) {
+						const int32_t offsetZ = monsterPos.z - targetZ;
+						for (const int32_t sx : { -MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_X }) {
+							for (const int32_t sy : { -MAP_MAX_VIEW_PORT_Y, MAP_MAX_VIEW_PORT_Y }) {
+								const Position target(monsterPos.x + sx + offsetZ, monsterPos.y + sy + offsetZ, targetZ);
+								if (Creature::canSee(monsterPos, target, MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y)) {
+									expect(inRange(center, target, TargetAcquisition::SECTOR_RANGE_X, TargetAcquisition::SECTOR_RANGE_Y));
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	};
+};
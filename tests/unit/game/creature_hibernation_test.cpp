@@ -0,0 +1,180 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "config/configmanager.hpp"
+#include "creatures/players/player.hpp"
+#include "game/game.hpp"
+#include "items/tile.hpp"
+#include "map/map.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	class SleeperCreature final : public Creature {
+	public:
+		const std::string &getName() const override {
+			return name;
+		}
+		const std::string &getTypeName() const override {
+			return name;
+		}
+		const std::string &getNameDescription() const override {
+			return name;
+		}
+		std::string getDescription(int32_t) override {
+			return name;
+		}
+		CreatureType_t getType() const override {
+			return CREATURETYPE_MONSTER;
+		}
+		void setID() override { }
+		void addList() override { }
+		void removeList() override { }
+
+		void onThink(uint32_t) override {
+			++thinks;
+		}
+
+		uint32_t thinks = 0;
+
+	private:
+		std::string name = "sleeper";
+	};
+
+	// Turns hibernation on for the scope of a test, then deletes its config file and gives the
+	// config manager its previous file back
+	class HibernationConfig {
+	public:
+		HibernationConfig() :
+			previousPath(g_configManager().getConfigFileLua()),
+			path((std::filesystem::temp_directory_path() / fmt::format("canary_hibernation_test_{}.lua", std::random_device {}())).string()) {
+			load(true);
+		}
+		~HibernationConfig() {
+			std::error_code ec;
+			if (std::filesystem::exists(previousPath, ec)) {
+				g_configManager().setConfigFileLua(previousPath);
+				g_configManager().load();
+			} else {
+				// Nothing to reload, at least do not leave hibernation on
+				load(false);
+				g_configManager().setConfigFileLua(previousPath);
+			}
+			std::filesystem::remove(path, ec);
+		}
+
+		HibernationConfig(const HibernationConfig &) = delete;
+		HibernationConfig &operator=(const HibernationConfig &) = delete;
+
+	private:
+		void load(bool hibernation) const {
+			std::ofstream(path, std::ios::trunc) << fmt::format("toggleCreatureHibernation = {}\n", hibernation);
+			g_configManager().setConfigFileLua(path);
+			g_configManager().load();
+		}
+
+		std::string previousPath;
+		std::string path;
+	};
+
+	void place(const std::shared_ptr<Creature> &creature, const Position &pos) {
+		auto &map = g_game().map;
+		auto tile = map.getTile(pos);
+		if (!tile) {
+			tile = std::make_shared<DynamicTile>(pos.x, pos.y, pos.z);
+			map.setTile(pos, tile);
+		}
+		creature->setParent(tile);
+		map.getQTNode(pos.x, pos.y)->addCreature(creature);
+	}
+
+	void unplace(const std::shared_ptr<Creature> &creature) {
+		const auto &pos = creature->getPosition();
+		g_game().map.getQTNode(pos.x, pos.y)->removeCreature(creature);
+	}
+
+	// Every check list is visited once, wherever addCreatureCheck put the creature
+	void checkAllCreatures() {
+		for (int32_t i = 0; i < EVENT_CREATURECOUNT; ++i) {
+			g_game().checkCreatures();
+		}
+	}
+}
+
+suite<"game"> creatureHibernationTest = [] {
+	test("Game::checkCreatures puts creatures out of range to sleep and a player entering range wakes them") = [] {
+		const HibernationConfig hibernation;
+		auto &game = g_game();
+		const auto sleeping = game.getHibernatingCreatures();
+
+		const Position sleeperPos(1000, 1000, 7);
+		const Position farPos(sleeperPos.x + (Map::HIBERNATION_RANGE_X + 2) * FLOOR_SIZE, sleeperPos.y, 7);
+		// Next leaf, another floor
+		const Position nearPos(sleeperPos.x + FLOOR_SIZE, sleeperPos.y, 6);
+
+		const auto sleeper = std::make_shared<SleeperCreature>();
+		const auto player = std::make_shared<Player>(nullptr);
+		place(sleeper, sleeperPos);
+		place(player, farPos);
+
+		game.addCreatureCheck(sleeper);
+		checkAllCreatures();
+		expect(eq(sleeper->thinks, 0u));
+		expect(eq(game.getHibernatingCreatures(), sleeping + 1));
+
+		checkAllCreatures();
+		expect(eq(sleeper->thinks, 0u));
+
+		unplace(player);
+		place(player, nearPos);
+		game.map.wakeCreaturesInHibernationRange(nearPos);
+		expect(eq(game.getHibernatingCreatures(), sleeping));
+
+		checkAllCreatures();
+		expect(eq(sleeper->thinks, 1u));
+
+		game.removeCreatureCheck(sleeper);
+		checkAllCreatures();
+		unplace(sleeper);
+		unplace(player);
+	};
+
+	test("Game::checkCreatures keeps creatures with a player in range awake") = [] {
+		const HibernationConfig hibernation;
+		auto &game = g_game();
+		const auto sleeping = game.getHibernatingCreatures();
+
+		const Position creaturePos(2000, 2000, 7);
+		const Position playerPos(creaturePos.x - Map::HIBERNATION_RANGE_X * FLOOR_SIZE, creaturePos.y, 7);
+
+		const auto creature = std::make_shared<SleeperCreature>();
+		const auto player = std::make_shared<Player>(nullptr);
+		place(creature, creaturePos);
+		place(player, playerPos);
+
+		game.addCreatureCheck(creature);
+		checkAllCreatures();
+		checkAllCreatures();
+		expect(eq(creature->thinks, 2u));
+		expect(eq(game.getHibernatingCreatures(), sleeping));
+
+		// Leaving range, it falls asleep on its next check
+		unplace(player);
+		checkAllCreatures();
+		expect(eq(creature->thinks, 2u));
+		expect(eq(game.getHibernatingCreatures(), sleeping + 1));
+
+		game.removeCreatureCheck(creature);
+		expect(eq(game.getHibernatingCreatures(), sleeping));
+		unplace(creature);
+	};
+};
@@ -0,0 +1,74 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "game/highscores/leaderboard.hpp"
+
+using namespace boost::ut;
+
+suite<"game"> leaderboardTest = [] {
+	test("Leaderboard ranks by points, breaks ties by guid and shares the rank of ties") = [] {
+		Leaderboard board;
+		board.assign({ { 100, 3, 1 }, { 300, 1, 2 }, { 100, 2, 1 }, { 50, 4, 2 } });
+
+		const auto entries = board.getRange(0, 10);
+		expect(eq(entries.size(), 4u));
+		expect(eq(entries[0].guid, 1u));
+		expect(eq(entries[1].guid, 2u));
+		expect(eq(entries[2].guid, 3u));
+		expect(eq(entries[3].guid, 4u));
+
+		expect(eq(board.getRank(300), 1u));
+		expect(eq(board.getRank(100), 2u));
+		expect(eq(board.getRank(50), 4u));
+		expect(eq(board.getRank(10), 5u));
+		expect(eq(*board.getPosition({ 100, 3, 1 }), 2u));
+		expect(!board.getPosition({ 101, 3, 1 }));
+	};
+
+	test("Leaderboard filters positions, ranks and ranges by group") = [] {
+		Leaderboard board;
+		board.assign({ { 500, 1, 1 }, { 400, 2, 2 }, { 300, 3, 1 }, { 200, 4, 2 }, { 100, 5, 1 } });
+
+		expect(eq(board.size(1), 3u));
+		expect(eq(board.size(2), 2u));
+		expect(eq(board.size(3), 0u));
+		expect(eq(board.getRank(300, 1), 2u));
+		expect(eq(*board.getPosition({ 200, 4, 2 }, 2), 1u));
+		expect(!board.getPosition({ 200, 4, 2 }, 1));
+
+		const auto page = board.getRange(1, 2, 1);
+		expect(eq(page.size(), 2u));
+		expect(eq(page[0].guid, 3u));
+		expect(eq(page[1].guid, 5u));
+	};
+
+	test("Leaderboard keeps its order through inserts, erases and block splits") = [] {
+		Leaderboard board;
+		for (uint32_t guid = 1; guid <= 2000; ++guid) {
+			board.insert({ guid % 97, guid, static_cast<uint8_t>(guid % 4) });
+		}
+		expect(gt(board.getBlockCount(), 1u));
+
+		for (uint32_t guid = 1; guid <= 2000; guid += 2) {
+			expect(board.erase({ guid % 97, guid, static_cast<uint8_t>(guid % 4) }));
+		}
+		expect(!board.erase({ 1, 1, 1 }));
+		expect(eq(board.size(), 1000u));
+
+		const auto entries = board.getRange(0, board.size());
+		expect(eq(entries.size(), 1000u));
+		expect(std::is_sorted(entries.begin(), entries.end()));
+		for (size_t i = 0; i < entries.size(); ++i) {
+			expect(eq(*board.getPosition(entries[i]), i));
+		}
+	};
+};
@@ -0,0 +1,84 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "io/io_name_cache.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr int64_t now = 1000000;
+}
+
+suite<"io"> ioNameCacheTest = [] {
+	test("NameIdMap looks names up case insensitively and keeps the original name") = [] {
+		NameIdMap map(10);
+		map.set(7, "Knight Of Doom", now);
+
+		expect(map.getId("knight of doom", now) == std::optional<uint32_t>(7));
+		expect(map.getId("KNIGHT OF DOOM", now) == std::optional<uint32_t>(7));
+		expect(map.getName(7, now) == std::optional<std::string>("Knight Of Doom"));
+		expect(!map.getId("Knight", now));
+		expect(!map.getName(8, now));
+		expect(eq(map.getStats().hits, 3u));
+		expect(eq(map.getStats().misses, 2u));
+		expect(eq(map.getHitRate(), 0.6));
+	};
+
+	test("NameIdMap follows renames and names taken over by another id") = [] {
+		NameIdMap map(10);
+		map.set(1, "Old Name", now);
+		map.set(1, "New Name", now);
+		expect(!map.getId("old name", now));
+		expect(map.getId("new name", now) == std::optional<uint32_t>(1));
+
+		map.set(2, "New Name", now);
+		expect(map.getId("new name", now) == std::optional<uint32_t>(2));
+		expect(!map.getName(1, now));
+		expect(eq(map.size(), 1u));
+
+		map.erase(2);
+		expect(!map.getId("new name", now));
+		expect(eq(map.size(), 0u));
+	};
+
+	test("NameIdMap evicts the least recently used pair once full") = [] {
+		NameIdMap map(3);
+		for (uint32_t id = 1; id <= 3; ++id) {
+			map.set(id, fmt::format("Player {}", id), now);
+		}
+		expect(eq(map.size(), 3u));
+
+		// Player 2 becomes the least recently used
+		expect(map.getId("player 1", now) == std::optional<uint32_t>(1));
+		expect(map.getName(3, now) == std::optional<std::string>("Player 3"));
+
+		map.set(4, "Player 4", now);
+		expect(eq(map.size(), 3u));
+		expect(map.getId("player 4", now) == std::optional<uint32_t>(4));
+		expect(map.getId("player 1", now) == std::optional<uint32_t>(1));
+		expect(!map.getId("player 2", now));
+	};
+
+	test("NameIdMap queries pairs older than the ttl again") = [] {
+		constexpr int64_t ttl = 60000;
+		NameIdMap map(10, ttl);
+		map.set(1, "Disbanded Guild", now);
+		map.set(2, "Active Guild", now);
+
+		expect(map.getId("disbanded guild", now + ttl - 1) == std::optional<uint32_t>(1));
+		map.set(2, "Active Guild", now + ttl - 1);
+		expect(!map.getId("disbanded guild", now + ttl));
+		expect(!map.getName(1, now + ttl));
+		expect(map.getName(2, now + ttl) == std::optional<std::string>("Active Guild"));
+		expect(eq(map.size(), 1u));
+	};
+};
@@ -0,0 +1,94 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "io/market_order_book.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	MarketOrderBook::Offer offer(uint32_t id, uint32_t playerId, MarketAction_t type, uint16_t itemId, uint64_t price, uint32_t created = 1000) {
+		MarketOrderBook::Offer result;
+		result.id = id;
+		result.playerId = playerId;
+		result.type = type;
+		result.itemId = itemId;
+		result.price = price;
+		result.amount = 10;
+		result.created = created;
+		result.playerName = fmt::format("Player {}", playerId);
+		return result;
+	}
+
+	std::vector<uint32_t> ids(const std::vector<const MarketOrderBook::Offer*> &offers) {
+		std::vector<uint32_t> result;
+		for (const auto offer : offers) {
+			result.push_back(offer->id);
+		}
+		return result;
+	}
+}
+
+suite<"io"> marketOrderBookTest = [] {
+	test("MarketOrderBook sorts each side best price first") = [] {
+		MarketOrderBook book;
+		book.add(offer(1, 1, MARKETACTION_SELL, 3031, 30));
+		book.add(offer(2, 2, MARKETACTION_SELL, 3031, 10));
+		book.add(offer(3, 3, MARKETACTION_SELL, 3031, 10));
+		book.add(offer(4, 1, MARKETACTION_BUY, 3031, 5));
+		book.add(offer(5, 2, MARKETACTION_BUY, 3031, 8));
+		book.add(offer(6, 2, MARKETACTION_SELL, 3035, 1));
+
+		expect(ids(book.getOffers(MARKETACTION_SELL, 3031, 0)) == std::vector<uint32_t> { 2, 3, 1 });
+		expect(ids(book.getOffers(MARKETACTION_BUY, 3031, 0)) == std::vector<uint32_t> { 5, 4 });
+		expect(book.getOffers(MARKETACTION_SELL, 3031, 1).empty());
+		expect(eq(book.getOffers(MARKETACTION_SELL).size(), 4u));
+		expect(ids(book.getPlayerOffers(2, MARKETACTION_SELL)) == std::vector<uint32_t> { 2, 6 });
+		expect(eq(book.getPlayerOfferCount(2), 3u));
+		expect(!book.add(offer(1, 9, MARKETACTION_SELL, 3031, 1)));
+	};
+
+	test("MarketOrderBook finds offers by creation time and counter, and keeps its indexes on removal") = [] {
+		MarketOrderBook book;
+		book.add(offer(0x10005, 1, MARKETACTION_SELL, 3031, 30, 2000));
+		book.add(offer(0x20005, 2, MARKETACTION_SELL, 3031, 30, 2001));
+		expect(book.find(2001, 5)->id == 0x20005u);
+		expect(!book.find(2002, 5));
+
+		const auto created = book.createOffer(offer(0, 3, MARKETACTION_BUY, 3031, 7));
+		expect(eq(created.id, 0x20006u));
+		expect(book.reduceAmount(created.id, 4));
+		expect(eq(book.get(created.id)->amount, 6));
+		expect(!book.reduceAmount(created.id, 7));
+
+		expect(book.remove(0x10005).has_value());
+		expect(!book.remove(0x10005).has_value());
+		expect(ids(book.getOffers(MARKETACTION_SELL, 3031, 0)) == std::vector<uint32_t> { 0x20005 });
+		expect(eq(book.getPlayerOfferCount(1), 0u));
+
+		book.renamePlayer(2, "Renamed");
+		expect(book.get(0x20005)->playerName == "Renamed");
+	};
+
+	test("MarketOrderBook takes the expired offers oldest first") = [] {
+		MarketOrderBook book;
+		book.add(offer(1, 1, MARKETACTION_SELL, 3031, 30, 300));
+		book.add(offer(2, 1, MARKETACTION_BUY, 3031, 30, 100));
+		book.add(offer(3, 1, MARKETACTION_SELL, 3031, 30, 500));
+
+		const auto expired = book.takeExpired(300);
+		expect(eq(expired.size(), 2u));
+		expect(eq(expired[0].id, 2u));
+		expect(eq(expired[1].id, 1u));
+		expect(eq(book.size(), 1u));
+		expect(eq(book.getPlayerOfferCount(1), 1u));
+	};
+};
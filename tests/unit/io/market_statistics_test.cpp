@@ -0,0 +1,87 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "io/market_statistics.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr time_t day = MarketStatisticsLedger::DAY_SECONDS;
+	constexpr time_t now = 1700000000;
+}
+
+suite<"io"> marketStatisticsTest = [] {
+	test("MarketStatisticsLedger sums transactions per item, tier and side") = [] {
+		MarketStatisticsLedger ledger;
+		ledger.addTransaction(now, MARKETACTION_BUY, 3031, 0, 50);
+		ledger.addTransaction(now, MARKETACTION_BUY, 3031, 0, 10);
+		ledger.addTransaction(now - day, MARKETACTION_BUY, 3031, 0, 30);
+		ledger.addTransaction(now, MARKETACTION_BUY, 3031, 1, 500);
+		ledger.addTransaction(now, MARKETACTION_SELL, 3031, 0, 70);
+
+		const auto purchase = ledger.getStatistics(MARKETACTION_BUY, 3031, 0);
+		expect(eq(purchase.numTransactions, 3u));
+		expect(eq(purchase.totalPrice, 90u));
+		expect(eq(purchase.lowestPrice, 10u));
+		expect(eq(purchase.highestPrice, 50u));
+		expect(eq(ledger.getStatistics(MARKETACTION_BUY, 3031, 1).numTransactions, 1u));
+		expect(eq(ledger.getStatistics(MARKETACTION_SELL, 3031, 0).totalPrice, 70u));
+		expect(eq(ledger.getStatistics(MARKETACTION_SELL, 3035, 0).numTransactions, 0u));
+		expect(eq(ledger.getDayCount(), 2u));
+	};
+
+	test("MarketStatisticsLedger rebuilds the totals once days leave the window") = [] {
+		MarketStatisticsLedger ledger;
+		ledger.addTransaction(now - 2 * day, MARKETACTION_BUY, 3031, 0, 5);
+		ledger.addTransaction(now - 2 * day, MARKETACTION_SELL, 3031, 0, 5);
+		ledger.addTransaction(now, MARKETACTION_BUY, 3031, 0, 20);
+
+		expect(eq(ledger.expire(MarketStatisticsLedger::getDay(now - 2 * day)), 0u));
+		expect(eq(ledger.expire(MarketStatisticsLedger::getDay(now - day)), 1u));
+
+		const auto purchase = ledger.getStatistics(MARKETACTION_BUY, 3031, 0);
+		expect(eq(purchase.numTransactions, 1u));
+		expect(eq(purchase.lowestPrice, 20u));
+		expect(ledger.getSaleStatistics().empty());
+	};
+
+	test("MarketStatisticsLedger matches the history aggregate over 30 days of transactions") = [] {
+		constexpr size_t transactionCount = 20000;
+		std::mt19937 rng(47);
+		std::uniform_int_distribution<uint16_t> itemId(1, 3000);
+		std::uniform_int_distribution<uint64_t> price(1, 1000000);
+		std::uniform_int_distribution<time_t> age(0, 30 * day);
+
+		MarketStatisticsLedger ledger;
+		std::map<uint16_t, MarketStatistics> expected;
+		for (size_t i = 0; i < transactionCount; ++i) {
+			const auto id = itemId(rng);
+			const auto transactionPrice = price(rng);
+			ledger.addTransaction(now - age(rng), MARKETACTION_BUY, id, 0, transactionPrice);
+
+			MarketStatistics transaction;
+			transaction.numTransactions = 1;
+			transaction.totalPrice = transactionPrice;
+			transaction.lowestPrice = transactionPrice;
+			transaction.highestPrice = transactionPrice;
+			MarketStatisticsLedger::merge(expected[id], transaction);
+		}
+
+		for (const auto &[id, statistics] : expected) {
+			const auto actual = ledger.getStatistics(MARKETACTION_BUY, id, 0);
+			expect(eq(actual.numTransactions, statistics.numTransactions));
+			expect(eq(actual.totalPrice, statistics.totalPrice));
+			expect(eq(actual.lowestPrice, statistics.lowestPrice));
+			expect(eq(actual.highestPrice, statistics.highestPrice));
+		}
+	};
+};
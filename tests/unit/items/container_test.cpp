@@ -0,0 +1,116 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/containers/container.hpp"
+#include "items/item_type_fixture.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr uint16_t bagId = 11;
+	constexpr uint16_t arrowId = 12;
+	constexpr uint16_t ropeId = 13;
+	constexpr uint16_t usedRopeId = 14;
+	constexpr uint16_t chestId = 15;
+
+	void registerItemTypes() {
+		for (const uint16_t id : { bagId, ropeId, usedRopeId }) {
+			registerItemType(id);
+		}
+		registerItemType(arrowId).stackable = true;
+		registerItemType(bagId).group = ITEM_GROUP_CONTAINER;
+		registerItemType(chestId).group = ITEM_GROUP_CONTAINER;
+	}
+
+	// Returns the deepest container of a chain of depth nested bags
+	std::shared_ptr<Container> createNestedBags(const std::shared_ptr<Container> &root, size_t depth) {
+		auto current = root;
+		for (size_t level = 0; level < depth; ++level) {
+			auto next = Container::create(bagId, 20);
+			current->internalAddThing(Item::CreateItem(ropeId));
+			current->internalAddThing(next);
+			current = next;
+		}
+		return current;
+	}
+
+	uint32_t countByWalking(const std::shared_ptr<Container> &container) {
+		uint32_t counter = 0;
+		for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
+			++counter;
+		}
+		return counter;
+	}
+}
+
+suite<"items"> containerTest = [] {
+	registerItemTypes();
+
+	test("Container holding counters follow nested adds and removes") = [] {
+		auto root = Container::create(bagId, 20);
+		auto deepest = createNestedBags(root, 5);
+		expect(eq(root->getItemHoldingCount(), 10u));
+		expect(eq(root->getContainerHoldingCount(), 5u));
+		expect(root->isHoldingItemWithId(bagId));
+		expect(root->isHoldingItemWithId(ropeId));
+
+		auto arrows = Item::CreateItem(arrowId, 50);
+		deepest->internalAddThing(arrows);
+		expect(eq(root->getItemHoldingCount(), countByWalking(root)));
+		expect(root->isHoldingItemWithId(arrowId));
+
+		deepest->removeItem(arrows);
+		expect(!root->isHoldingItemWithId(arrowId));
+		expect(eq(root->getItemHoldingCount(), countByWalking(root)));
+		expect(root->validateCachedAggregates());
+	};
+
+	test("Container holding counters follow moved sub trees and id changes") = [] {
+		auto first = Container::create(bagId, 20);
+		auto second = Container::create(bagId, 20);
+		auto subTree = Container::create(bagId, 20);
+		auto rope = Item::CreateItem(ropeId);
+		createNestedBags(subTree, 3)->internalAddThing(rope);
+
+		first->internalAddThing(subTree);
+		expect(eq(first->getItemHoldingCount(), 8u));
+		first->removeItem(subTree);
+		second->internalAddThing(subTree);
+		expect(eq(first->getItemHoldingCount(), 0u));
+		expect(eq(second->getItemHoldingCount(), 8u));
+
+		rope->setID(usedRopeId);
+		expect(second->isHoldingItemWithId(ropeId));
+		expect(second->isHoldingItemWithId(usedRopeId));
+		expect(!first->isHoldingItemWithId(bagId));
+		expect(first->validateCachedAggregates());
+		expect(second->validateCachedAggregates());
+	};
+
+	test("Container finds nested containers by id after they change their id") = [] {
+		auto root = Container::create(bagId, 20);
+		auto deepest = createNestedBags(root, 3);
+		auto chest = Container::create(bagId, 20);
+		deepest->internalAddThing(chest);
+		expect(!root->isHoldingItemWithId(chestId));
+
+		chest->setID(chestId);
+		expect(root->isHoldingItemWithId(chestId));
+		expect(deepest->isHoldingItemWithId(chestId));
+		expect(root->validateCachedAggregates());
+
+		deepest->removeItem(chest);
+		expect(!root->isHoldingItemWithId(chestId));
+		expect(root->isHoldingItemWithId(bagId));
+		expect(root->validateCachedAggregates());
+	};
+};
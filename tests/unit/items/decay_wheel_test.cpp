@@ -0,0 +1,236 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/decay/decay_wheel.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct DecayingItem {
+		explicit DecayingItem(uint32_t id) :
+			id(id) { }
+
+		uint32_t id;
+		uint32_t decayBucket = 0;
+		uint32_t decayBucketIndex = std::numeric_limits<uint32_t>::max();
+	};
+
+	using Wheel = DecayWheel<DecayingItem>;
+	using ItemPtr = std::shared_ptr<DecayingItem>;
+
+	constexpr int64_t REVOLUTION = Wheel::BUCKET_DURATION * Wheel::BUCKETS_COUNT;
+
+	std::vector<uint32_t> collect(Wheel &wheel, int64_t now) {
+		std::vector<ItemPtr> due;
+		wheel.collectDue(now, due);
+		std::vector<uint32_t> ids;
+		for (const auto &item : due) {
+			ids.push_back(item->id);
+		}
+		return ids;
+	}
+
+	// The time sorted map the wheel replaced, due items in key order and insertion order within a key
+	struct DecayMap {
+		std::map<int64_t, std::vector<ItemPtr>> items;
+
+		void add(const ItemPtr &item, int64_t timestamp) {
+			items[timestamp].push_back(item);
+		}
+
+		bool remove(const ItemPtr &item, int64_t timestamp) {
+			const auto it = items.find(timestamp);
+			if (it == items.end()) {
+				return false;
+			}
+
+			auto &decayItems = it->second;
+			const auto found = std::ranges::find(decayItems, item);
+			if (found == decayItems.end()) {
+				return false;
+			}
+
+			decayItems.erase(found);
+			if (decayItems.empty()) {
+				items.erase(it);
+			}
+			return true;
+		}
+
+		std::vector<uint32_t> collect(int64_t now) {
+			std::vector<uint32_t> ids;
+			auto it = items.begin();
+			while (it != items.end() && it->first <= now) {
+				for (const auto &item : it->second) {
+					ids.push_back(item->id);
+				}
+				it = items.erase(it);
+			}
+			return ids;
+		}
+	};
+}
+
+suite<"items"> decayWheelTest = [] {
+	test("DecayWheel returns the items due in the same bucket as their time comes") = [] {
+		Wheel wheel;
+		constexpr int64_t now = 1000000;
+		const auto first = std::make_shared<DecayingItem>(1);
+		const auto second = std::make_shared<DecayingItem>(2);
+		const auto third = std::make_shared<DecayingItem>(3);
+		wheel.add(third, now + 45, now);
+		wheel.add(first, now + 5, now);
+		wheel.add(second, now + 20, now);
+		expect(eq(wheel.size(), 3u));
+
+		expect(collect(wheel, now + 4).empty());
+		expect(eq(collect(wheel, now + 5), std::vector<uint32_t> { 1 }));
+		expect(eq(collect(wheel, now + 45), std::vector<uint32_t> { 2, 3 }));
+		expect(wheel.empty());
+	};
+
+	test("DecayWheel keeps items due at the same time in insertion order") = [] {
+		Wheel wheel;
+		constexpr int64_t now = 1000000;
+		std::vector<ItemPtr> items;
+		for (uint32_t id = 0; id < 6; ++id) {
+			items.push_back(std::make_shared<DecayingItem>(id));
+			wheel.add(items.back(), now + 100, now);
+		}
+		// Swapping the last item into the hole must not change the order
+		expect(wheel.remove(items[1]));
+		expect(eq(collect(wheel, now + 100), std::vector<uint32_t> { 0, 2, 3, 4, 5 }));
+	};
+
+	test("DecayWheel wraps around the end of the ring") = [] {
+		Wheel wheel;
+		// Two buckets before the ring starts over
+		const int64_t now = REVOLUTION * 10 - Wheel::BUCKET_DURATION * 2;
+		const auto beforeWrap = std::make_shared<DecayingItem>(1);
+		const auto afterWrap = std::make_shared<DecayingItem>(2);
+		wheel.add(afterWrap, now + Wheel::BUCKET_DURATION * 3, now);
+		wheel.add(beforeWrap, now + Wheel::BUCKET_DURATION, now);
+		expect(lt(afterWrap->decayBucket, beforeWrap->decayBucket));
+
+		for (int64_t time = now; time < now + Wheel::BUCKET_DURATION; time += 10) {
+			expect(collect(wheel, time).empty());
+		}
+		expect(eq(collect(wheel, now + Wheel::BUCKET_DURATION), std::vector<uint32_t> { 1 }));
+		expect(collect(wheel, now + Wheel::BUCKET_DURATION * 3 - 1).empty());
+		expect(eq(collect(wheel, now + Wheel::BUCKET_DURATION * 3), std::vector<uint32_t> { 2 }));
+	};
+
+	test("DecayWheel skips items due more than one revolution ahead until their time") = [] {
+		Wheel wheel;
+		constexpr int64_t now = 1000000;
+		const auto longItem = std::make_shared<DecayingItem>(1);
+		const auto shortItem = std::make_shared<DecayingItem>(2);
+		const int64_t longTimestamp = now + REVOLUTION * 2 + 7;
+		wheel.add(longItem, longTimestamp, now);
+		// Same bucket as the long one, two revolutions earlier
+		wheel.add(shortItem, longTimestamp - REVOLUTION * 2, now);
+		expect(eq(longItem->decayBucket, shortItem->decayBucket));
+
+		std::vector<uint32_t> due;
+		int64_t time = now;
+		for (; time < longTimestamp; time += Wheel::BUCKET_DURATION) {
+			for (const auto id : collect(wheel, time)) {
+				due.push_back(id);
+			}
+		}
+		expect(eq(due, std::vector<uint32_t> { 2 }));
+		expect(eq(wheel.size(), 1u));
+		expect(eq(collect(wheel, longTimestamp), std::vector<uint32_t> { 1 }));
+	};
+
+	test("DecayWheel catches up after falling behind by several revolutions") = [] {
+		Wheel wheel;
+		constexpr int64_t now = 1000000;
+		std::vector<ItemPtr> items;
+		for (uint32_t id = 0; id < 10; ++id) {
+			items.push_back(std::make_shared<DecayingItem>(id));
+			wheel.add(items.back(), now + (id + 1) * REVOLUTION / 3, now);
+		}
+		expect(eq(collect(wheel, now + REVOLUTION * 5), std::vector<uint32_t> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+		expect(wheel.empty());
+	};
+
+	test("DecayWheel removes pending items and ignores items it no longer holds") = [] {
+		Wheel wheel;
+		constexpr int64_t now = 1000000;
+		const auto first = std::make_shared<DecayingItem>(1);
+		const auto second = std::make_shared<DecayingItem>(2);
+		const auto third = std::make_shared<DecayingItem>(3);
+		wheel.add(first, now + 10, now);
+		wheel.add(second, now + 20, now);
+		wheel.add(third, now + 30, now);
+
+		expect(wheel.remove(second));
+		expect(!wheel.remove(second));
+		expect(eq(wheel.size(), 2u));
+		expect(eq(collect(wheel, now + 30), std::vector<uint32_t> { 1, 3 }));
+		expect(!wheel.remove(first));
+		expect(wheel.empty());
+	};
+
+	test("DecayWheel moves a re-added item to its new time") = [] {
+		Wheel wheel;
+		constexpr int64_t now = 1000000;
+		const auto item = std::make_shared<DecayingItem>(1);
+		wheel.add(item, now + 100, now);
+		expect(wheel.remove(item));
+		wheel.add(item, now + 5000, now + 50);
+
+		expect(collect(wheel, now + 100).empty());
+		expect(collect(wheel, now + 4999).empty());
+		expect(eq(collect(wheel, now + 5000), std::vector<uint32_t> { 1 }));
+	};
+
+	test("DecayWheel returns the same items in the same order as the time sorted map") = [] {
+		Wheel wheel;
+		DecayMap decayMap;
+		std::mt19937 random(27);
+		std::vector<std::pair<ItemPtr, int64_t>> pending;
+		int64_t now = 1000000;
+		uint32_t nextId = 0;
+		size_t checked = 0;
+
+		for (uint32_t step = 0; step < 20000; ++step) {
+			const auto action = random() % 10;
+			if (action < 5) {
+				// Mostly short decays, a few past one revolution, and ties on the same timestamp
+				const int64_t duration = action == 0 ? REVOLUTION + random() % REVOLUTION : (random() % 40) * 25;
+				const auto item = std::make_shared<DecayingItem>(nextId++);
+				wheel.add(item, now + duration, now);
+				decayMap.add(item, now + duration);
+				pending.emplace_back(item, now + duration);
+			} else if (action < 7 && !pending.empty()) {
+				const auto index = random() % pending.size();
+				const auto [item, timestamp] = pending[index];
+				expect(eq(wheel.remove(item), decayMap.remove(item, timestamp)));
+				pending[index] = pending.back();
+				pending.pop_back();
+			} else {
+				now += random() % 120;
+				const auto due = collect(wheel, now);
+				expect(eq(due, decayMap.collect(now)));
+				checked += due.size();
+			}
+		}
+
+		now += REVOLUTION * 2;
+		const auto remaining = collect(wheel, now);
+		expect(eq(remaining, decayMap.collect(now)));
+		expect(wheel.empty());
+		expect(gt(checked, 0u));
+	};
+};
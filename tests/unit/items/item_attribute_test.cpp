@@ -0,0 +1,74 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/functions/item/attribute.hpp"
+
+using namespace boost::ut;
+
+suite<"items"> itemAttributeTest = [] {
+	test("ItemAttribute keeps integer and string values apart by type") = [] {
+		ItemAttribute attribute;
+		attribute.setAttribute(ItemAttribute_t::TIER, 3);
+		attribute.setAttribute(ItemAttribute_t::ACTIONID, 1000);
+		attribute.setAttribute(ItemAttribute_t::DURATION, 60);
+		attribute.setAttribute(ItemAttribute_t::TEXT, "written");
+		attribute.setAttribute(ItemAttribute_t::DESCRIPTION, "described");
+
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::ACTIONID), 1000));
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::DURATION), 60));
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::TIER), 3));
+		expect(eq(attribute.getAttributeString(ItemAttribute_t::TEXT), std::string("written")));
+		expect(eq(attribute.getAttributeString(ItemAttribute_t::DESCRIPTION), std::string("described")));
+
+		// Wrong kinds and empty strings are ignored
+		attribute.setAttribute(ItemAttribute_t::TEXT, 5);
+		attribute.setAttribute(ItemAttribute_t::WRITER, "");
+		expect(eq(attribute.getAttributeString(ItemAttribute_t::TEXT), std::string("written")));
+		expect(!attribute.hasAttribute(ItemAttribute_t::WRITER));
+
+		expect(attribute.removeAttribute(ItemAttribute_t::ACTIONID));
+		expect(!attribute.removeAttribute(ItemAttribute_t::ACTIONID));
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::ACTIONID), 0));
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::DURATION), 60));
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::TIER), 3));
+	};
+
+	test("ItemAttribute copies are independent and share interned strings") = [] {
+		ItemAttribute attribute;
+		attribute.setAttribute(ItemAttribute_t::CHARGES, 10);
+		attribute.setAttribute(ItemAttribute_t::WRITER, "Knight");
+
+		ItemAttribute copy(attribute);
+		copy.setAttribute(ItemAttribute_t::CHARGES, 9);
+		expect(eq(attribute.getAttributeValue(ItemAttribute_t::CHARGES), 10));
+		expect(eq(copy.getAttributeValue(ItemAttribute_t::CHARGES), 9));
+
+		ItemAttribute other;
+		other.setAttribute(ItemAttribute_t::WRITER, std::string("Knight"));
+		expect(&other.getAttributeString(ItemAttribute_t::WRITER) == &attribute.getAttributeString(ItemAttribute_t::WRITER));
+	};
+
+	test("ItemAttribute custom attributes are sorted and case insensitive") = [] {
+		ItemAttribute attribute;
+		attribute.setCustomAttribute("Zeta", int64_t(1));
+		attribute.setCustomAttribute("alpha", true);
+		attribute.setCustomAttribute("ZETA", int64_t(2));
+
+		const auto &list = attribute.getCustomAttributeList();
+		expect(eq(list.size(), 2u));
+		expect(eq(list.front().first, std::string("alpha")));
+		expect(eq(attribute.getCustomAttribute("zeta")->getInteger(), 2));
+
+		expect(attribute.removeCustomAttribute("Alpha"));
+		expect(attribute.getCustomAttribute("alpha") == nullptr);
+	};
+};
@@ -0,0 +1,205 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/logging/in_memory_logger.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
+#include "lua/scripts/lua_chunk_compiler.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct CacheFolders {
+		// Unique per run, so concurrent runs do not share entries
+		std::filesystem::path root = std::filesystem::temp_directory_path() / fmt::format("canary_lua_bytecode_cache_test_{}", std::random_device {}());
+		std::filesystem::path scripts = root / "scripts";
+		std::filesystem::path cache = root / "cache";
+
+		CacheFolders() {
+			std::filesystem::create_directories(scripts);
+		}
+
+		~CacheFolders() {
+			std::filesystem::remove_all(root);
+		}
+
+		std::string write(const std::string &name, const std::string &source) const {
+			const auto path = (scripts / name).string();
+			std::ofstream(path, std::ios::trunc) << source;
+			return path;
+		}
+	};
+
+	// Runs the chunk and returns the global "value" it sets
+	lua_Integer run(const LuaChunk &chunk) {
+		lua_State* L = luaL_newstate();
+		lua_Integer value = -1;
+		const auto chunkName = "@" + chunk.file;
+		if (luaL_loadbuffer(L, chunk.bytecode.data(), chunk.bytecode.size(), chunkName.c_str()) == 0 && lua_pcall(L, 0, 0, 0) == 0) {
+			lua_getglobal(L, "value");
+			value = lua_tointeger(L, -1);
+		}
+		lua_close(L);
+		return value;
+	}
+}
+
+suite<"lua"> luaBytecodeCacheTest = [] {
+	test("LuaBytecodeCache serves unchanged scripts and compiles edited ones again") = [] {
+		CacheFolders folders;
+		LuaBytecodeCache cache;
+		cache.setDirectory(folders.cache);
+		lua_State* L = luaL_newstate();
+
+		const auto file = folders.write("script.lua", "value = 1");
+		LuaChunk chunk { file };
+		expect(LuaChunkCompiler::compile(L, chunk, &cache));
+		expect(eq(cache.getHits(), 0u) and eq(cache.getMisses(), 1u));
+		expect(eq(run(chunk), lua_Integer { 1 }));
+
+		LuaChunk cached { file };
+		expect(LuaChunkCompiler::compile(L, cached, &cache));
+		expect(eq(cache.getHits(), 1u));
+		expect(eq(cached.bytecode, chunk.bytecode));
+
+		// Edited, the size changes
+		folders.write("script.lua", "value = 200");
+		LuaChunk edited { file };
+		expect(LuaChunkCompiler::compile(L, edited, &cache));
+		expect(eq(cache.getMisses(), 2u));
+		expect(eq(run(edited), lua_Integer { 200 }));
+
+		// Edited, same size but a new time
+		folders.write("script.lua", "value = 300");
+		std::filesystem::last_write_time(file, std::filesystem::last_write_time(file) + std::chrono::hours(1));
+		LuaChunk sameSize { file };
+		expect(LuaChunkCompiler::compile(L, sameSize, &cache));
+		expect(eq(cache.getMisses(), 3u));
+		expect(eq(run(sameSize), lua_Integer { 300 }));
+
+		// Touched only, the content hash keeps the entry
+		std::filesystem::last_write_time(file, std::filesystem::last_write_time(file) + std::chrono::hours(1));
+		LuaChunk touched { file };
+		expect(LuaChunkCompiler::compile(L, touched, &cache));
+		expect(eq(cache.getHits(), 2u) and eq(cache.getMisses(), 3u));
+		expect(eq(run(touched), lua_Integer { 300 }));
+
+		lua_close(L);
+	};
+
+	test("LuaBytecodeCache compiles again over a corrupted entry") = [] {
+		CacheFolders folders;
+		LuaBytecodeCache cache;
+		cache.setDirectory(folders.cache);
+		lua_State* L = luaL_newstate();
+
+		const auto file = folders.write("script.lua", "value = 7");
+		LuaChunk chunk { file };
+		expect(LuaChunkCompiler::compile(L, chunk, &cache));
+		for (const auto &entry : std::filesystem::directory_iterator(folders.cache)) {
+			std::ofstream(entry.path(), std::ios::binary | std::ios::trunc) << "CLBC garbage";
+		}
+
+		LuaChunk recompiled { file };
+		expect(LuaChunkCompiler::compile(L, recompiled, &cache));
+		expect(eq(cache.getHits(), 0u) and eq(cache.getMisses(), 2u));
+		expect(eq(run(recompiled), lua_Integer { 7 }));
+
+		LuaChunk cached { file };
+		expect(LuaChunkCompiler::compile(L, cached, &cache));
+		expect(eq(cache.getHits(), 1u));
+		lua_close(L);
+	};
+
+	test("LuaBytecodeCache does nothing without a directory") = [] {
+		CacheFolders folders;
+		LuaBytecodeCache cache;
+		lua_State* L = luaL_newstate();
+
+		LuaChunk chunk { folders.write("script.lua", "value = 3") };
+		expect(LuaChunkCompiler::compile(L, chunk, &cache));
+		expect(eq(run(chunk), lua_Integer { 3 }));
+		expect(eq(cache.getHits() + cache.getMisses(), 0u));
+		expect(!std::filesystem::exists(folders.cache));
+		lua_close(L);
+	};
+
+	test("LuaBytecodeCache checks the content of scripts saved too close to their entry for the time to tell") = [] {
+		CacheFolders folders;
+		LuaBytecodeCache cache;
+		cache.setDirectory(folders.cache);
+		lua_State* L = luaL_newstate();
+
+		const auto file = folders.write("script.lua", "value = 1");
+		LuaChunk chunk { file };
+		expect(LuaChunkCompiler::compile(L, chunk, &cache));
+
+		// Saved again within the same time step, size and time are unchanged
+		const auto modified = std::filesystem::last_write_time(file);
+		folders.write("script.lua", "value = 2");
+		std::filesystem::last_write_time(file, modified);
+		LuaChunk saved { file };
+		expect(LuaChunkCompiler::compile(L, saved, &cache));
+		expect(eq(cache.getHits(), 0u) and eq(cache.getMisses(), 2u));
+		expect(eq(run(saved), lua_Integer { 2 }));
+		lua_close(L);
+	};
+
+	test("LuaBytecodeCache compiles again over a corrupted bytecode") = [] {
+		CacheFolders folders;
+		LuaBytecodeCache cache;
+		cache.setDirectory(folders.cache);
+		lua_State* L = luaL_newstate();
+
+		const auto file = folders.write("script.lua", "value = 5");
+		LuaChunk chunk { file };
+		expect(LuaChunkCompiler::compile(L, chunk, &cache));
+		// The bytecode is the end of the entry
+		for (const auto &entry : std::filesystem::directory_iterator(folders.cache)) {
+			std::fstream stream(entry.path(), std::ios::binary | std::ios::in | std::ios::out);
+			stream.seekg(-1, std::ios::end);
+			const auto last = static_cast<char>(stream.get());
+			stream.seekp(-1, std::ios::end);
+			stream.put(static_cast<char>(last ^ 0x5a));
+		}
+
+		LuaChunk recompiled { file };
+		expect(LuaChunkCompiler::compile(L, recompiled, &cache));
+		expect(eq(cache.getHits(), 0u) and eq(cache.getMisses(), 2u));
+		expect(eq(run(recompiled), lua_Integer { 5 }));
+		lua_close(L);
+	};
+
+	test("LuaBytecodeCache serves a datapack compiled on the thread pool") = [] {
+		constexpr size_t scriptCount = 50;
+		InMemoryLogger logger;
+		ThreadPool threadPool(logger);
+		CacheFolders folders;
+		std::vector<std::string> files;
+		for (size_t i = 0; i < scriptCount; ++i) {
+			files.push_back(folders.write(fmt::format("script_{}.lua", i), fmt::format("value = {}", i)));
+		}
+
+		LuaBytecodeCache cache;
+		cache.setDirectory(folders.cache);
+		LuaChunkCompiler::compile(threadPool, files, &cache);
+		expect(eq(cache.getMisses(), scriptCount));
+
+		cache.resetCounters();
+		const auto chunks = LuaChunkCompiler::compile(threadPool, files, &cache);
+		threadPool.shutdown();
+		expect(eq(cache.getHits(), scriptCount));
+		for (size_t i = 0; i < chunks.size(); ++i) {
+			expect(eq(run(chunks[i]), static_cast<lua_Integer>(i)));
+		}
+	};
+};
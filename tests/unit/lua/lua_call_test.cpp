@@ -0,0 +1,84 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lua/functions/map/position_functions.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr Position testPosition(100, 200, 7);
+
+	int getPositionByName(lua_State* L) {
+		lua_createtable(L, 0, 4);
+		LuaFunctionsLoader::setField(L, "x", testPosition.x);
+		LuaFunctionsLoader::setField(L, "y", testPosition.y);
+		LuaFunctionsLoader::setField(L, "z", testPosition.z);
+		LuaFunctionsLoader::setField(L, "stackpos", 0);
+		luaL_getmetatable(L, "Position");
+		lua_setmetatable(L, -2);
+		return 1;
+	}
+
+	int getPosition(lua_State* L) {
+		LuaFunctionsLoader::pushPosition(L, testPosition);
+		return 1;
+	}
+
+	struct LuaState {
+		lua_State* L = luaL_newstate();
+
+		LuaState() {
+			luaL_openlibs(L);
+			PositionFunctions::init(L);
+			lua_register(L, "getPositionByName", getPositionByName);
+			lua_register(L, "getPosition", getPosition);
+		}
+
+		~LuaState() {
+			LuaFunctionsLoader::clearMetatableRefs(L);
+			lua_close(L);
+		}
+
+		bool run(const std::string &script) const {
+			if (luaL_dostring(L, script.c_str()) != 0) {
+				log << fmt::format("lua error: {}\n", lua_tostring(L, -1));
+				lua_pop(L, 1);
+				return false;
+			}
+			return true;
+		}
+	};
+}
+
+suite<"lua"> luaCallTest = [] {
+	test("Pushed objects get the class metatable from the cached ref") = [] {
+		LuaState lua;
+		expect(lua.run(R"(
+			local position = getPosition()
+			assert(getmetatable(position) == getmetatable(getPositionByName()))
+			assert(position == Position(100, 200, 7))
+		)"));
+	};
+
+	test("Metatables are found by name again once the refs are cleared") = [] {
+		LuaState lua;
+		LuaFunctionsLoader::clearMetatableRefs(lua.L);
+		expect(lua.run("assert(getmetatable(getPosition()) == getmetatable(getPositionByName()))"));
+	};
+
+	test("Each state pushes the metatables it registered") = [] {
+		LuaState first;
+		LuaState second;
+		expect(first.run("assert(getmetatable(getPosition()) == getmetatable(getPositionByName()))"));
+		expect(second.run("assert(getmetatable(getPosition()) == getmetatable(getPositionByName()))"));
+	};
+};
@@ -0,0 +1,86 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/logging/in_memory_logger.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lua/scripts/lua_chunk_compiler.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct ScriptFolder {
+		// Unique per run, so concurrent runs do not delete each other's scripts
+		std::filesystem::path dir = std::filesystem::temp_directory_path() / fmt::format("canary_lua_chunk_compiler_test_{}", std::random_device {}());
+
+		ScriptFolder() {
+			std::filesystem::create_directories(dir);
+		}
+
+		~ScriptFolder() {
+			std::filesystem::remove_all(dir);
+		}
+
+		std::string write(const std::string &name, const std::string &source) const {
+			const auto path = (dir / name).string();
+			std::ofstream(path) << source;
+			return path;
+		}
+	};
+
+	bool execute(lua_State* L, const LuaChunk &chunk) {
+		const auto chunkName = "@" + chunk.file;
+		if (luaL_loadbuffer(L, chunk.bytecode.data(), chunk.bytecode.size(), chunkName.c_str()) != 0 || lua_pcall(L, 0, 0, 0) != 0) {
+			lua_pop(L, 1);
+			return false;
+		}
+		return true;
+	}
+
+	lua_Integer getLoadedScripts(lua_State* L) {
+		lua_getglobal(L, "loadedScripts");
+		const auto loaded = lua_tointeger(L, -1);
+		lua_pop(L, 1);
+		return loaded;
+	}
+}
+
+suite<"lua"> luaChunkCompilerTest = [] {
+	test("LuaChunkCompiler compiles on the thread pool and keeps the order of the files") = [] {
+		InMemoryLogger logger;
+		ThreadPool threadPool(logger);
+		ScriptFolder folder;
+		const std::vector<std::string> files = {
+			folder.write("first.lua", "loadedScripts = 1"),
+			folder.write("broken.lua", "local function ("),
+			folder.write("second.lua", "loadedScripts = loadedScripts + 1"),
+			(folder.dir / "missing.lua").string(),
+		};
+
+		const auto chunks = LuaChunkCompiler::compile(threadPool, files);
+		threadPool.shutdown();
+
+		expect(eq(chunks.size(), files.size()));
+		for (size_t i = 0; i < files.size(); ++i) {
+			expect(eq(chunks[i].file, files[i]));
+		}
+		expect(chunks[0].error.empty() && !chunks[0].bytecode.empty());
+		expect(!chunks[1].error.empty() && chunks[1].bytecode.empty());
+		expect(chunks[1].error.find("broken.lua") != std::string::npos);
+		expect(!chunks[3].error.empty());
+
+		lua_State* L = luaL_newstate();
+		expect(execute(L, chunks[0]));
+		expect(execute(L, chunks[2]));
+		expect(eq(getLoadedScripts(L), lua_Integer { 2 }));
+		lua_close(L);
+	};
+};
@@ -0,0 +1,83 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lua/functions/map/position_functions.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr Position testPosition(32369, 32241, 7);
+
+	int getPosition(lua_State* L) {
+		LuaFunctionsLoader::pushPosition(L, testPosition);
+		return 1;
+	}
+
+	int getPackedPosition(lua_State* L) {
+		LuaFunctionsLoader::pushPackedPosition(L, testPosition);
+		return 1;
+	}
+
+	int toPosition(lua_State* L) {
+		const Position position = LuaFunctionsLoader::getPosition(L, 1);
+		lua_pushboolean(L, position == testPosition);
+		return 1;
+	}
+
+	struct LuaState {
+		lua_State* L = luaL_newstate();
+
+		LuaState() {
+			luaL_openlibs(L);
+			PositionFunctions::init(L);
+			lua_register(L, "getPosition", getPosition);
+			lua_register(L, "getPackedPosition", getPackedPosition);
+			lua_register(L, "isTestPosition", toPosition);
+		}
+
+		~LuaState() {
+			LuaFunctionsLoader::clearMetatableRefs(L);
+			lua_close(L);
+		}
+
+		bool run(const std::string &script) const {
+			if (luaL_dostring(L, script.c_str()) != 0) {
+				log << fmt::format("lua error: {}\n", lua_tostring(L, -1));
+				lua_pop(L, 1);
+				return false;
+			}
+			return true;
+		}
+	};
+}
+
+suite<"lua"> positionTest = [] {
+	test("Packed positions round trip") = [] {
+		const auto packed = LuaFunctionsLoader::packPosition(testPosition);
+		expect(LuaFunctionsLoader::unpackPosition(packed) == testPosition);
+
+		constexpr Position maxPosition(std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint16_t>::max(), MAP_MAX_LAYERS - 1);
+		expect(LuaFunctionsLoader::unpackPosition(LuaFunctionsLoader::packPosition(maxPosition)) == maxPosition);
+	};
+
+	test("Packed positions are accepted wherever positions are read") = [] {
+		LuaState lua;
+		expect(lua.run(R"(
+			assert(isTestPosition(getPackedPosition()))
+			assert(isTestPosition(getPosition()))
+			assert(Position.unpack(getPackedPosition()) == getPosition())
+			assert(getPosition():pack() == getPackedPosition())
+			local visited = { [getPackedPosition()] = true }
+			assert(visited[getPosition():pack()])
+		)"));
+	};
+};
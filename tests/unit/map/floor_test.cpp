@@ -0,0 +1,76 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/tile.hpp"
+#include "map/mapcache.hpp"
+
+using namespace boost::ut;
+
+suite<"map"> floorTest = [] {
+	test("Floor::getTile returns the published tile") = [] {
+		Floor floor(7);
+		expect(floor.getTile(100, 100) == nullptr);
+
+		const auto tile = std::make_shared<StaticTile>(100, 100, 7);
+		floor.setTile(100, 100, tile);
+		expect(floor.getTile(100, 100) == tile);
+		expect(floor.getTile(101, 100) == nullptr);
+	};
+
+	test("Floor::setTile keeps a replaced tile alive while a reader holds it") = [] {
+		Floor floor(7);
+		std::weak_ptr<Tile> weakOld;
+		{
+			const auto oldTile = std::make_shared<StaticTile>(100, 100, 7);
+			weakOld = oldTile;
+			floor.setTile(100, 100, oldTile);
+		}
+
+		auto reader = floor.getTile(100, 100);
+		const auto newTile = std::make_shared<DynamicTile>(100, 100, 7);
+		floor.setTile(100, 100, newTile);
+		expect(floor.getTile(100, 100) == newTile);
+		expect(!weakOld.expired());
+
+		// Nothing is retired, the last reader frees it
+		reader.reset();
+		expect(weakOld.expired());
+	};
+
+	test("Floor::getTile returns a whole tile while another thread replaces it") = [] {
+		Floor floor(7);
+		floor.setTile(100, 100, std::make_shared<StaticTile>(100, 100, 7));
+		std::atomic_bool done = false;
+		std::atomic_size_t broken = 0;
+		std::vector<std::thread> readers;
+		for (int i = 0; i < 4; ++i) {
+			readers.emplace_back([&] {
+				while (!done) {
+					const auto tile = floor.getTile(100, 100);
+					if (!tile || tile->getPosition() != Position(100, 100, 7)) {
+						++broken;
+					}
+				}
+			});
+		}
+
+		for (int i = 0; i < 20000; ++i) {
+			std::unique_lock lock(floor.getMutex());
+			floor.setTile(100, 100, std::make_shared<StaticTile>(100, 100, 7));
+		}
+		done = true;
+		for (auto &reader : readers) {
+			reader.join();
+		}
+		expect(eq(broken.load(), 0u));
+	};
+};
@@ -0,0 +1,36 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "map/map.hpp"
+
+using namespace boost::ut;
+
+suite<"map"> hibernationRangeTest = [] {
+	test("Map hibernation range covers the view port from anywhere in a leaf") = [] {
+		// A player seen by a creature must stand in a leaf the creature checks, or the creature would hibernate in sight
+		for (int32_t x = 0; x < FLOOR_SIZE; ++x) {
+			for (int32_t dx = -MAP_MAX_VIEW_PORT_X - FLOOR_SIZE; dx <= MAP_MAX_VIEW_PORT_X + FLOOR_SIZE; ++dx) {
+				const int32_t base = 1000 * FLOOR_SIZE;
+				const auto leafDistance = std::abs(((base + x + dx) >> FLOOR_BITS) - ((base + x) >> FLOOR_BITS));
+				expect(leafDistance <= Map::HIBERNATION_RANGE_X) << "x" << x << "dx" << dx;
+			}
+		}
+
+		for (int32_t y = 0; y < FLOOR_SIZE; ++y) {
+			for (int32_t dy = -MAP_MAX_VIEW_PORT_Y - FLOOR_SIZE; dy <= MAP_MAX_VIEW_PORT_Y + FLOOR_SIZE; ++dy) {
+				const int32_t base = 1000 * FLOOR_SIZE;
+				const auto leafDistance = std::abs(((base + y + dy) >> FLOOR_BITS) - ((base + y) >> FLOOR_BITS));
+				expect(leafDistance <= Map::HIBERNATION_RANGE_Y) << "y" << y << "dy" << dy;
+			}
+		}
+	};
+};
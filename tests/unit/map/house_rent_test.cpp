@@ -0,0 +1,69 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "map/house/house_rent.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	constexpr time_t day = 24 * 60 * 60;
+	constexpr time_t now = 1700000000;
+
+	HouseRent::Settings weeklySettings(int64_t daysToReset = 0, bool vipKeepsHouse = false) {
+		HouseRent::Settings settings;
+		settings.now = now;
+		settings.period = HouseRent::getPeriodSeconds(RENTPERIOD_WEEKLY);
+		settings.daysToReset = daysToReset;
+		settings.vipKeepsHouse = vipKeepsHouse;
+		return settings;
+	}
+
+	HouseRent::Owner owner(uint64_t balance, time_t lastLogin = now, time_t premiumLastDay = 0) {
+		HouseRent::Owner result;
+		result.name = "Owner";
+		result.balance = balance;
+		result.lastLogin = lastLogin;
+		result.premiumLastDay = premiumLastDay;
+		return result;
+	}
+}
+
+suite<"map"> houseRentTest = [] {
+	test("HouseRent::plan settles each lease like the per house loop did") = [] {
+		HouseRent::Owners owners;
+		owners[1] = owner(1500);
+		owners[2] = owner(10);
+		owners[3] = owner(1000000, now - 40 * day);
+		owners[4] = owner(0, now - 40 * day, now + day);
+
+		const std::vector<HouseRent::Lease> leases = {
+			{ 1, 1, 1000, now - day, 0 },
+			// Second house of the same owner, only 500 gold left after the first one
+			{ 2, 1, 1000, now - day, 0 },
+			{ 3, 2, 1000, now - day, 3 },
+			{ 4, 2, 1000, now - day, HouseRent::MAX_WARNINGS },
+			{ 5, 2, 1000, now + day, 0 },
+			{ 6, 9, 1000, now - day, 0 },
+			{ 7, 3, 1000, now - day, 0 },
+			{ 8, 4, 0, now - day, 0 },
+		};
+
+		const auto actions = HouseRent::plan(leases, owners, weeklySettings(30, true));
+		using enum HouseRent::Action;
+		const std::vector<HouseRent::Action> expected = { Pay, Warn, Warn, Evict, None, Release, EvictInactive, None };
+		expect(actions == expected);
+		expect(eq(owners[1].balance, 500u));
+		expect(owners[1].charged);
+		expect(!owners[2].charged);
+		expect(eq(owners[3].balance, 1000000u));
+	};
+};
@@ -0,0 +1,79 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "game/zones/zone.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	// Tile by tile like the map loader does, addArea would refresh the tiles of a map that is not loaded here
+	void addTiles(const std::shared_ptr<Zone> &zone, const Area &area) {
+		for (const auto &position : area) {
+			zone->addPosition(position);
+		}
+	}
+
+	bool containsZone(const std::vector<std::shared_ptr<Zone>> &zones, const std::shared_ptr<Zone> &zone) {
+		return std::ranges::find(zones, zone) != zones.end();
+	}
+}
+
+suite<"map"> zoneTest = [] {
+	test("Zone merges tiles added one by one into areas and carves removed tiles out") = [] {
+		const auto zone = Zone::addZone("zone_test_merge");
+		expect(zone != nullptr);
+		addTiles(zone, Area(Position(100, 100, 7), Position(109, 109, 7)));
+		expect(eq(zone->getAreas().size(), 1u));
+		expect(eq(zone->getPositions().size(), 100u));
+
+		const Position hole(104, 104, 7);
+		expect(containsZone(Zone::getZones(hole), zone));
+		zone->removePosition(hole);
+		expect(eq(zone->getAreas().size(), 4u));
+		expect(eq(zone->getPositions().size(), 99u));
+		expect(!containsZone(Zone::getZones(hole), zone));
+		expect(containsZone(Zone::getZones(Position(105, 104, 7)), zone));
+		expect(!containsZone(Zone::getZones(Position(110, 104, 7)), zone));
+	};
+	test("Zone lookups from another thread keep seeing an area while other tiles change") = [] {
+		const auto zone = Zone::addZone("zone_test_threads");
+		addTiles(zone, Area(Position(200, 200, 7), Position(209, 209, 7)));
+
+		// Like the pathfinding threads reaching Zone::getZones through Map::getTile
+		std::atomic<bool> done = false;
+		std::atomic<size_t> lookups = 0;
+		std::atomic<size_t> misses = 0;
+		std::thread reader([&] {
+			while (!done || lookups == 0) {
+				if (!containsZone(Zone::getZones(Position(205, 205, 7)), zone)) {
+					++misses;
+				}
+				++lookups;
+			}
+		});
+
+		for (uint16_t x = 300; x < 500; ++x) {
+			zone->addPosition(Position(x, 300, 7));
+			Zone::addZone(fmt::format("zone_test_threads_{}", x))->addPosition(Position(x, 301, 7));
+		}
+		for (uint16_t x = 300; x < 500; x += 2) {
+			zone->removePosition(Position(x, 300, 7));
+		}
+		done = true;
+		reader.join();
+
+		expect(eq(misses.load(), 0u));
+		expect(containsZone(Zone::getZones(Position(301, 300, 7)), zone));
+		expect(!containsZone(Zone::getZones(Position(300, 300, 7)), zone));
+		expect(eq(Zone::getZones(Position(300, 301, 7)).size(), 1u));
+	};
+};
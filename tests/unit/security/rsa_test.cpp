@@ -12,8 +12,10 @@
 
 #include "lib/logging/in_memory_logger.hpp"
 #include "security/rsa.hpp"
+#include "security/rsa_fixture.hpp"
 
 using namespace boost::ut;
+using namespace rsa_fixture;
 
 suite<"security"> rsaTest = [] {
 	test("RSA::start logs error for missing .pem file") = [] {
@@ -29,4 +31,24 @@ suite<"security"> rsaTest = [] {
 			eq(std::string { "error" }, logger.logs[0].level) and eq(std::string { "File key.pem not found or have problem on loading... Setting standard rsa key\n" }, logger.logs[0].message)
 		);
 	};
+
+	test("RSA::decrypt restores what the public key encrypted") = [] {
+		di::extension::injector<> injector {};
+		DI::setTestContainer(&InMemoryLogger::install(injector));
+		auto &rsa = DI::create<RSA &>();
+		rsa.setKey(p, q);
+
+		std::mt19937 rng(44);
+		std::uniform_int_distribution<int> byte(0, 255);
+		for (int i = 0; i < 100; ++i) {
+			std::array<char, 128> plain {};
+			for (size_t j = 1; j < plain.size(); ++j) {
+				plain[j] = static_cast<char>(byte(rng));
+			}
+
+			auto block = encrypt(plain);
+			rsa.decrypt(block.data());
+			expect(block == plain) << "block" << i;
+		}
+	};
 };
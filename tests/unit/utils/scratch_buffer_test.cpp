@@ -0,0 +1,34 @@
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "utils/scratch_buffer.hpp"
+
+using namespace boost::ut;
+
+suite<"utils"> scratchBufferTest = [] {
+	test("ScratchBuffer reuses the released buffer empty") = [] {
+		const std::vector<int>* lent = nullptr;
+		{
+			const ScratchBuffer<std::vector<int>> buffer;
+			buffer->assign({ 1, 2, 3 });
+			lent = &*buffer;
+		}
+
+		const ScratchBuffer<std::vector<int>> buffer;
+		expect(&*buffer == lent);
+		expect(buffer->empty());
+	};
+
+	test("ScratchBuffer lends a nested use its own buffer") = [] {
+		const ScratchBuffer<std::vector<int>> outer;
+		outer->push_back(1);
+		{
+			const ScratchBuffer<std::vector<int>> inner;
+			expect(&*inner != &*outer);
+			inner->push_back(2);
+		}
+		expect(eq(outer->size(), 1u));
+		expect(eq(outer->front(), 1));
+	};
+};